@@ -24,11 +24,36 @@
 	#pragma once
 #endif
 
+#include <AuroraFW/Math/Vector.h>
 #include <AuroraFW/Math/Vector2D.h>
 #include <AuroraFW/Math/Vector3D.h>
 #include <AuroraFW/Math/Vector4D.h>
 #include <AuroraFW/Math/Matrix.h>
 #include <AuroraFW/Math/Algorithm.h>
+#include <AuroraFW/Math/Half.h>
+#include <AuroraFW/Math/Fixed.h>
+#include <AuroraFW/Math/Packing.h>
 #include <AuroraFW/Math/Utils.h>
+#include <AuroraFW/Math/VectorTraits.h>
+#include <AuroraFW/Math/AABB.h>
+#include <AuroraFW/Math/Frustum.h>
+#include <AuroraFW/Math/Distance.h>
+#include <AuroraFW/Math/Ray.h>
+#include <AuroraFW/Math/BVH.h>
+#include <AuroraFW/Math/KDTree.h>
+#include <AuroraFW/Math/SpaceFillingCurve.h>
+#include <AuroraFW/Math/ConvexHull.h>
+#include <AuroraFW/Math/Spline.h>
+#include <AuroraFW/Math/Noise.h>
+#include <AuroraFW/Math/FFT.h>
+#include <AuroraFW/Math/Random.h>
+#include <AuroraFW/Math/Reduction.h>
+#include <AuroraFW/Math/SpatialHash.h>
+#include <AuroraFW/Math/Archive.h>
+#include <AuroraFW/Math/Compression.h>
+#include <AuroraFW/Math/Interval.h>
+#include <AuroraFW/Math/Polynomial.h>
+#include <AuroraFW/Math/IntegerVector.h>
+#include <AuroraFW/Math/DoubleWord.h>
 
 #endif // AURORAFW_MATH_H
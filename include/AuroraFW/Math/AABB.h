@@ -0,0 +1,469 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/AABB.h
+ * Axis-aligned bounding box header. This contains an aabb struct
+ * that bounds a region of 3D space and batch kernels that test boxes
+ * stored as structure of arrays.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_AABB_H
+#define AURORAFW_MATH_AABB_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/STDL/STL/OStream.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Matrix.h>
+#include <AuroraFW/Math/SoA.h>
+
+#include <cstdint>
+#include <limits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A struct that represents an axis-aligned bounding box. The box
+		 * is stored as its minimum and maximum corners.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API aabb {
+			/** Constructs an empty box. Its minimum corner is bigger than
+			 * the maximum one, so the first expand() sets both corners.
+			 * @see aabb(const vec3<T>& , const vec3<T>& )
+			 * @since snapshot20261019
+			 */
+			aabb();
+
+			/** Constructs a box from the given corners.
+			 * @param min The minimum corner.
+			 * @param max The maximum corner.
+			 * @see aabb()
+			 * @since snapshot20261019
+			 */
+			aabb(const vec3<T>& , const vec3<T>& );
+
+			/** Grows this box to also enclose the given point.
+			 * @param p The point to enclose.
+			 * @return This box.
+			 * @see merge(const aabb<T>& )
+			 * @since snapshot20261019
+			 */
+			aabb<T>& expand(const vec3<T>& );
+
+			/** Grows this box to also enclose the given box.
+			 * @param other The box to enclose.
+			 * @return This box.
+			 * @see expand(const vec3<T>& )
+			 * @since snapshot20261019
+			 */
+			aabb<T>& merge(const aabb<T>& );
+
+			/** Transforms this box by the given matrix and replaces it with
+			 * the box that encloses the transformed corners.
+			 * @param mat The transformation matrix.
+			 * @return This box.
+			 * @see transformed()
+			 * @since snapshot20261019
+			 */
+			aabb<T>& transform(const mat<T, 4, 4>& );
+
+			/** Returns a new box enclosing this one transformed by the
+			 * given matrix.
+			 * @param mat The transformation matrix.
+			 * @return The transformed box.
+			 * @see transform()
+			 * @since snapshot20261019
+			 */
+			aabb<T> transformed(const mat<T, 4, 4>& ) const;
+
+			/** Returns <code>true</code> if the given point is inside or on
+			 * the border of this box.
+			 * @since snapshot20261019
+			 */
+			bool contains(const vec3<T>& ) const;
+
+			/** Returns <code>true</code> if the given box is entirely inside
+			 * this box.
+			 * @since snapshot20261019
+			 */
+			bool contains(const aabb<T>& ) const;
+
+			/** Returns <code>true</code> if this box and the given one
+			 * overlap or touch.
+			 * @since snapshot20261019
+			 */
+			bool intersects(const aabb<T>& ) const;
+
+			/** Tests a ray against this box using the slab method.
+			 * @param origin The ray origin.
+			 * @param invDir The component-wise inverse of the ray direction.
+			 * @param tMin The start of the ray interval.
+			 * @param tMax The end of the ray interval.
+			 * @param tNear Receives the entry distance on a hit.
+			 * @return <code>true</code> if the ray hits the box within [tMin, tMax].
+			 * @since snapshot20261019
+			 */
+			bool intersectsRay(const vec3<T>& , const vec3<T>& , T , T , T& ) const;
+
+			/** Returns <code>true</code> if the box encloses no point.
+			 * @since snapshot20261019
+			 */
+			bool isEmpty() const;
+
+			/** Returns the center of the box.
+			 * @since snapshot20261019
+			 */
+			vec3<T> center() const;
+
+			/** Returns the extent of the box along each axis.
+			 * @since snapshot20261019
+			 */
+			vec3<T> size() const;
+
+			/** Returns the surface area of the box.
+			 * @since snapshot20261019
+			 */
+			T surfaceArea() const;
+
+			/** Returns the box as a string.
+			 * @since snapshot20261019
+			 */
+			std::string toString() const;
+
+			/** Returns the box as a stream.
+			 * @since snapshot20261019
+			 */
+			template<typename t>
+			friend std::ostream& operator<<(std::ostream& , const aabb<t>& );
+
+			/** The minimum corner.
+			 * @see max
+			 * @since snapshot20261019
+			 */
+			vec3<T> min;
+
+			/** The maximum corner.
+			 * @see min
+			 * @since snapshot20261019
+			 */
+			vec3<T> max;
+		};
+
+		typedef aabb<float> AABB;
+
+		/**
+		 * A view over many boxes stored as six separate arrays.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API aabbSoA {
+			T* minX;
+			T* minY;
+			T* minZ;
+			T* maxX;
+			T* maxY;
+			T* maxZ;
+			size_t size;
+		};
+
+		// Inline definitions
+		template<typename T>
+		inline bool aabb<T>::isEmpty() const
+		{
+			return min.x > max.x || min.y > max.y || min.z > max.z;
+		}
+
+		template<typename T>
+		inline vec3<T> aabb<T>::center() const
+		{
+			return vec3<T>((min.x + max.x) / 2, (min.y + max.y) / 2, (min.z + max.z) / 2);
+		}
+
+		template<typename T>
+		inline vec3<T> aabb<T>::size() const
+		{
+			return vec3<T>(max.x - min.x, max.y - min.y, max.z - min.z);
+		}
+
+		template<typename T>
+		inline bool aabb<T>::contains(const vec3<T>& p) const
+		{
+			return min <= p && p <= max;
+		}
+
+		template<typename T>
+		inline bool aabb<T>::contains(const aabb<T>& other) const
+		{
+			return min <= other.min && other.max <= max;
+		}
+
+		template<typename T>
+		inline bool aabb<T>::intersects(const aabb<T>& other) const
+		{
+			return min <= other.max && other.min <= max;
+		}
+
+		// Template implementation
+		template<typename T>
+		aabb<T>::aabb()
+			: min(std::numeric_limits<T>::max()), max(std::numeric_limits<T>::lowest())
+		{}
+
+		template<typename T>
+		aabb<T>::aabb(const vec3<T>& min, const vec3<T>& max)
+			: min(min), max(max)
+		{}
+
+		template<typename T>
+		aabb<T>& aabb<T>::expand(const vec3<T>& p)
+		{
+			min.x = p.x < min.x ? p.x : min.x;
+			min.y = p.y < min.y ? p.y : min.y;
+			min.z = p.z < min.z ? p.z : min.z;
+			max.x = p.x > max.x ? p.x : max.x;
+			max.y = p.y > max.y ? p.y : max.y;
+			max.z = p.z > max.z ? p.z : max.z;
+
+			return *this;
+		}
+
+		template<typename T>
+		aabb<T>& aabb<T>::merge(const aabb<T>& other)
+		{
+			min.x = other.min.x < min.x ? other.min.x : min.x;
+			min.y = other.min.y < min.y ? other.min.y : min.y;
+			min.z = other.min.z < min.z ? other.min.z : min.z;
+			max.x = other.max.x > max.x ? other.max.x : max.x;
+			max.y = other.max.y > max.y ? other.max.y : max.y;
+			max.z = other.max.z > max.z ? other.max.z : max.z;
+
+			return *this;
+		}
+
+		template<typename T>
+		aabb<T>& aabb<T>::transform(const mat<T, 4, 4>& m)
+		{
+			*this = transformed(m);
+			return *this;
+		}
+
+		template<typename T>
+		aabb<T> aabb<T>::transformed(const mat<T, 4, 4>& m) const
+		{
+			if(isEmpty())
+				return *this;
+
+			// Arvo's method: each output axis takes, per input axis, the
+			// smaller and bigger contribution of the two corners, which
+			// avoids transforming all eight corners.
+			const T lo[3] = { min.x, min.y, min.z };
+			const T hi[3] = { max.x, max.y, max.z };
+			T outMin[3], outMax[3];
+			for(int row = 0; row < 3; row++)
+			{
+				outMin[row] = outMax[row] = m.matrix[3][row];
+				for(int col = 0; col < 3; col++)
+				{
+					T a = m.matrix[col][row] * lo[col];
+					T b = m.matrix[col][row] * hi[col];
+					outMin[row] += a < b ? a : b;
+					outMax[row] += a < b ? b : a;
+				}
+			}
+
+			return aabb<T>(vec3<T>(outMin[0], outMin[1], outMin[2]),
+				vec3<T>(outMax[0], outMax[1], outMax[2]));
+		}
+
+		template<typename T>
+		bool aabb<T>::intersectsRay(const vec3<T>& origin, const vec3<T>& invDir, T tMin, T tMax, T& tNear) const
+		{
+			T t1 = (min.x - origin.x) * invDir.x;
+			T t2 = (max.x - origin.x) * invDir.x;
+			T lo = t1 < t2 ? t1 : t2;
+			T hi = t1 < t2 ? t2 : t1;
+			tMin = lo > tMin ? lo : tMin;
+			tMax = hi < tMax ? hi : tMax;
+
+			t1 = (min.y - origin.y) * invDir.y;
+			t2 = (max.y - origin.y) * invDir.y;
+			lo = t1 < t2 ? t1 : t2;
+			hi = t1 < t2 ? t2 : t1;
+			tMin = lo > tMin ? lo : tMin;
+			tMax = hi < tMax ? hi : tMax;
+
+			t1 = (min.z - origin.z) * invDir.z;
+			t2 = (max.z - origin.z) * invDir.z;
+			lo = t1 < t2 ? t1 : t2;
+			hi = t1 < t2 ? t2 : t1;
+			tMin = lo > tMin ? lo : tMin;
+			tMax = hi < tMax ? hi : tMax;
+
+			tNear = tMin;
+			return tMin <= tMax;
+		}
+
+		template<typename T>
+		T aabb<T>::surfaceArea() const
+		{
+			if(isEmpty())
+				return 0;
+
+			vec3<T> d = size();
+			return 2 * (d.x * d.y + d.y * d.z + d.z * d.x);
+		}
+
+		template<typename T>
+		std::string aabb<T>::toString() const
+		{
+			return "aabb: (" + min.toString() + ", " + max.toString() + ")";
+		}
+
+		template<typename T>
+		std::ostream& operator<<(std::ostream& stream, const aabb<T>& box)
+		{
+			stream << box.toString();
+			return stream;
+		}
+
+		// Batch kernels
+		/**
+		 * Tests many points against one box.
+		 * @param box The box to test against.
+		 * @param points The points, as a structure of arrays.
+		 * @param result Receives 1 for each point inside the box, 0 otherwise.
+		 * @return The number of points inside the box.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t containsPoints(const aabb<T>& box, const vec3SoA<const T>& points, uint8_t* result)
+		{
+			const T minX = box.min.x, minY = box.min.y, minZ = box.min.z;
+			const T maxX = box.max.x, maxY = box.max.y, maxZ = box.max.z;
+			const T* px = points.x;
+			const T* py = points.y;
+			const T* pz = points.z;
+			size_t count = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				uint8_t in = (px[i] >= minX) & (px[i] <= maxX)
+					& (py[i] >= minY) & (py[i] <= maxY)
+					& (pz[i] >= minZ) & (pz[i] <= maxZ);
+				result[i] = in;
+				count += in;
+			}
+
+			return count;
+		}
+
+		/**
+		 * Tests one ray against many boxes using the slab method.
+		 * @param boxes The boxes, as a structure of arrays.
+		 * @param origin The ray origin.
+		 * @param invDir The component-wise inverse of the ray direction.
+		 * @param tMin The start of the ray interval.
+		 * @param tMax The end of the ray interval.
+		 * @param result Receives 1 for each box hit by the ray, 0 otherwise.
+		 * @param tNear Receives the entry distance for each box. May be <code>nullptr</code>.
+		 * @return The number of boxes hit by the ray.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t intersectRay(const aabbSoA<const T>& boxes, const vec3<T>& origin, const vec3<T>& invDir,
+			T tMin, T tMax, uint8_t* result, T* tNear = nullptr)
+		{
+			const T ox = origin.x, oy = origin.y, oz = origin.z;
+			const T ix = invDir.x, iy = invDir.y, iz = invDir.z;
+			size_t count = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < boxes.size; i++)
+			{
+				T t1 = (boxes.minX[i] - ox) * ix;
+				T t2 = (boxes.maxX[i] - ox) * ix;
+				T lo = t1 < t2 ? t1 : t2;
+				T hi = t1 < t2 ? t2 : t1;
+				T tn = lo > tMin ? lo : tMin;
+				T tf = hi < tMax ? hi : tMax;
+
+				t1 = (boxes.minY[i] - oy) * iy;
+				t2 = (boxes.maxY[i] - oy) * iy;
+				lo = t1 < t2 ? t1 : t2;
+				hi = t1 < t2 ? t2 : t1;
+				tn = lo > tn ? lo : tn;
+				tf = hi < tf ? hi : tf;
+
+				t1 = (boxes.minZ[i] - oz) * iz;
+				t2 = (boxes.maxZ[i] - oz) * iz;
+				lo = t1 < t2 ? t1 : t2;
+				hi = t1 < t2 ? t2 : t1;
+				tn = lo > tn ? lo : tn;
+				tf = hi < tf ? hi : tf;
+
+				uint8_t hit = tn <= tf;
+				result[i] = hit;
+				count += hit;
+				if(tNear != nullptr)
+					tNear[i] = tn;
+			}
+
+			return count;
+		}
+
+		/**
+		 * Tests one box against many boxes for overlap.
+		 * @param box The box to test against.
+		 * @param boxes The boxes, as a structure of arrays.
+		 * @param result Receives 1 for each box overlapping the given one, 0 otherwise.
+		 * @return The number of overlapping boxes.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t intersectBoxes(const aabb<T>& box, const aabbSoA<const T>& boxes, uint8_t* result)
+		{
+			const T minX = box.min.x, minY = box.min.y, minZ = box.min.z;
+			const T maxX = box.max.x, maxY = box.max.y, maxZ = box.max.z;
+			size_t count = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < boxes.size; i++)
+			{
+				uint8_t hit = (boxes.minX[i] <= maxX) & (boxes.maxX[i] >= minX)
+					& (boxes.minY[i] <= maxY) & (boxes.maxY[i] >= minY)
+					& (boxes.minZ[i] <= maxZ) & (boxes.maxZ[i] >= minZ);
+				result[i] = hit;
+				count += hit;
+			}
+
+			return count;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_AABB_H
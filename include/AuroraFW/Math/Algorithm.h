@@ -27,6 +27,16 @@
 #include <AuroraFW/Internal/Config.h>
 
 #ifdef AFW_TARGET_CXX
+#include <AuroraFW/Math/VectorTraits.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
 namespace AuroraFW {
 	namespace Math {
 		/**
@@ -70,6 +80,222 @@ namespace AuroraFW {
 		{
 			return (v > 0) ? v : -v;
 		}
+
+		namespace Internal {
+			constexpr size_t AlgorithmGrain = 1 << 16;
+
+			// Applies f to every component. The values are taken by copy and
+			// the selections are plain ternaries, which compilers turn into
+			// min, max and blend instructions.
+			// The component type of a vector, for the overloads taking a
+			// single scalar bound. Plain scalars already use the V overloads.
+			template<class V>
+			using vectorScalar = typename std::enable_if<!std::is_same<typename elementTraits<V>::scalar, V>::value,
+				typename elementTraits<V>::scalar>::type;
+
+			template<class V, class F>
+			inline V elementMap(V a, F f)
+			{
+				typedef elementTraits<V> traits;
+				for(int d = 0; d < traits::Dimension; d++)
+					traits::set(a, d, f(traits::get(a, d), d));
+				return a;
+			}
+
+			template<class V, class F>
+			inline void elementSpan(const V* in, V* out, size_t count, F f)
+			{
+				parallelFor(count, AlgorithmGrain, [=](size_t begin, size_t end, size_t) {
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+						out[i] = elementMap(in[i], f);
+				});
+			}
+
+			template<bool FromFloat, bool ToFloat>
+			struct saturateCast;
+
+			template<>
+			struct saturateCast<false, false> {
+				template<class To, class From>
+				static To cast(From v)
+				{
+					const To lo = std::numeric_limits<To>::lowest(), hi = std::numeric_limits<To>::max();
+					const bool negative = std::is_signed<From>::value && intmax_t(v) < 0;
+					const bool below = negative && (!std::is_signed<To>::value || intmax_t(v) < intmax_t(lo));
+					const bool above = !negative && uintmax_t(v) > uintmax_t(hi);
+					return below ? lo : above ? hi : To(v);
+				}
+			};
+
+			template<>
+			struct saturateCast<true, false> {
+				template<class To, class From>
+				static To cast(From v)
+				{
+					// Both bounds convert exactly or round up to a power of two,
+					// so the comparisons never let an out of range value through.
+					const To lo = std::numeric_limits<To>::lowest(), hi = std::numeric_limits<To>::max();
+					const From x = std::nearbyint(v);
+					return !(x > From(lo)) ? lo : x >= From(hi) ? hi : To(x);
+				}
+			};
+
+			template<>
+			struct saturateCast<false, true> {
+				template<class To, class From>
+				static To cast(From v) { return To(v); }
+			};
+
+			template<>
+			struct saturateCast<true, true> {
+				template<class To, class From>
+				static To cast(From v)
+				{
+					const From hi = From(std::numeric_limits<To>::max());
+					return To(v > hi ? hi : v < -hi ? -hi : v);
+				}
+			};
+		}
+
+		/**
+		 * Converts a value to another arithmetic type, clamping it to the
+		 * range of the destination type instead of overflowing. Floating
+		 * point values are rounded to the nearest integer and NaN becomes
+		 * the lowest value.
+		 * @return The converted value.
+		 */
+		template<class To, class From>
+		AFW_API inline To saturate(From v)
+		{
+			return Internal::saturateCast<std::is_floating_point<From>::value, std::is_floating_point<To>::value>::template cast<To>(v);
+		}
+
+		/**
+		 *	Stores the smallest of each pair of values of two spans. Vectors
+		 *	are compared component by component. Large spans are split
+		 *	across threads and the output may be one of the inputs.
+		 *	@param a The first values.
+		 *	@param b The second values.
+		 *	@param out Receives the smallest values.
+		 *	@param count The number of values.
+		 */
+		template<class V>
+		AFW_API void min(const V* a, const V* b, V* out, size_t count)
+		{
+			typedef Internal::elementTraits<V> traits;
+			parallelFor(count, Internal::AlgorithmGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					const V y = b[i];
+					out[i] = Internal::elementMap(a[i], [&y](typename traits::scalar x, int d) {
+						const typename traits::scalar w = traits::get(y, d);
+						return w < x ? w : x;
+					});
+				}
+			});
+		}
+
+		/**
+		 *	Stores the biggest of each pair of values of two spans. Vectors
+		 *	are compared component by component. Large spans are split
+		 *	across threads and the output may be one of the inputs.
+		 *	@param a The first values.
+		 *	@param b The second values.
+		 *	@param out Receives the biggest values.
+		 *	@param count The number of values.
+		 */
+		template<class V>
+		AFW_API void max(const V* a, const V* b, V* out, size_t count)
+		{
+			typedef Internal::elementTraits<V> traits;
+			parallelFor(count, Internal::AlgorithmGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					const V y = b[i];
+					out[i] = Internal::elementMap(a[i], [&y](typename traits::scalar x, int d) {
+						const typename traits::scalar w = traits::get(y, d);
+						return x < w ? w : x;
+					});
+				}
+			});
+		}
+
+		/**
+		 *	Clamps every value of a span to the given bounds, component by
+		 *	component for vectors. The output may be the input.
+		 *	@param in The values.
+		 *	@param out Receives the clamped values.
+		 *	@param count The number of values.
+		 *	@param lo The lower bound.
+		 *	@param hi The upper bound.
+		 */
+		template<class V>
+		AFW_API void clamp(const V* in, V* out, size_t count, const V& lo, const V& hi)
+		{
+			typedef Internal::elementTraits<V> traits;
+			const V l = lo, h = hi;
+			Internal::elementSpan(in, out, count, [l, h](typename traits::scalar x, int d) {
+				const typename traits::scalar a = traits::get(l, d), b = traits::get(h, d);
+				x = x < b ? x : b;
+				return x > a ? x : a;
+			});
+		}
+
+		/**
+		 *	Clamps every component of a span of vectors to the same scalar
+		 *	bounds. The output may be the input.
+		 *	@param in The vectors.
+		 *	@param out Receives the clamped vectors.
+		 *	@param count The number of vectors.
+		 *	@param lo The lower bound of every component.
+		 *	@param hi The upper bound of every component.
+		 */
+		template<class V>
+		AFW_API void clamp(const V* in, V* out, size_t count, Internal::vectorScalar<V> lo, Internal::vectorScalar<V> hi)
+		{
+			typedef typename Internal::elementTraits<V>::scalar scalar;
+			Internal::elementSpan(in, out, count, [lo, hi](scalar x, int) {
+				x = x < hi ? x : hi;
+				return x > lo ? x : lo;
+			});
+		}
+
+		/**
+		 *	Stores the absolute value of every value of a span, component by
+		 *	component for vectors. The output may be the input.
+		 *	@param in The values.
+		 *	@param out Receives the absolute values.
+		 *	@param count The number of values.
+		 */
+		template<class V>
+		AFW_API void abs(const V* in, V* out, size_t count)
+		{
+			typedef Internal::elementTraits<V> traits;
+			Internal::elementSpan(in, out, count, [](typename traits::scalar x, int) {
+				return x < 0 ? -x : x;
+			});
+		}
+
+		/**
+		 *	Converts a span to another arithmetic type with saturate(), e.g.
+		 *	float pixels or int32 sums to uint8.
+		 *	@param in The values.
+		 *	@param out Receives the converted values.
+		 *	@param count The number of values.
+		 *	@see saturate()
+		 */
+		template<class To, class From>
+		AFW_API void saturate(const From* in, To* out, size_t count)
+		{
+			parallelFor(count, Internal::AlgorithmGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i] = saturate<To>(in[i]);
+			});
+		}
 	}
 }
 #else
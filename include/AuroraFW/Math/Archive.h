@@ -0,0 +1,867 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Archive.h
+ * Archive header. This contains a versioned binary file format for
+ * large arrays of scalars, vectors and matrices, with a streaming
+ * writer and a memory mapped reader.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_ARCHIVE_H
+#define AURORAFW_MATH_ARCHIVE_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector.h>
+#include <AuroraFW/Math/Matrix.h>
+#include <AuroraFW/Math/Half.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(_WIN32)
+	// Without NOMINMAX, windows.h defines min and max macros that break
+	// std::min, std::max and Math::min and max for every includer.
+	#if !defined(NOMINMAX)
+		#define NOMINMAX
+		#define AFW_MATH_ARCHIVE_NOMINMAX
+	#endif
+	#if !defined(WIN32_LEAN_AND_MEAN)
+		#define WIN32_LEAN_AND_MEAN
+		#define AFW_MATH_ARCHIVE_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+	#if defined(AFW_MATH_ARCHIVE_NOMINMAX)
+		#undef NOMINMAX
+		#undef AFW_MATH_ARCHIVE_NOMINMAX
+	#endif
+	#if defined(AFW_MATH_ARCHIVE_LEAN_AND_MEAN)
+		#undef WIN32_LEAN_AND_MEAN
+		#undef AFW_MATH_ARCHIVE_LEAN_AND_MEAN
+	#endif
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * How the elements of an archive are laid out. AoSLayout stores
+		 * whole elements one after another; SoALayout stores each scalar
+		 * component in its own plane, like the SoA views.
+		 * @since snapshot20261019
+		 */
+		enum ArchiveLayout {
+			AoSLayout = 0,
+			SoALayout = 1
+		};
+
+		/**
+		 * The scalar type of the elements of an archive.
+		 * @since snapshot20261019
+		 */
+		enum ArchiveScalar {
+			ArchiveInvalid = 0,
+			ArchiveFloat32,
+			ArchiveFloat64,
+			ArchiveFloat16,
+			ArchiveBFloat16,
+			ArchiveInt8,
+			ArchiveUInt8,
+			ArchiveInt16,
+			ArchiveUInt16,
+			ArchiveInt32,
+			ArchiveUInt32,
+			ArchiveInt64,
+			ArchiveUInt64
+		};
+
+		/**
+		 * The 64 byte header at the start of every archive. The elements
+		 * start at dataOffset, which is a multiple of alignment; in the SoA
+		 * layout, plane k starts planeStride * k bytes after it. Elements
+		 * are shape[0] x shape[1] scalars: N x 1 for vec<T, N>, m x n for
+		 * mat<T, m, n> and 1 x 1 for plain scalars. Values are in the byte
+		 * order of the writer, and byteOrder tells the reader which one it
+		 * was.
+		 * @since snapshot20261019
+		 */
+		struct AFW_API archiveHeader {
+			char magic[8];
+			uint16_t version;
+			uint16_t headerSize;
+			uint8_t scalar;
+			uint8_t layout;
+			uint8_t shape[2];
+			uint32_t alignment;
+			uint32_t byteOrder;
+			uint64_t count;
+			uint64_t dataOffset;
+			uint64_t planeStride;
+			/** The checksum of every plane, see mappedArchive::verify(). */
+			uint64_t checksum;
+			uint32_t reserved;
+			/** The checksum of the previous 60 bytes. */
+			uint32_t headerChecksum;
+		};
+
+		namespace Internal {
+			struct archiveHasher;
+		}
+
+		/**
+		 * Describes a type that can be stored in an archive: its scalar
+		 * type and shape. Specialized for the arithmetic types, half,
+		 * bfloat16, vec and mat.
+		 * @since snapshot20261019
+		 */
+		template<typename E>
+		struct archiveTraits {
+			typedef E scalar;
+			enum { Scalar = ArchiveInvalid, Rows = 1, Columns = 1 };
+		};
+
+		/**
+		 * Writes an archive front to back, through a fixed-size buffer, so
+		 * arrays larger than memory can be saved chunk by chunk.
+		 *
+		 * The AoS layout can be written without knowing the final count. The
+		 * SoA layout needs the count up front, since every plane has its
+		 * place in the file from the start; each chunk is split into the
+		 * planes as it arrives.
+		 * @tparam E The element type, e.g. vec3<float> or Matrix4x4.
+		 * @since snapshot20261019
+		 */
+		template<typename E>
+		class AFW_API archiveWriter {
+		public:
+			archiveWriter();
+
+			/** Closes the archive if it is still open.
+			 * @see close()
+			 * @since snapshot20261019
+			 */
+			~archiveWriter();
+
+			archiveWriter(const archiveWriter& ) = delete;
+			archiveWriter& operator=(const archiveWriter& ) = delete;
+
+			/** Creates the file and writes a placeholder header.
+			 * @param path The file to create. It is overwritten.
+			 * @param layout How the elements are laid out.
+			 * @param count The number of elements, required for SoALayout.
+			 * @param alignment The alignment of the data and of each plane,
+			 * a power of two.
+			 * @return <code>false</code> if the file could not be created or
+			 * the arguments are invalid.
+			 * @since snapshot20261019
+			 */
+			bool open(const std::string& , ArchiveLayout = AoSLayout, uint64_t = 0, uint32_t = 64);
+
+			/** Appends elements.
+			 * @return <code>false</code> on an I/O error, or when a SoA archive
+			 * would go past its count.
+			 * @since snapshot20261019
+			 */
+			bool write(const E* , size_t );
+
+			/** Writes the final header and closes the file.
+			 * @return <code>false</code> if any write failed, or a SoA archive
+			 * did not receive exactly its count.
+			 * @since snapshot20261019
+			 */
+			bool close();
+
+			/** Returns whether the archive is open.
+			 * @since snapshot20261019
+			 */
+			bool isOpen() const;
+
+			/** Returns the number of elements written so far.
+			 * @since snapshot20261019
+			 */
+			uint64_t count() const;
+
+		private:
+			typedef archiveTraits<E> traits;
+			typedef typename traits::scalar scalar;
+			enum { Components = traits::Rows * traits::Columns };
+
+			std::ofstream m_file;
+			archiveHeader m_header;
+			std::vector<Internal::archiveHasher> m_hashers;
+			std::vector<scalar> m_buffer;
+			uint64_t m_count;
+			bool m_ok;
+		};
+
+		/**
+		 * A read-only archive mapped into memory. Opening only maps the file
+		 * and checks the header, so it takes the same time for any size; the
+		 * pages are read by the OS when the data is first touched. The
+		 * elements are then used in place, without copies.
+		 * @since snapshot20261019
+		 */
+		class AFW_API mappedArchive {
+		public:
+			mappedArchive();
+
+			/** Unmaps the file.
+			 * @since snapshot20261019
+			 */
+			~mappedArchive();
+
+			mappedArchive(const mappedArchive& ) = delete;
+			mappedArchive& operator=(const mappedArchive& ) = delete;
+			mappedArchive(mappedArchive&& );
+			mappedArchive& operator=(mappedArchive&& );
+
+			/** Maps the file and checks its header.
+			 * @return <code>false</code> if the file cannot be mapped, is not
+			 * an archive, is truncated, has a newer version, a different byte
+			 * order or a corrupt header.
+			 * @since snapshot20261019
+			 */
+			bool open(const std::string& );
+
+			/** Unmaps the file.
+			 * @since snapshot20261019
+			 */
+			void close();
+
+			/** Returns whether an archive is mapped.
+			 * @since snapshot20261019
+			 */
+			bool isOpen() const;
+
+			/** Returns the header of the mapped archive, or a zeroed header
+			 * if none is mapped.
+			 * @since snapshot20261019
+			 */
+			const archiveHeader& header() const;
+
+			/** Returns the number of elements.
+			 * @since snapshot20261019
+			 */
+			uint64_t size() const;
+
+			/** Returns the layout of the elements, AoSLayout if no archive
+			 * is mapped.
+			 * @since snapshot20261019
+			 */
+			ArchiveLayout layout() const;
+
+			/** Recomputes the checksum of the data, in parallel, and compares
+			 * it with the header. This reads the whole file.
+			 * @since snapshot20261019
+			 */
+			bool verify() const;
+
+			/** Returns whether the elements have the scalar type and shape of E.
+			 * @since snapshot20261019
+			 */
+			template<typename E>
+			bool holds() const;
+
+			/** Returns the elements of an AoS archive, or <code>nullptr</code>
+			 * if the archive holds another type or uses the SoA layout.
+			 * @see size()
+			 * @since snapshot20261019
+			 */
+			template<typename E>
+			const E* data() const;
+
+			/** Returns a plane of a SoA archive: the component at the given
+			 * index of every element, or <code>nullptr</code> if the scalar
+			 * type does not match, the layout is AoS or the index is too big.
+			 * @since snapshot20261019
+			 */
+			template<typename T>
+			const T* plane(size_t ) const;
+
+			/** Returns the planes of a SoA archive of vec2<T>, or an empty view.
+			 * @since snapshot20261019
+			 */
+			template<typename T>
+			vec2SoA<const T> soa2() const;
+
+			/** Returns the planes of a SoA archive of vec3<T>, or an empty view.
+			 * @since snapshot20261019
+			 */
+			template<typename T>
+			vec3SoA<const T> soa3() const;
+
+			/** Returns the planes of a SoA archive of vec4<T>, or an empty view.
+			 * @since snapshot20261019
+			 */
+			template<typename T>
+			vec4SoA<const T> soa4() const;
+
+		private:
+			const uint8_t* m_data;
+			uint64_t m_size;
+#if defined(_WIN32)
+			HANDLE m_mapping;
+#endif
+		};
+
+		namespace Internal {
+			constexpr uint16_t ArchiveVersion = 1;
+			constexpr uint32_t ArchiveByteOrder = 0x01020304u;
+			constexpr size_t ArchiveHashBlock = size_t(1) << 18;
+			constexpr size_t ArchiveBufferElements = size_t(1) << 16;
+			static const char ArchiveMagic[8] = { 'A', 'F', 'W', 'M', 'A', 'T', 'H', '\x1A' };
+
+			constexpr uint64_t ArchivePrime1 = 0x9E3779B185EBCA87ull;
+			constexpr uint64_t ArchivePrime2 = 0xC2B2AE3D27D4EB4Full;
+			constexpr uint64_t ArchivePrime3 = 0x165667B19E3779F9ull;
+
+			inline uint64_t archiveRotate(uint64_t v, int r)
+			{
+				return (v << r) | (v >> (64 - r));
+			}
+
+			inline uint64_t archiveRead64(const uint8_t* p)
+			{
+				uint64_t v;
+				std::memcpy(&v, p, sizeof(v));
+				return v;
+			}
+
+			inline uint64_t archiveMix(uint64_t h)
+			{
+				h ^= h >> 33;
+				h *= ArchivePrime2;
+				h ^= h >> 29;
+				h *= ArchivePrime3;
+				return h ^ (h >> 32);
+			}
+
+			// Hash of at most one block, with four independent lanes over 32
+			// byte stripes so the multiplies overlap.
+			inline uint64_t archiveHash(const uint8_t* p, size_t n, uint64_t seed)
+			{
+				uint64_t lanes[4] = { seed + ArchivePrime1 + ArchivePrime2, seed + ArchivePrime2, seed, seed - ArchivePrime1 };
+				size_t i = 0;
+				for(; i + 32 <= n; i += 32)
+					for(int l = 0; l < 4; l++)
+						lanes[l] = archiveRotate(lanes[l] + archiveRead64(p + i + 8 * l) * ArchivePrime2, 31) * ArchivePrime1;
+
+				uint64_t h = archiveRotate(lanes[0], 1) + archiveRotate(lanes[1], 7) + archiveRotate(lanes[2], 12) + archiveRotate(lanes[3], 18);
+				for(; i + 8 <= n; i += 8)
+					h = archiveRotate(h ^ (archiveRead64(p + i) * ArchivePrime2), 27) * ArchivePrime1 + ArchivePrime3;
+				for(; i < n; i++)
+					h = archiveRotate(h ^ (p[i] * ArchivePrime1), 11) * ArchivePrime2;
+				return archiveMix(h + n);
+			}
+
+			inline uint64_t archiveCombine(uint64_t state, uint64_t h)
+			{
+				return archiveRotate(state ^ archiveMix(h), 29) * ArchivePrime1 + ArchivePrime3;
+			}
+
+			// The checksum of a plane: every block of ArchiveHashBlock bytes
+			// is hashed on its own, then the block hashes are combined in
+			// order. This lets the reader hash blocks in parallel and the
+			// writer hash them as they stream by.
+			struct archiveHasher {
+				archiveHasher() : state(ArchivePrime3), blocks(0), pending(0) {}
+
+				void update(const uint8_t* p, size_t n)
+				{
+					while(n > 0)
+					{
+						if(pending == 0 && n >= ArchiveHashBlock)
+						{
+							state = archiveCombine(state, archiveHash(p, ArchiveHashBlock, blocks++));
+							p += ArchiveHashBlock;
+							n -= ArchiveHashBlock;
+							continue;
+						}
+
+						if(buffer.empty())
+							buffer.resize(ArchiveHashBlock);
+						const size_t take = std::min(n, ArchiveHashBlock - pending);
+						std::memcpy(buffer.data() + pending, p, take);
+						pending += take;
+						p += take;
+						n -= take;
+						if(pending == ArchiveHashBlock)
+						{
+							state = archiveCombine(state, archiveHash(buffer.data(), pending, blocks++));
+							pending = 0;
+						}
+					}
+				}
+
+				uint64_t finish()
+				{
+					if(pending > 0)
+						state = archiveCombine(state, archiveHash(buffer.data(), pending, blocks++));
+					pending = 0;
+					return archiveMix(state ^ blocks);
+				}
+
+				uint64_t state;
+				uint64_t blocks;
+				size_t pending;
+				std::vector<uint8_t> buffer;
+			};
+
+			inline uint64_t archiveChecksum(const uint64_t* planes, size_t count)
+			{
+				uint64_t h = ArchivePrime2;
+				for(size_t i = 0; i < count; i++)
+					h = archiveCombine(h, planes[i]);
+				return h;
+			}
+
+			inline uint32_t archiveHeaderChecksum(const archiveHeader& header)
+			{
+				const uint64_t h = archiveHash(reinterpret_cast<const uint8_t*>(&header), offsetof(archiveHeader, headerChecksum), 0);
+				return uint32_t(h ^ (h >> 32));
+			}
+
+			inline uint64_t archiveAlign(uint64_t v, uint64_t alignment)
+			{
+				return (v + alignment - 1) / alignment * alignment;
+			}
+
+			inline size_t archiveScalarSize(uint8_t scalar)
+			{
+				switch(scalar)
+				{
+					case ArchiveFloat32: case ArchiveInt32: case ArchiveUInt32: return 4;
+					case ArchiveFloat64: case ArchiveInt64: case ArchiveUInt64: return 8;
+					case ArchiveFloat16: case ArchiveBFloat16: case ArchiveInt16: case ArchiveUInt16: return 2;
+					case ArchiveInt8: case ArchiveUInt8: return 1;
+					default: return 0;
+				}
+			}
+
+			template<typename S, int Code>
+			struct archiveScalarTraits {
+				typedef S scalar;
+				enum { Scalar = Code, Rows = 1, Columns = 1 };
+			};
+		}
+
+		template<> struct archiveTraits<float> : Internal::archiveScalarTraits<float, ArchiveFloat32> {};
+		template<> struct archiveTraits<double> : Internal::archiveScalarTraits<double, ArchiveFloat64> {};
+		template<> struct archiveTraits<half> : Internal::archiveScalarTraits<half, ArchiveFloat16> {};
+		template<> struct archiveTraits<bfloat16> : Internal::archiveScalarTraits<bfloat16, ArchiveBFloat16> {};
+		template<> struct archiveTraits<int8_t> : Internal::archiveScalarTraits<int8_t, ArchiveInt8> {};
+		template<> struct archiveTraits<uint8_t> : Internal::archiveScalarTraits<uint8_t, ArchiveUInt8> {};
+		template<> struct archiveTraits<int16_t> : Internal::archiveScalarTraits<int16_t, ArchiveInt16> {};
+		template<> struct archiveTraits<uint16_t> : Internal::archiveScalarTraits<uint16_t, ArchiveUInt16> {};
+		template<> struct archiveTraits<int32_t> : Internal::archiveScalarTraits<int32_t, ArchiveInt32> {};
+		template<> struct archiveTraits<uint32_t> : Internal::archiveScalarTraits<uint32_t, ArchiveUInt32> {};
+		template<> struct archiveTraits<int64_t> : Internal::archiveScalarTraits<int64_t, ArchiveInt64> {};
+		template<> struct archiveTraits<uint64_t> : Internal::archiveScalarTraits<uint64_t, ArchiveUInt64> {};
+
+		template<typename T, size_t N>
+		struct archiveTraits<vec<T, N>> {
+			static_assert(N < 256, "too many coordinates for an archive");
+			typedef T scalar;
+			enum { Scalar = archiveTraits<T>::Scalar, Rows = N, Columns = 1 };
+		};
+
+		template<typename T, uint m, uint n>
+		struct archiveTraits<mat<T, m, n>> {
+			static_assert(m < 256 && n < 256, "too many rows or columns for an archive");
+			typedef T scalar;
+			enum { Scalar = archiveTraits<T>::Scalar, Rows = m, Columns = n };
+		};
+
+		// Inline definitions
+		template<typename E>
+		inline bool archiveWriter<E>::isOpen() const
+		{
+			return m_file.is_open();
+		}
+
+		template<typename E>
+		inline uint64_t archiveWriter<E>::count() const
+		{
+			return m_count;
+		}
+
+		inline mappedArchive::mappedArchive()
+			: m_data(nullptr), m_size(0)
+#if defined(_WIN32)
+			, m_mapping(nullptr)
+#endif
+		{}
+
+		inline mappedArchive::~mappedArchive()
+		{
+			close();
+		}
+
+		inline mappedArchive::mappedArchive(mappedArchive&& other)
+			: mappedArchive()
+		{
+			*this = std::move(other);
+		}
+
+		inline mappedArchive& mappedArchive::operator=(mappedArchive&& other)
+		{
+			if(this != &other)
+			{
+				close();
+				std::swap(m_data, other.m_data);
+				std::swap(m_size, other.m_size);
+#if defined(_WIN32)
+				std::swap(m_mapping, other.m_mapping);
+#endif
+			}
+			return *this;
+		}
+
+		inline bool mappedArchive::isOpen() const
+		{
+			return m_data != nullptr;
+		}
+
+		inline const archiveHeader& mappedArchive::header() const
+		{
+			static const archiveHeader closed = archiveHeader();
+			return isOpen() ? *reinterpret_cast<const archiveHeader*>(m_data) : closed;
+		}
+
+		inline uint64_t mappedArchive::size() const
+		{
+			return header().count;
+		}
+
+		inline ArchiveLayout mappedArchive::layout() const
+		{
+			return ArchiveLayout(header().layout);
+		}
+
+		inline void mappedArchive::close()
+		{
+			if(m_data == nullptr)
+				return;
+#if defined(_WIN32)
+			UnmapViewOfFile(m_data);
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+#else
+			munmap(const_cast<uint8_t*>(m_data), size_t(m_size));
+#endif
+			m_data = nullptr;
+			m_size = 0;
+		}
+
+		inline bool mappedArchive::open(const std::string& path)
+		{
+			close();
+
+			const uint8_t* data = nullptr;
+			uint64_t size = 0;
+#if defined(_WIN32)
+			HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if(file == INVALID_HANDLE_VALUE)
+				return false;
+			LARGE_INTEGER fileSize;
+			if(GetFileSizeEx(file, &fileSize) && fileSize.QuadPart >= LONGLONG(sizeof(archiveHeader)))
+			{
+				size = uint64_t(fileSize.QuadPart);
+				m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if(m_mapping != nullptr)
+				{
+					data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+					if(data == nullptr)
+					{
+						CloseHandle(m_mapping);
+						m_mapping = nullptr;
+					}
+				}
+			}
+			CloseHandle(file);
+#else
+			const int fd = ::open(path.c_str(), O_RDONLY);
+			if(fd < 0)
+				return false;
+			struct stat info;
+			if(fstat(fd, &info) == 0 && uint64_t(info.st_size) >= sizeof(archiveHeader) && uint64_t(info.st_size) <= uint64_t(SIZE_MAX))
+			{
+				size = uint64_t(info.st_size);
+				void* map = mmap(nullptr, size_t(size), PROT_READ, MAP_SHARED, fd, 0);
+				if(map != MAP_FAILED)
+					data = static_cast<const uint8_t*>(map);
+			}
+			::close(fd);
+#endif
+			if(data == nullptr)
+				return false;
+			m_data = data;
+			m_size = size;
+
+			// Check the header, and that every plane fits in the file.
+			const archiveHeader& h = header();
+			const uint64_t scalarSize = Internal::archiveScalarSize(h.scalar);
+			const uint64_t components = uint64_t(h.shape[0]) * h.shape[1];
+			bool valid = std::memcmp(h.magic, Internal::ArchiveMagic, sizeof(h.magic)) == 0
+				&& h.version >= 1 && h.version <= Internal::ArchiveVersion
+				&& h.headerSize == sizeof(archiveHeader)
+				&& h.byteOrder == Internal::ArchiveByteOrder
+				&& h.headerChecksum == Internal::archiveHeaderChecksum(h)
+				&& scalarSize != 0 && components != 0 && h.layout <= SoALayout
+				&& h.alignment != 0 && (h.alignment & (h.alignment - 1)) == 0
+				&& h.dataOffset >= sizeof(archiveHeader) && h.dataOffset % h.alignment == 0
+				&& h.dataOffset <= size;
+			if(valid)
+			{
+				const uint64_t room = size - h.dataOffset;
+				if(h.layout == AoSLayout)
+					valid = h.count <= room / (scalarSize * components);
+				else
+					valid = h.count <= room / scalarSize
+						&& h.planeStride >= h.count * scalarSize && h.planeStride % h.alignment == 0
+						&& (components == 1 || h.planeStride <= (room - h.count * scalarSize) / (components - 1));
+			}
+			if(!valid)
+				close();
+			return valid;
+		}
+
+		inline bool mappedArchive::verify() const
+		{
+			if(!isOpen())
+				return false;
+
+			const archiveHeader& h = header();
+			const size_t components = size_t(h.shape[0]) * h.shape[1];
+			const size_t scalarSize = Internal::archiveScalarSize(h.scalar);
+			const size_t planes = h.layout == SoALayout ? components : 1;
+			const size_t planeBytes = size_t(h.count) * scalarSize * (h.layout == SoALayout ? 1 : components);
+			const size_t blocks = (planeBytes + Internal::ArchiveHashBlock - 1) / Internal::ArchiveHashBlock;
+
+			std::vector<uint64_t> planeHashes(planes);
+			std::vector<uint64_t> blockHashes(blocks);
+			for(size_t k = 0; k < planes; k++)
+			{
+				const uint8_t* plane = m_data + h.dataOffset + k * h.planeStride;
+				parallelFor(blocks, 1, [&](size_t begin, size_t end, size_t) {
+					for(size_t b = begin; b < end; b++)
+					{
+						const size_t offset = b * Internal::ArchiveHashBlock;
+						blockHashes[b] = Internal::archiveHash(plane + offset, std::min(Internal::ArchiveHashBlock, planeBytes - offset), b);
+					}
+				});
+
+				uint64_t state = Internal::ArchivePrime3;
+				for(size_t b = 0; b < blocks; b++)
+					state = Internal::archiveCombine(state, blockHashes[b]);
+				planeHashes[k] = Internal::archiveMix(state ^ blocks);
+			}
+			return Internal::archiveChecksum(planeHashes.data(), planes) == h.checksum;
+		}
+
+		// Template implementation
+		template<typename E>
+		archiveWriter<E>::archiveWriter()
+			: m_header(), m_count(0), m_ok(false)
+		{}
+
+		template<typename E>
+		archiveWriter<E>::~archiveWriter()
+		{
+			if(isOpen())
+				close();
+		}
+
+		template<typename E>
+		bool archiveWriter<E>::open(const std::string& path, ArchiveLayout layout, uint64_t count, uint32_t alignment)
+		{
+			static_assert(int(traits::Scalar) != int(ArchiveInvalid), "type cannot be stored in an archive");
+			static_assert(sizeof(E) == sizeof(scalar) * Components, "element is not tightly packed");
+
+			if(isOpen())
+				close();
+			if(alignment == 0 || (alignment & (alignment - 1)) != 0 || (layout == SoALayout && count == 0))
+				return false;
+
+			m_file.open(path, std::ios::binary | std::ios::trunc);
+			if(!m_file.is_open())
+				return false;
+
+			std::memset(&m_header, 0, sizeof(m_header));
+			std::memcpy(m_header.magic, Internal::ArchiveMagic, sizeof(m_header.magic));
+			m_header.version = Internal::ArchiveVersion;
+			m_header.headerSize = sizeof(archiveHeader);
+			m_header.scalar = uint8_t(traits::Scalar);
+			m_header.layout = uint8_t(layout);
+			m_header.shape[0] = uint8_t(traits::Rows);
+			m_header.shape[1] = uint8_t(traits::Columns);
+			m_header.alignment = alignment;
+			m_header.byteOrder = Internal::ArchiveByteOrder;
+			m_header.count = count;
+			m_header.dataOffset = Internal::archiveAlign(sizeof(archiveHeader), alignment);
+			m_header.planeStride = layout == SoALayout ? Internal::archiveAlign(count * sizeof(scalar), alignment) : 0;
+
+			m_hashers.assign(layout == SoALayout ? size_t(Components) : size_t(1), Internal::archiveHasher());
+			m_count = 0;
+
+			// A placeholder until close() knows the count and checksum.
+			const std::vector<char> zeros(size_t(m_header.dataOffset), 0);
+			m_file.write(zeros.data(), std::streamsize(zeros.size()));
+			m_ok = bool(m_file);
+			return m_ok;
+		}
+
+		template<typename E>
+		bool archiveWriter<E>::write(const E* elements, size_t count)
+		{
+			if(!isOpen() || !m_ok)
+				return false;
+
+			if(m_header.layout == AoSLayout)
+			{
+				const char* bytes = reinterpret_cast<const char*>(elements);
+				m_file.write(bytes, std::streamsize(count * sizeof(E)));
+				m_hashers[0].update(reinterpret_cast<const uint8_t*>(bytes), count * sizeof(E));
+				m_ok = bool(m_file);
+				m_count += count;
+				return m_ok;
+			}
+
+			if(m_count + count > m_header.count)
+				return m_ok = false;
+
+			// Split the chunk into its planes through the fixed-size buffer.
+			const scalar* in = reinterpret_cast<const scalar*>(elements);
+			m_buffer.resize(Internal::ArchiveBufferElements);
+			for(size_t begin = 0; begin < count && m_ok; begin += Internal::ArchiveBufferElements)
+			{
+				const size_t n = std::min(count - begin, Internal::ArchiveBufferElements);
+				for(size_t k = 0; k < size_t(Components) && m_ok; k++)
+				{
+					for(size_t i = 0; i < n; i++)
+						m_buffer[i] = in[(begin + i) * Components + k];
+					const uint64_t offset = m_header.dataOffset + k * m_header.planeStride + (m_count + begin) * sizeof(scalar);
+					m_file.seekp(std::streamoff(offset));
+					m_file.write(reinterpret_cast<const char*>(m_buffer.data()), std::streamsize(n * sizeof(scalar)));
+					m_hashers[k].update(reinterpret_cast<const uint8_t*>(m_buffer.data()), n * sizeof(scalar));
+					m_ok = bool(m_file);
+				}
+			}
+			m_count += count;
+			return m_ok;
+		}
+
+		template<typename E>
+		bool archiveWriter<E>::close()
+		{
+			if(!isOpen())
+				return false;
+
+			bool ok = m_ok && (m_header.layout == AoSLayout || m_count == m_header.count);
+			if(ok)
+			{
+				std::vector<uint64_t> planes(m_hashers.size());
+				for(size_t k = 0; k < planes.size(); k++)
+					planes[k] = m_hashers[k].finish();
+
+				m_header.count = m_count;
+				m_header.checksum = Internal::archiveChecksum(planes.data(), planes.size());
+				m_header.headerChecksum = Internal::archiveHeaderChecksum(m_header);
+				m_file.seekp(0);
+				m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+				m_file.flush();
+				ok = bool(m_file);
+			}
+			m_file.close();
+			m_hashers.clear();
+			m_buffer.clear();
+			m_buffer.shrink_to_fit();
+			m_ok = false;
+			return ok;
+		}
+
+		template<typename E>
+		bool mappedArchive::holds() const
+		{
+			typedef archiveTraits<E> traits;
+			return isOpen() && header().scalar == uint8_t(traits::Scalar)
+				&& header().shape[0] == uint8_t(traits::Rows) && header().shape[1] == uint8_t(traits::Columns);
+		}
+
+		template<typename E>
+		const E* mappedArchive::data() const
+		{
+			if(!holds<E>() || layout() != AoSLayout)
+				return nullptr;
+			return reinterpret_cast<const E*>(m_data + header().dataOffset);
+		}
+
+		template<typename T>
+		const T* mappedArchive::plane(size_t index) const
+		{
+			if(!isOpen() || header().scalar != uint8_t(archiveTraits<T>::Scalar) || layout() != SoALayout
+				|| index >= size_t(header().shape[0]) * header().shape[1])
+				return nullptr;
+			return reinterpret_cast<const T*>(m_data + header().dataOffset + index * header().planeStride);
+		}
+
+		template<typename T>
+		vec2SoA<const T> mappedArchive::soa2() const
+		{
+			if(!holds<vec<T, 2>>() || layout() != SoALayout)
+				return vec2SoA<const T>{ nullptr, nullptr, 0 };
+			return vec2SoA<const T>{ plane<T>(0), plane<T>(1), size_t(size()) };
+		}
+
+		template<typename T>
+		vec3SoA<const T> mappedArchive::soa3() const
+		{
+			if(!holds<vec<T, 3>>() || layout() != SoALayout)
+				return vec3SoA<const T>{ nullptr, nullptr, nullptr, 0 };
+			return vec3SoA<const T>{ plane<T>(0), plane<T>(1), plane<T>(2), size_t(size()) };
+		}
+
+		template<typename T>
+		vec4SoA<const T> mappedArchive::soa4() const
+		{
+			if(!holds<vec<T, 4>>() || layout() != SoALayout)
+				return vec4SoA<const T>{ nullptr, nullptr, nullptr, nullptr, 0 };
+			return vec4SoA<const T>{ plane<T>(0), plane<T>(1), plane<T>(2), plane<T>(3), size_t(size()) };
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_ARCHIVE_H
@@ -0,0 +1,931 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/BVH.h
+ * Bounding volume hierarchy header. This contains a 4-wide BVH over
+ * triangle meshes, built with binned SAH, with ray, ray packet and
+ * nearest point queries.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_BVH_H
+#define AURORAFW_MATH_BVH_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/AABB.h>
+#include <AuroraFW/Math/Distance.h>
+#include <AuroraFW/Math/Ray.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A struct that stores the closest point of a mesh to a query point.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API nearestHit {
+			/** The closest point on the mesh. */
+			vec3<T> point;
+			/** The squared distance between the query and the closest point. */
+			T distanceSquared;
+			/** The index of the closest triangle, or InvalidPrimitive. */
+			uint32_t primitive;
+		};
+
+		/**
+		 * A 4-wide bounding volume hierarchy over a triangle mesh. Every
+		 * node stores the boxes of its four children as a structure of
+		 * arrays, so one slab test covers all of them.
+		 *
+		 * The hierarchy references the vertex and index arrays given to
+		 * build() and refit(); they must outlive it.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API bvh {
+		public:
+			enum {
+				/** Children per node. */
+				Width = 4,
+				/** Maximum number of triangles in a leaf. */
+				MaxLeafSize = 4,
+				/** Number of SAH bins per axis. */
+				Bins = 16,
+				/** Rays traced together by the batch intersect(). */
+				PacketSize = 8
+			};
+
+			/** The child index of an unused node slot. */
+			static constexpr uint32_t InvalidNode = 0xFFFFFFFFu;
+
+			/**
+			 * A node of the hierarchy. A slot with count 0 is an inner node
+			 * whose child is a node index, unless child is InvalidNode. A slot
+			 * with count > 0 is a leaf whose triangles are primitives()[child]
+			 * to primitives()[child + count - 1].
+			 * @since snapshot20261019
+			 */
+			struct node {
+				T minX[Width], minY[Width], minZ[Width];
+				T maxX[Width], maxY[Width], maxZ[Width];
+				uint32_t child[Width];
+				uint32_t count[Width];
+			};
+
+			/** Constructs an empty hierarchy.
+			 * @since snapshot20261019
+			 */
+			bvh();
+
+			/** Builds the hierarchy over the given triangles, using all
+			 * hardware threads for large meshes.
+			 * @param vertices The mesh vertices.
+			 * @param indices Three vertex indices per triangle, or <code>nullptr</code>
+			 * if every three consecutive vertices form a triangle.
+			 * @param triangleCount The number of triangles.
+			 * @see refit()
+			 * @since snapshot20261019
+			 */
+			void build(const vec3<T>* , const uint32_t* , size_t );
+
+			/** Updates the node boxes after the vertices moved, keeping the
+			 * tree topology. Queries stay correct but slow down as the
+			 * mesh deforms away from the one the tree was built for.
+			 * @param vertices The new vertex positions, indexed as in build().
+			 * @see build()
+			 * @since snapshot20261019
+			 */
+			void refit(const vec3<T>* );
+
+			/** Finds the closest triangle hit by the given ray.
+			 * @param r The ray.
+			 * @param hit Receives the closest hit.
+			 * @return <code>true</code> if any triangle was hit.
+			 * @since snapshot20261019
+			 */
+			bool intersect(const ray<T>& , rayHit<T>& ) const;
+
+			/** Finds the closest hit of many rays, tracing them in packets
+			 * of PacketSize rays across hardware threads.
+			 * @param rays The rays.
+			 * @param hits Receives one hit record per ray.
+			 * @param count The number of rays.
+			 * @since snapshot20261019
+			 */
+			void intersect(const ray<T>* , rayHit<T>* , size_t ) const;
+
+			/** Finds the closest hit of a packet of up to PacketSize rays
+			 * traversing the tree together. Rays should be coherent.
+			 * @param rays The rays.
+			 * @param hits Receives one hit record per ray.
+			 * @param count The number of rays, at most PacketSize.
+			 * @since snapshot20261019
+			 */
+			void intersectPacket(const ray<T>* , rayHit<T>* , size_t ) const;
+
+			/** Returns <code>true</code> if the ray hits any triangle.
+			 * @since snapshot20261019
+			 */
+			bool occluded(const ray<T>& ) const;
+
+			/** Finds the point of the mesh closest to the given point.
+			 * @param p The query point.
+			 * @param maxDistance Triangles further than this are ignored.
+			 * @param hit Receives the closest point.
+			 * @return <code>true</code> if a triangle was found within maxDistance.
+			 * @since snapshot20261019
+			 */
+			bool nearest(const vec3<T>& , T , nearestHit<T>& ) const;
+
+			/** Returns the box enclosing the whole mesh.
+			 * @since snapshot20261019
+			 */
+			aabb<T> bounds() const;
+
+			/** Returns the nodes, root first.
+			 * @since snapshot20261019
+			 */
+			const std::vector<node>& nodes() const;
+
+			/** Returns the triangle indices in leaf order.
+			 * @since snapshot20261019
+			 */
+			const std::vector<uint32_t>& primitives() const;
+
+		private:
+			struct range {
+				size_t begin, end;
+				aabb<T> bounds;
+				aabb<T> centroidBounds;
+				size_t size() const { return end - begin; }
+			};
+
+			enum {
+				/** Traversal stack entries. */
+				StackSize = 256,
+				/** Depth after which nodes are split at the object median. */
+				MedianDepth = 48,
+				/** Triangles above which subtrees are built on their own thread. */
+				ParallelGrain = 1 << 15
+			};
+
+			vec3<T> vertex(uint32_t , int ) const;
+			aabb<T> triangleBounds(uint32_t ) const;
+			range makeRange(size_t , size_t ) const;
+			void split(const range& , int , range& , range& );
+			uint32_t buildNode(const range& , int , int , std::vector<node>& );
+			void setSlot(node& , int , const aabb<T>& , uint32_t , uint32_t ) const;
+			bool intersectLeaf(uint32_t , uint32_t , const ray<T>& , rayHit<T>& , bool ) const;
+			static uint32_t slabTest(const node& , const T* , const T* , T , T , T* );
+
+			const vec3<T>* m_vertices;
+			const uint32_t* m_indices;
+			std::vector<node> m_nodes;
+			std::vector<uint32_t> m_primitives;
+
+			// Build scratch, released once the tree is done.
+			std::vector<aabb<T>> m_primBounds;
+			std::vector<vec3<T>> m_centroids;
+		};
+
+		typedef bvh<float> BVH;
+
+		template<typename T>
+		constexpr uint32_t bvh<T>::InvalidNode;
+
+		// Inline definitions
+		template<typename T>
+		inline const std::vector<typename bvh<T>::node>& bvh<T>::nodes() const
+		{
+			return m_nodes;
+		}
+
+		template<typename T>
+		inline const std::vector<uint32_t>& bvh<T>::primitives() const
+		{
+			return m_primitives;
+		}
+
+		template<typename T>
+		inline vec3<T> bvh<T>::vertex(uint32_t prim, int k) const
+		{
+			size_t i = size_t(prim) * 3 + k;
+			return m_vertices[m_indices != nullptr ? m_indices[i] : i];
+		}
+
+		template<typename T>
+		inline aabb<T> bvh<T>::triangleBounds(uint32_t prim) const
+		{
+			aabb<T> box;
+			box.expand(vertex(prim, 0)).expand(vertex(prim, 1)).expand(vertex(prim, 2));
+			return box;
+		}
+
+		// Template implementation
+		template<typename T>
+		bvh<T>::bvh()
+			: m_vertices(nullptr), m_indices(nullptr)
+		{}
+
+		template<typename T>
+		aabb<T> bvh<T>::bounds() const
+		{
+			aabb<T> box;
+			if(m_nodes.empty())
+				return box;
+
+			const node& root = m_nodes[0];
+			for(int i = 0; i < Width; i++)
+			{
+				if(root.count[i] > 0 || root.child[i] != InvalidNode)
+					box.merge(aabb<T>(vec3<T>(root.minX[i], root.minY[i], root.minZ[i]),
+						vec3<T>(root.maxX[i], root.maxY[i], root.maxZ[i])));
+			}
+
+			return box;
+		}
+
+		template<typename T>
+		void bvh<T>::build(const vec3<T>* vertices, const uint32_t* indices, size_t triangleCount)
+		{
+			m_vertices = vertices;
+			m_indices = indices;
+			m_nodes.clear();
+			m_primitives.resize(triangleCount);
+			if(triangleCount == 0)
+				return;
+
+			m_primBounds.resize(triangleCount);
+			m_centroids.resize(triangleCount);
+			parallelFor(triangleCount, 1 << 14, [this](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					m_primitives[i] = static_cast<uint32_t>(i);
+					m_primBounds[i] = triangleBounds(static_cast<uint32_t>(i));
+					m_centroids[i] = m_primBounds[i].center();
+				}
+			});
+
+			// Subtrees are handed to the thread pool until there is roughly
+			// one per hardware thread; each level of the tree splits in four.
+			int parallelDepth = 0;
+			for(size_t threads = std::thread::hardware_concurrency(); threads > 1; threads /= Width)
+				parallelDepth++;
+
+			// Leaves hold up to MaxLeafSize triangles and every node adds
+			// Width - 1 children to the tree.
+			m_nodes.reserve(triangleCount / (MaxLeafSize * (Width - 1)) + 1);
+			buildNode(makeRange(0, triangleCount), 0, parallelDepth, m_nodes);
+
+			std::vector<aabb<T>>().swap(m_primBounds);
+			std::vector<vec3<T>>().swap(m_centroids);
+		}
+
+		template<typename T>
+		typename bvh<T>::range bvh<T>::makeRange(size_t begin, size_t end) const
+		{
+			range r;
+			r.begin = begin;
+			r.end = end;
+			for(size_t i = begin; i < end; i++)
+			{
+				r.bounds.merge(m_primBounds[m_primitives[i]]);
+				r.centroidBounds.expand(m_centroids[m_primitives[i]]);
+			}
+			return r;
+		}
+
+		template<typename T>
+		void bvh<T>::split(const range& r, int depth, range& left, range& right)
+		{
+			struct bin {
+				aabb<T> bounds;
+				size_t count = 0;
+			};
+
+			const vec3<T> cmin = r.centroidBounds.min;
+			const vec3<T> extent = r.centroidBounds.size();
+			const T ext[3] = { extent.x, extent.y, extent.z };
+			const T lo[3] = { cmin.x, cmin.y, cmin.z };
+			uint32_t* prims = m_primitives.data();
+
+			int axis = 0;
+			if(ext[1] > ext[axis]) axis = 1;
+			if(ext[2] > ext[axis]) axis = 2;
+
+			size_t mid = r.begin + r.size() / 2;
+			bool useMedian = depth >= MedianDepth || ext[axis] <= 0;
+
+			if(!useMedian)
+			{
+				// Bin the centroids on all three axes, then sweep the bins
+				// to find the plane with the lowest surface area cost.
+				T scale[3];
+				for(int a = 0; a < 3; a++)
+					scale[a] = ext[a] > 0 ? T(Bins) * (1 - std::numeric_limits<T>::epsilon()) / ext[a] : 0;
+
+				const size_t chunks = r.size() >= (1 << 18) ? parallelChunkCount(r.size(), 1 << 16) : 1;
+				std::vector<bin> chunkBins(chunks * 3 * Bins);
+				auto binRange = [&](size_t begin, size_t end, size_t chunk) {
+					bin* bins = chunkBins.data() + chunk * 3 * Bins;
+					for(size_t i = begin; i < end; i++)
+					{
+						const uint32_t prim = prims[r.begin + i];
+						const vec3<T>& c = m_centroids[prim];
+						const T cc[3] = { c.x, c.y, c.z };
+						for(int a = 0; a < 3; a++)
+						{
+							int b = static_cast<int>((cc[a] - lo[a]) * scale[a]);
+							b = b < Bins ? b : Bins - 1;
+							bins[a * Bins + b].bounds.merge(m_primBounds[prim]);
+							bins[a * Bins + b].count++;
+						}
+					}
+				};
+				if(chunks > 1)
+					parallelFor(r.size(), 1 << 16, binRange);
+				else
+					binRange(0, r.size(), 0);
+
+				bin bins[3 * Bins];
+				for(size_t chunk = 0; chunk < chunks; chunk++)
+				{
+					for(int i = 0; i < 3 * Bins; i++)
+					{
+						bins[i].bounds.merge(chunkBins[chunk * 3 * Bins + i].bounds);
+						bins[i].count += chunkBins[chunk * 3 * Bins + i].count;
+					}
+				}
+
+				T bestCost = std::numeric_limits<T>::max();
+				int bestAxis = -1, bestSplit = 0;
+				for(int a = 0; a < 3; a++)
+				{
+					if(ext[a] <= 0)
+						continue;
+
+					T rightCost[Bins];
+					aabb<T> acc;
+					size_t n = 0;
+					for(int i = Bins - 1; i > 0; i--)
+					{
+						acc.merge(bins[a * Bins + i].bounds);
+						n += bins[a * Bins + i].count;
+						rightCost[i] = acc.surfaceArea() * T(n);
+					}
+
+					acc = aabb<T>();
+					n = 0;
+					for(int i = 0; i < Bins - 1; i++)
+					{
+						acc.merge(bins[a * Bins + i].bounds);
+						n += bins[a * Bins + i].count;
+						T cost = acc.surfaceArea() * T(n) + rightCost[i + 1];
+						if(n > 0 && n < r.size() && cost < bestCost)
+						{
+							bestCost = cost;
+							bestAxis = a;
+							bestSplit = i;
+						}
+					}
+				}
+
+				if(bestAxis >= 0)
+				{
+					const T l = lo[bestAxis], s = scale[bestAxis];
+					const vec3<T>* centroids = m_centroids.data();
+					uint32_t* pivot = std::partition(prims + r.begin, prims + r.end, [=](uint32_t prim) {
+						const vec3<T>& c = centroids[prim];
+						const T v = bestAxis == 0 ? c.x : bestAxis == 1 ? c.y : c.z;
+						return static_cast<int>((v - l) * s) <= bestSplit;
+					});
+					mid = static_cast<size_t>(pivot - prims);
+				}
+
+				useMedian = mid == r.begin || mid == r.end;
+			}
+
+			if(useMedian)
+			{
+				mid = r.begin + r.size() / 2;
+				if(ext[axis] > 0)
+				{
+					const vec3<T>* centroids = m_centroids.data();
+					std::nth_element(prims + r.begin, prims + mid, prims + r.end, [=](uint32_t a, uint32_t b) {
+						const vec3<T>& ca = centroids[a];
+						const vec3<T>& cb = centroids[b];
+						return axis == 0 ? ca.x < cb.x : axis == 1 ? ca.y < cb.y : ca.z < cb.z;
+					});
+				}
+			}
+
+			left = makeRange(r.begin, mid);
+			right = makeRange(mid, r.end);
+		}
+
+		template<typename T>
+		void bvh<T>::setSlot(node& n, int slot, const aabb<T>& box, uint32_t child, uint32_t count) const
+		{
+			n.minX[slot] = box.min.x;
+			n.minY[slot] = box.min.y;
+			n.minZ[slot] = box.min.z;
+			n.maxX[slot] = box.max.x;
+			n.maxY[slot] = box.max.y;
+			n.maxZ[slot] = box.max.z;
+			n.child[slot] = child;
+			n.count[slot] = count;
+		}
+
+		template<typename T>
+		uint32_t bvh<T>::buildNode(const range& r, int depth, int parallelDepth, std::vector<node>& out)
+		{
+			const uint32_t index = static_cast<uint32_t>(out.size());
+			out.emplace_back();
+
+			// Split the child with the biggest area until there are four
+			// children or all of them are small enough to be leaves.
+			range children[Width];
+			int count = 1;
+			children[0] = r;
+			while(count < Width)
+			{
+				int best = -1;
+				T bestArea = -1;
+				for(int i = 0; i < count; i++)
+				{
+					if(children[i].size() > MaxLeafSize && children[i].bounds.surfaceArea() > bestArea)
+					{
+						best = i;
+						bestArea = children[i].bounds.surfaceArea();
+					}
+				}
+				if(best < 0)
+					break;
+
+				range left, right;
+				split(children[best], depth, left, right);
+				children[best] = left;
+				children[count++] = right;
+			}
+
+			uint32_t childIndex[Width];
+			std::vector<node> subtrees[Width];
+			int parallelChildren[Width];
+			int parallelCount = 0;
+			for(int i = 0; i < count; i++)
+			{
+				if(children[i].size() <= MaxLeafSize)
+					continue;
+
+				if(depth < parallelDepth && children[i].size() >= ParallelGrain)
+				{
+					parallelChildren[parallelCount++] = i;
+					childIndex[i] = InvalidNode;
+				}
+				else
+				{
+					childIndex[i] = buildNode(children[i], depth + 1, parallelDepth, out);
+				}
+			}
+
+			// Each big child builds into its own vector, spliced in below.
+			// parallelFor() nests, so deeper levels share the same pool.
+			parallelFor(size_t(parallelCount), 1, [&](size_t begin, size_t end, size_t) {
+				for(size_t j = begin; j < end; j++)
+				{
+					const int i = parallelChildren[j];
+					buildNode(children[i], depth + 1, parallelDepth, subtrees[i]);
+				}
+			});
+
+			for(int i = 0; i < count; i++)
+			{
+				if(subtrees[i].empty())
+					continue;
+
+				const uint32_t offset = static_cast<uint32_t>(out.size());
+				for(node& n : subtrees[i])
+				{
+					for(int slot = 0; slot < Width; slot++)
+					{
+						if(n.count[slot] == 0 && n.child[slot] != InvalidNode)
+							n.child[slot] += offset;
+					}
+				}
+				out.insert(out.end(), subtrees[i].begin(), subtrees[i].end());
+				childIndex[i] = offset;
+			}
+
+			node& n = out[index];
+			for(int i = 0; i < Width; i++)
+			{
+				if(i >= count)
+					setSlot(n, i, aabb<T>(), InvalidNode, 0);
+				else if(children[i].size() <= MaxLeafSize)
+					setSlot(n, i, children[i].bounds, static_cast<uint32_t>(children[i].begin),
+						static_cast<uint32_t>(children[i].size()));
+				else
+					setSlot(n, i, children[i].bounds, childIndex[i], 0);
+			}
+
+			return index;
+		}
+
+		template<typename T>
+		void bvh<T>::refit(const vec3<T>* vertices)
+		{
+			m_vertices = vertices;
+
+			// Leaves first, in parallel, then inner slots from the last node
+			// to the root: children always come after their parent.
+			parallelFor(m_nodes.size(), 1 << 12, [this](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					node& n = m_nodes[i];
+					for(int slot = 0; slot < Width; slot++)
+					{
+						if(n.count[slot] == 0)
+							continue;
+
+						aabb<T> box;
+						for(uint32_t p = 0; p < n.count[slot]; p++)
+						{
+							const uint32_t prim = m_primitives[n.child[slot] + p];
+							box.expand(vertex(prim, 0)).expand(vertex(prim, 1)).expand(vertex(prim, 2));
+						}
+						setSlot(n, slot, box, n.child[slot], n.count[slot]);
+					}
+				}
+			});
+
+			for(size_t i = m_nodes.size(); i-- > 0; )
+			{
+				node& n = m_nodes[i];
+				for(int slot = 0; slot < Width; slot++)
+				{
+					if(n.count[slot] != 0 || n.child[slot] == InvalidNode)
+						continue;
+
+					const node& c = m_nodes[n.child[slot]];
+					aabb<T> box;
+					for(int k = 0; k < Width; k++)
+					{
+						if(c.count[k] != 0 || c.child[k] != InvalidNode)
+							box.merge(aabb<T>(vec3<T>(c.minX[k], c.minY[k], c.minZ[k]),
+								vec3<T>(c.maxX[k], c.maxY[k], c.maxZ[k])));
+					}
+					setSlot(n, slot, box, n.child[slot], 0);
+				}
+			}
+		}
+
+		template<typename T>
+		uint32_t bvh<T>::slabTest(const node& n, const T* origin, const T* invDir, T tMin, T tMax, T* tNear)
+		{
+			uint32_t mask = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(int i = 0; i < Width; i++)
+			{
+				T t1 = (n.minX[i] - origin[0]) * invDir[0];
+				T t2 = (n.maxX[i] - origin[0]) * invDir[0];
+				T tn = std::max(std::min(t1, t2), tMin);
+				T tf = std::min(std::max(t1, t2), tMax);
+
+				t1 = (n.minY[i] - origin[1]) * invDir[1];
+				t2 = (n.maxY[i] - origin[1]) * invDir[1];
+				tn = std::max(std::min(t1, t2), tn);
+				tf = std::min(std::max(t1, t2), tf);
+
+				t1 = (n.minZ[i] - origin[2]) * invDir[2];
+				t2 = (n.maxZ[i] - origin[2]) * invDir[2];
+				tn = std::max(std::min(t1, t2), tn);
+				tf = std::min(std::max(t1, t2), tf);
+
+				tNear[i] = tn;
+				mask |= uint32_t(tn <= tf && (n.count[i] != 0 || n.child[i] != InvalidNode)) << i;
+			}
+
+			return mask;
+		}
+
+		template<typename T>
+		bool bvh<T>::intersectLeaf(uint32_t first, uint32_t count, const ray<T>& r, rayHit<T>& hit, bool any) const
+		{
+			bool found = false;
+			ray<T> clipped = r;
+			clipped.tMax = hit.t < r.tMax ? hit.t : r.tMax;
+			for(uint32_t i = first; i < first + count; i++)
+			{
+				const uint32_t prim = m_primitives[i];
+				T t, u, v;
+				if(intersectTriangle(clipped, vertex(prim, 0), vertex(prim, 1), vertex(prim, 2), t, u, v))
+				{
+					hit.t = clipped.tMax = t;
+					hit.u = u;
+					hit.v = v;
+					hit.primitive = prim;
+					found = true;
+					if(any)
+						break;
+				}
+			}
+			return found;
+		}
+
+		template<typename T>
+		bool bvh<T>::intersect(const ray<T>& r, rayHit<T>& hit) const
+		{
+			hit = rayHit<T>();
+			if(m_nodes.empty())
+				return false;
+
+			const vec3<T> inv = r.inverseDirection();
+			const T origin[3] = { r.origin.x, r.origin.y, r.origin.z };
+			const T invDir[3] = { inv.x, inv.y, inv.z };
+
+			struct entry {
+				uint32_t node;
+				T t;
+			};
+			entry stack[StackSize];
+			int sp = 0;
+			stack[sp++] = { 0, r.tMin };
+
+			while(sp > 0)
+			{
+				const entry e = stack[--sp];
+				if(e.t > hit.t)
+					continue;
+
+				const node& n = m_nodes[e.node];
+				T tNear[Width];
+				uint32_t mask = slabTest(n, origin, invDir, r.tMin, hit.t < r.tMax ? hit.t : r.tMax, tNear);
+
+				entry inner[Width];
+				int innerCount = 0;
+				for(int i = 0; i < Width; i++)
+				{
+					if(!(mask & (1u << i)))
+						continue;
+
+					if(n.count[i] > 0)
+						intersectLeaf(n.child[i], n.count[i], r, hit, false);
+					else
+						inner[innerCount++] = { n.child[i], tNear[i] };
+				}
+
+				// Push the furthest child first so the nearest is visited next.
+				for(int i = 1; i < innerCount; i++)
+				{
+					entry key = inner[i];
+					int j = i - 1;
+					for(; j >= 0 && inner[j].t < key.t; j--)
+						inner[j + 1] = inner[j];
+					inner[j + 1] = key;
+				}
+				for(int i = 0; i < innerCount; i++)
+					stack[sp++] = inner[i];
+			}
+
+			return hit.valid();
+		}
+
+		template<typename T>
+		bool bvh<T>::occluded(const ray<T>& r) const
+		{
+			if(m_nodes.empty())
+				return false;
+
+			const vec3<T> inv = r.inverseDirection();
+			const T origin[3] = { r.origin.x, r.origin.y, r.origin.z };
+			const T invDir[3] = { inv.x, inv.y, inv.z };
+
+			uint32_t stack[StackSize];
+			int sp = 0;
+			stack[sp++] = 0;
+
+			while(sp > 0)
+			{
+				const node& n = m_nodes[stack[--sp]];
+				T tNear[Width];
+				uint32_t mask = slabTest(n, origin, invDir, r.tMin, r.tMax, tNear);
+				for(int i = 0; i < Width; i++)
+				{
+					if(!(mask & (1u << i)))
+						continue;
+
+					if(n.count[i] == 0)
+					{
+						stack[sp++] = n.child[i];
+						continue;
+					}
+
+					rayHit<T> hit;
+					if(intersectLeaf(n.child[i], n.count[i], r, hit, true))
+						return true;
+				}
+			}
+
+			return false;
+		}
+
+		template<typename T>
+		void bvh<T>::intersectPacket(const ray<T>* rays, rayHit<T>* hits, size_t count) const
+		{
+			for(size_t k = 0; k < count; k++)
+				hits[k] = rayHit<T>();
+			if(m_nodes.empty() || count == 0)
+				return;
+
+			T ox[PacketSize], oy[PacketSize], oz[PacketSize];
+			T ix[PacketSize], iy[PacketSize], iz[PacketSize];
+			T tMin[PacketSize], tMax[PacketSize];
+			for(size_t k = 0; k < count; k++)
+			{
+				const vec3<T> inv = rays[k].inverseDirection();
+				ox[k] = rays[k].origin.x;
+				oy[k] = rays[k].origin.y;
+				oz[k] = rays[k].origin.z;
+				ix[k] = inv.x;
+				iy[k] = inv.y;
+				iz[k] = inv.z;
+				tMin[k] = rays[k].tMin;
+				tMax[k] = rays[k].tMax;
+			}
+
+			uint32_t stack[StackSize];
+			int sp = 0;
+			stack[sp++] = 0;
+
+			while(sp > 0)
+			{
+				const node& n = m_nodes[stack[--sp]];
+				for(int i = 0; i < Width; i++)
+				{
+					if(n.count[i] == 0 && n.child[i] == InvalidNode)
+						continue;
+
+					// A child is visited if any ray of the packet hits its box.
+					uint32_t active = 0;
+					for(size_t k = 0; k < count; k++)
+					{
+						T t1 = (n.minX[i] - ox[k]) * ix[k];
+						T t2 = (n.maxX[i] - ox[k]) * ix[k];
+						T tn = std::max(std::min(t1, t2), tMin[k]);
+						T tf = std::min(std::max(t1, t2), tMax[k]);
+
+						t1 = (n.minY[i] - oy[k]) * iy[k];
+						t2 = (n.maxY[i] - oy[k]) * iy[k];
+						tn = std::max(std::min(t1, t2), tn);
+						tf = std::min(std::max(t1, t2), tf);
+
+						t1 = (n.minZ[i] - oz[k]) * iz[k];
+						t2 = (n.maxZ[i] - oz[k]) * iz[k];
+						tn = std::max(std::min(t1, t2), tn);
+						tf = std::min(std::max(t1, t2), tf);
+
+						active |= uint32_t(tn <= tf) << k;
+					}
+
+					if(active == 0)
+						continue;
+
+					if(n.count[i] == 0)
+					{
+						stack[sp++] = n.child[i];
+						continue;
+					}
+
+					for(size_t k = 0; k < count; k++)
+					{
+						if((active & (1u << k)) && intersectLeaf(n.child[i], n.count[i], rays[k], hits[k], false))
+							tMax[k] = hits[k].t;
+					}
+				}
+			}
+		}
+
+		template<typename T>
+		void bvh<T>::intersect(const ray<T>* rays, rayHit<T>* hits, size_t count) const
+		{
+			const size_t packets = (count + PacketSize - 1) / PacketSize;
+			parallelFor(packets, 64, [=](size_t begin, size_t end, size_t) {
+				for(size_t p = begin; p < end; p++)
+				{
+					const size_t first = p * PacketSize;
+					const size_t n = count - first < size_t(PacketSize) ? count - first : size_t(PacketSize);
+					intersectPacket(rays + first, hits + first, n);
+				}
+			});
+		}
+
+		template<typename T>
+		bool bvh<T>::nearest(const vec3<T>& p, T maxDistance, nearestHit<T>& hit) const
+		{
+			hit.primitive = InvalidPrimitive;
+			hit.distanceSquared = maxDistance * maxDistance;
+			if(m_nodes.empty())
+				return false;
+
+			struct entry {
+				uint32_t node;
+				T d;
+			};
+			entry stack[StackSize];
+			int sp = 0;
+			stack[sp++] = { 0, 0 };
+
+			while(sp > 0)
+			{
+				const entry e = stack[--sp];
+				if(e.d > hit.distanceSquared)
+					continue;
+
+				const node& n = m_nodes[e.node];
+				T dist[Width];
+
+				AFW_MATH_SIMD_LOOP
+				for(int i = 0; i < Width; i++)
+				{
+					T dx = std::max(std::max(n.minX[i] - p.x, p.x - n.maxX[i]), T(0));
+					T dy = std::max(std::max(n.minY[i] - p.y, p.y - n.maxY[i]), T(0));
+					T dz = std::max(std::max(n.minZ[i] - p.z, p.z - n.maxZ[i]), T(0));
+					dist[i] = dx * dx + dy * dy + dz * dz;
+				}
+
+				entry inner[Width];
+				int innerCount = 0;
+				for(int i = 0; i < Width; i++)
+				{
+					if((n.count[i] == 0 && n.child[i] == InvalidNode) || dist[i] > hit.distanceSquared)
+						continue;
+
+					if(n.count[i] == 0)
+					{
+						inner[innerCount++] = { n.child[i], dist[i] };
+						continue;
+					}
+
+					for(uint32_t k = n.child[i]; k < n.child[i] + n.count[i]; k++)
+					{
+						const uint32_t prim = m_primitives[k];
+						const vec3<T> c = closestPointOnTriangle(p, vertex(prim, 0), vertex(prim, 1), vertex(prim, 2));
+						const T d = (c.x - p.x) * (c.x - p.x) + (c.y - p.y) * (c.y - p.y) + (c.z - p.z) * (c.z - p.z);
+						if(d <= hit.distanceSquared)
+						{
+							hit.point = c;
+							hit.distanceSquared = d;
+							hit.primitive = prim;
+						}
+					}
+				}
+
+				for(int i = 1; i < innerCount; i++)
+				{
+					entry key = inner[i];
+					int j = i - 1;
+					for(; j >= 0 && inner[j].d < key.d; j--)
+						inner[j + 1] = inner[j];
+					inner[j + 1] = key;
+				}
+				for(int i = 0; i < innerCount; i++)
+					stack[sp++] = inner[i];
+			}
+
+			return hit.primitive != InvalidPrimitive;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_BVH_H
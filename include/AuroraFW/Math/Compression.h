@@ -0,0 +1,757 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Compression.h
+ * Compression header. This contains a block based codec for streams of
+ * vec3<float>, lossless or with a bounded error, with streaming and
+ * parallel entry points.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_COMPRESSION_H
+#define AURORAFW_MATH_COMPRESSION_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSSE3__)
+	#include <immintrin.h>
+#endif
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * The number of vectors in a full block. Every block decodes on its
+		 * own, so this is also the granularity of random access and of
+		 * parallel decoding.
+		 * @since snapshot20261019
+		 */
+		constexpr size_t CompressionBlockSize = 4096;
+
+		/**
+		 * The size of a block header, in bytes.
+		 * @since snapshot20261019
+		 */
+		constexpr size_t CompressionHeaderSize = 16;
+
+		/**
+		 * A block found in a compressed stream.
+		 * @see compressedBlocks()
+		 * @since snapshot20261019
+		 */
+		struct AFW_API compressedBlock {
+			/** The offset of the block in the stream, in bytes. */
+			size_t offset;
+			/** The size of the block, header included, in bytes. */
+			size_t size;
+			/** The index of the first vector of the block in the stream. */
+			size_t first;
+			/** The number of vectors in the block. */
+			size_t count;
+		};
+
+		/**
+		 * Returns the largest size encodeBlock() can produce for the given
+		 * number of vectors.
+		 * @since snapshot20261019
+		 */
+		constexpr size_t compressedBlockBound(size_t count)
+		{
+			return CompressionHeaderSize + count * 3 * sizeof(float);
+		}
+
+		/**
+		 * Encodes up to CompressionBlockSize vectors as one block.
+		 *
+		 * Each coordinate is coded separately. Losslessly, every float is
+		 * XORed with the previous one, as in Gorilla, so slowly changing
+		 * values leave mostly zero high bytes. With a maximum error, values
+		 * are quantized to multiples of twice that error, and the residual of
+		 * a first or second order predictor (whichever is smaller for the
+		 * block) is kept instead. Either way the words are split into byte
+		 * planes and zero bytes are dropped, eight at a time, with a bit mask.
+		 * Blocks that would not shrink are stored raw. A block that cannot
+		 * honor the error bound (values too large, or not finite) falls back
+		 * to lossless coding.
+		 * @param in The vectors.
+		 * @param count The number of vectors, at most CompressionBlockSize.
+		 * @param out Receives the block. Needs compressedBlockBound(count) bytes.
+		 * @param maxError The largest error allowed on each coordinate, or 0
+		 * for lossless coding.
+		 * @return The size of the block, in bytes.
+		 * @since snapshot20261019
+		 */
+		size_t encodeBlock(const vec3<float>* , size_t , uint8_t* , float = 0);
+
+		/**
+		 * Decodes one block.
+		 * @param in The block.
+		 * @param size The number of bytes available at in; the block may be
+		 * followed by others.
+		 * @param out Receives the vectors. Needs room for CompressionBlockSize.
+		 * @return The number of vectors, or 0 if the block is corrupt or
+		 * truncated.
+		 * @since snapshot20261019
+		 */
+		size_t decodeBlock(const uint8_t* , size_t , vec3<float>* );
+
+		/**
+		 * Lists the blocks of a compressed stream, reading only the headers.
+		 * @return <code>false</code> if the stream is corrupt or truncated.
+		 * @since snapshot20261019
+		 */
+		bool compressedBlocks(const uint8_t* , size_t , std::vector<compressedBlock>& );
+
+		/**
+		 * Compresses vectors into a stream of blocks, in parallel.
+		 * @param in The vectors.
+		 * @param count The number of vectors.
+		 * @param out Receives the stream. It is replaced.
+		 * @param maxError The largest error allowed on each coordinate, or 0
+		 * for lossless coding.
+		 * @see encodeBlock()
+		 * @since snapshot20261019
+		 */
+		void compress(const vec3<float>* , size_t , std::vector<uint8_t>& , float = 0);
+
+		/**
+		 * Decompresses a stream of blocks, in parallel.
+		 * @param in The stream.
+		 * @param size The size of the stream, in bytes.
+		 * @param out Receives the vectors. It is replaced.
+		 * @return <code>false</code> if the stream is corrupt or truncated.
+		 * @since snapshot20261019
+		 */
+		bool decompress(const uint8_t* , size_t , std::vector<vec3<float>>& );
+
+		namespace Internal {
+			// The words and byte planes of one block. Callers that code many
+			// blocks keep one, so blocks do not allocate.
+			struct compressionScratch {
+				std::vector<uint32_t> words;
+				std::vector<uint8_t> planes;
+			};
+
+			size_t compressionEncode(const vec3<float>* , size_t , uint8_t* , float , compressionScratch& );
+			size_t compressionDecode(const uint8_t* , size_t , vec3<float>* , compressionScratch& );
+		}
+
+		/**
+		 * Encodes a stream of vectors as it arrives, through one block of
+		 * buffering, handing every finished block to a sink.
+		 * @since snapshot20261019
+		 */
+		class AFW_API vec3Encoder {
+		public:
+			/** Constructs an encoder.
+			 * @param maxError The largest error allowed on each coordinate, or 0
+			 * for lossless coding.
+			 * @since snapshot20261019
+			 */
+			explicit vec3Encoder(float = 0);
+
+			/** Adds vectors to the stream.
+			 * @param sink Called as sink(const uint8_t* block, size_t size)
+			 * for each full block.
+			 * @since snapshot20261019
+			 */
+			template<typename Sink>
+			void write(const vec3<float>* , size_t , Sink&& );
+
+			/** Encodes the buffered vectors as a last, shorter, block.
+			 * @since snapshot20261019
+			 */
+			template<typename Sink>
+			void flush(Sink&& );
+
+		private:
+			float m_maxError;
+			std::vector<vec3<float>> m_pending;
+			std::vector<uint8_t> m_block;
+			Internal::compressionScratch m_scratch;
+		};
+
+		/**
+		 * Decodes a compressed stream as its bytes arrive, in pieces of any
+		 * size, handing the vectors of every block to a sink. At most one
+		 * block is buffered.
+		 * @since snapshot20261019
+		 */
+		class AFW_API vec3Decoder {
+		public:
+			vec3Decoder();
+
+			/** Adds bytes of the stream.
+			 * @param sink Called as sink(const vec3<float>* values, size_t count)
+			 * for each decoded block.
+			 * @return <code>false</code> if a corrupt block was found. The
+			 * decoder then stays in error.
+			 * @since snapshot20261019
+			 */
+			template<typename Sink>
+			bool write(const uint8_t* , size_t , Sink&& );
+
+			/** Returns whether the bytes so far end on a block boundary.
+			 * @since snapshot20261019
+			 */
+			bool finished() const;
+
+		private:
+			std::vector<uint8_t> m_pending;
+			std::vector<vec3<float>> m_values;
+			Internal::compressionScratch m_scratch;
+			bool m_ok;
+		};
+
+		namespace Internal {
+			enum CompressionMethod {
+				RawMethod = 0,
+				XorMethod = 1,
+				QuantizedMethod = 2
+			};
+
+			// Masks of which of eight bytes are not zero, and the shuffles
+			// that pack those bytes together or spread them back out.
+			struct compressionTables {
+				uint8_t pack[256][8];
+				uint8_t unpack[256][8];
+				uint8_t count[256];
+			};
+
+			inline const compressionTables& compressionTable()
+			{
+				static const compressionTables tables = []() {
+					compressionTables t;
+					for(int mask = 0; mask < 256; mask++)
+					{
+						int k = 0;
+						for(int j = 0; j < 8; j++)
+						{
+							t.unpack[mask][j] = 0x80;
+							t.pack[mask][j] = 0x80;
+						}
+						for(int j = 0; j < 8; j++)
+							if(mask & (1 << j))
+							{
+								t.pack[mask][k] = uint8_t(j);
+								t.unpack[mask][j] = uint8_t(k);
+								k++;
+							}
+						t.count[mask] = uint8_t(k);
+					}
+					return t;
+				}();
+				return tables;
+			}
+
+			// Drops the zero bytes of n bytes (a multiple of 8), writing a mask
+			// and the remaining bytes per group. Gives up, returning 0, as
+			// soon as the output would reach limit bytes.
+			inline size_t compressionPack(const uint8_t* in, size_t n, uint8_t* out, size_t limit)
+			{
+				const compressionTables& t = compressionTable();
+				size_t k = 0;
+				for(size_t i = 0; i < n; i += 8)
+				{
+					if(k + 9 > limit)
+						return 0;
+#if defined(__SSSE3__)
+					const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + i));
+					const int mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128())) & 0xFF;
+					const __m128i shuffle = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(t.pack[mask]));
+					_mm_storel_epi64(reinterpret_cast<__m128i*>(out + k + 1), _mm_shuffle_epi8(v, shuffle));
+#else
+					int mask = 0;
+					for(int j = 0; j < 8; j++)
+						mask |= (in[i + j] != 0) << j;
+					for(int j = 0; j < t.count[mask]; j++)
+						out[k + 1 + j] = in[i + t.pack[mask][j]];
+#endif
+					out[k] = uint8_t(mask);
+					k += 1 + t.count[mask];
+				}
+				return k;
+			}
+
+			// The inverse of compressionPack(). out needs n bytes (a multiple
+			// of 8). Returns the bytes read, or 0 if the input runs out.
+			inline size_t compressionUnpack(const uint8_t* in, size_t size, uint8_t* out, size_t n)
+			{
+				const compressionTables& t = compressionTable();
+				size_t k = 0;
+				for(size_t i = 0; i < n; i += 8)
+				{
+					if(k >= size)
+						return 0;
+					const int mask = in[k];
+					const size_t used = t.count[mask];
+					if(k + 1 + used > size)
+						return 0;
+#if defined(__SSSE3__)
+					if(k + 9 <= size)
+					{
+						const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + k + 1));
+						const __m128i shuffle = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(t.unpack[mask]));
+						_mm_storel_epi64(reinterpret_cast<__m128i*>(out + i), _mm_shuffle_epi8(v, shuffle));
+						k += 1 + used;
+						continue;
+					}
+#endif
+					for(int j = 0; j < 8; j++)
+						out[i + j] = (mask & (1 << j)) ? in[k + 1 + t.unpack[mask][j]] : 0;
+					k += 1 + used;
+				}
+				return k;
+			}
+
+			inline uint32_t compressionZigzag(uint32_t v)
+			{
+				return (v << 1) ^ (0u - (v >> 31));
+			}
+
+			inline uint32_t compressionUnzigzag(uint32_t v)
+			{
+				return (v >> 1) ^ (0u - (v & 1));
+			}
+
+			inline uint32_t compressionBits(float v)
+			{
+				uint32_t b;
+				std::memcpy(&b, &v, sizeof(b));
+				return b;
+			}
+
+			inline float compressionFloat(uint32_t b)
+			{
+				float v;
+				std::memcpy(&v, &b, sizeof(v));
+				return v;
+			}
+
+			inline float compressionDequantize(uint32_t q, double step)
+			{
+				return float(double(int32_t(q)) * step);
+			}
+
+			// The words of every coordinate, as [coordinate][index]. Returns
+			// false when quantizing cannot keep the error bound.
+			inline bool compressionWords(const vec3<float>* in, size_t count, float maxError, uint32_t* words, uint8_t* orders)
+			{
+				if(maxError > 0)
+				{
+					const double step = 2.0 * double(maxError);
+					for(int c = 0; c < 3; c++)
+					{
+						uint32_t* q = words + c * count;
+						bool ok = true;
+						for(size_t i = 0; i < count; i++)
+						{
+							const float v = in[i][c];
+							const double scaled = double(v) / step;
+							if(!(std::fabs(scaled) < 1073741824.0))
+								return false;
+							q[i] = uint32_t(int32_t(std::floor(scaled + 0.5)));
+							ok &= std::fabs(compressionDequantize(q[i], step) - v) <= maxError;
+						}
+						if(!ok)
+							return false;
+
+						// Pick the predictor with the smaller residuals.
+						uint64_t first = 0, second = 0;
+						AFW_MATH_SIMD_LOOP
+						for(size_t i = 2; i < count; i++)
+						{
+							first += compressionZigzag(q[i] - q[i - 1]);
+							second += compressionZigzag(q[i] - 2 * q[i - 1] + q[i - 2]);
+						}
+						orders[c] = second < first ? 2 : 1;
+
+						for(size_t i = count; i-- > 1; )
+						{
+							const uint32_t prediction = orders[c] == 2 && i >= 2 ? 2 * q[i - 1] - q[i - 2] : q[i - 1];
+							q[i] = compressionZigzag(q[i] - prediction);
+						}
+						if(count > 0)
+							q[0] = compressionZigzag(q[0]);
+					}
+					return true;
+				}
+
+				for(int c = 0; c < 3; c++)
+				{
+					uint32_t* w = words + c * count;
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = 1; i < count; i++)
+						w[i] = compressionBits(in[i][c]) ^ compressionBits(in[i - 1][c]);
+					if(count > 0)
+						w[0] = compressionBits(in[0][c]);
+				}
+				return true;
+			}
+
+			// The size a block header claims, or 0 if it cannot be right.
+			inline size_t compressionBlockSize(const uint8_t* header)
+			{
+				uint32_t size;
+				std::memcpy(&size, header, 4);
+				if(size < CompressionHeaderSize || size > compressedBlockBound(CompressionBlockSize))
+					return 0;
+				return size;
+			}
+
+			inline void compressionWriteHeader(uint8_t* out, uint32_t size, uint32_t count, uint8_t method, const uint8_t* orders, float step)
+			{
+				std::memcpy(out, &size, 4);
+				std::memcpy(out + 4, &count, 4);
+				out[8] = method;
+				out[9] = orders[0];
+				out[10] = orders[1];
+				out[11] = orders[2];
+				std::memcpy(out + 12, &step, 4);
+			}
+		}
+
+		// Inline definitions
+		inline vec3Encoder::vec3Encoder(float maxError)
+			: m_maxError(maxError)
+		{
+			m_pending.reserve(CompressionBlockSize);
+		}
+
+		inline vec3Decoder::vec3Decoder()
+			: m_ok(true)
+		{}
+
+		inline bool vec3Decoder::finished() const
+		{
+			return m_ok && m_pending.empty();
+		}
+
+		inline size_t encodeBlock(const vec3<float>* in, size_t count, uint8_t* out, float maxError)
+		{
+			static thread_local Internal::compressionScratch scratch;
+			return Internal::compressionEncode(in, count, out, maxError, scratch);
+		}
+
+		inline size_t decodeBlock(const uint8_t* in, size_t size, vec3<float>* out)
+		{
+			static thread_local Internal::compressionScratch scratch;
+			return Internal::compressionDecode(in, size, out, scratch);
+		}
+
+		inline size_t Internal::compressionEncode(const vec3<float>* in, size_t count, uint8_t* out, float maxError, compressionScratch& scratch)
+		{
+			const size_t raw = count * 3 * sizeof(float);
+			uint8_t orders[3] = { 0, 0, 0 };
+
+			// Words, then the same words as byte planes, padded to eight.
+			const size_t planeBytes = (raw + 7) / 8 * 8;
+			scratch.words.resize(count * 3);
+			scratch.planes.resize(planeBytes);
+			std::fill(scratch.planes.begin() + raw, scratch.planes.end(), uint8_t(0));
+			uint32_t* words = scratch.words.data();
+			uint8_t* planes = scratch.planes.data();
+
+			uint8_t method = QuantizedMethod;
+			float step = 2 * maxError;
+			if(!(maxError > 0) || !compressionWords(in, count, maxError, words, orders))
+			{
+				method = XorMethod;
+				step = 0;
+				orders[0] = orders[1] = orders[2] = 0;
+				compressionWords(in, count, 0, words, orders);
+			}
+
+			const size_t n = count * 3;
+			for(int byte = 0; byte < 4; byte++)
+			{
+				uint8_t* plane = planes + byte * n;
+				const uint32_t* w = words;
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = 0; i < n; i++)
+					plane[i] = uint8_t(w[i] >> (8 * byte));
+			}
+
+			size_t size = compressionPack(planes, planeBytes, out + CompressionHeaderSize, raw);
+			if(size == 0)
+			{
+				// Stored raw: it would not shrink.
+				method = RawMethod;
+				step = 0;
+				orders[0] = orders[1] = orders[2] = 0;
+				std::memcpy(out + CompressionHeaderSize, in, raw);
+				size = raw;
+			}
+			size += CompressionHeaderSize;
+			compressionWriteHeader(out, uint32_t(size), uint32_t(count), method, orders, step);
+			return size;
+		}
+
+		inline size_t Internal::compressionDecode(const uint8_t* in, size_t size, vec3<float>* out, compressionScratch& scratch)
+		{
+			if(size < CompressionHeaderSize)
+				return 0;
+
+			uint32_t blockSize, count;
+			float step;
+			std::memcpy(&blockSize, in, 4);
+			std::memcpy(&count, in + 4, 4);
+			std::memcpy(&step, in + 12, 4);
+			const uint8_t method = in[8];
+			const uint8_t* orders = in + 9;
+			if(count == 0 || count > CompressionBlockSize || blockSize > size || blockSize < CompressionHeaderSize)
+				return 0;
+
+			const uint8_t* payload = in + CompressionHeaderSize;
+			const size_t payloadSize = blockSize - CompressionHeaderSize;
+			const size_t raw = size_t(count) * 3 * sizeof(float);
+			if(method == RawMethod)
+			{
+				if(payloadSize != raw)
+					return 0;
+				std::memcpy(out, payload, raw);
+				return count;
+			}
+			if(method > QuantizedMethod || (method == QuantizedMethod && !(step > 0)))
+				return 0;
+
+			const size_t planeBytes = (raw + 7) / 8 * 8;
+			scratch.planes.resize(planeBytes);
+			uint8_t* planes = scratch.planes.data();
+			if(compressionUnpack(payload, payloadSize, planes, planeBytes) != payloadSize)
+				return 0;
+
+			const size_t n = size_t(count) * 3;
+			scratch.words.resize(n);
+			uint32_t* words = scratch.words.data();
+			{
+				const uint8_t* p0 = planes;
+				const uint8_t* p1 = p0 + n;
+				const uint8_t* p2 = p1 + n;
+				const uint8_t* p3 = p2 + n;
+				uint32_t* w = words;
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = 0; i < n; i++)
+					w[i] = uint32_t(p0[i]) | uint32_t(p1[i]) << 8 | uint32_t(p2[i]) << 16 | uint32_t(p3[i]) << 24;
+			}
+
+			for(int c = 0; c < 3; c++)
+			{
+				uint32_t* w = words + c * count;
+				if(method == XorMethod)
+				{
+					uint32_t previous = 0;
+					for(size_t i = 0; i < count; i++)
+					{
+						previous ^= w[i];
+						out[i][c] = compressionFloat(previous);
+					}
+					continue;
+				}
+
+				if(orders[c] != 1 && orders[c] != 2)
+					return 0;
+				uint32_t q1 = 0, q2 = 0;
+				for(size_t i = 0; i < count; i++)
+				{
+					const uint32_t prediction = i == 0 ? 0 : orders[c] == 2 && i >= 2 ? 2 * q1 - q2 : q1;
+					const uint32_t q = compressionUnzigzag(w[i]) + prediction;
+					out[i][c] = compressionDequantize(q, double(step));
+					q2 = q1;
+					q1 = q;
+				}
+			}
+			return count;
+		}
+
+		inline bool compressedBlocks(const uint8_t* in, size_t size, std::vector<compressedBlock>& blocks)
+		{
+			blocks.clear();
+			size_t offset = 0, first = 0;
+			while(offset < size)
+			{
+				if(size - offset < CompressionHeaderSize)
+					return false;
+				uint32_t blockSize, count;
+				std::memcpy(&blockSize, in + offset, 4);
+				std::memcpy(&count, in + offset + 4, 4);
+				if(blockSize < CompressionHeaderSize || blockSize > size - offset || count == 0 || count > CompressionBlockSize)
+					return false;
+				blocks.push_back(compressedBlock{ offset, blockSize, first, count });
+				offset += blockSize;
+				first += count;
+			}
+			return true;
+		}
+
+		inline void compress(const vec3<float>* in, size_t count, std::vector<uint8_t>& out, float maxError)
+		{
+			const size_t blocks = (count + CompressionBlockSize - 1) / CompressionBlockSize;
+			const size_t chunks = parallelChunkCount(blocks, 1);
+			std::vector<std::vector<uint8_t>> parts(chunks);
+
+			parallelFor(blocks, 1, [&](size_t begin, size_t end, size_t chunk) {
+				std::vector<uint8_t>& part = parts[chunk];
+				std::vector<uint8_t> block(compressedBlockBound(CompressionBlockSize));
+				Internal::compressionScratch scratch;
+				for(size_t b = begin; b < end; b++)
+				{
+					const size_t first = b * CompressionBlockSize;
+					const size_t n = std::min(CompressionBlockSize, count - first);
+					const size_t size = Internal::compressionEncode(in + first, n, block.data(), maxError, scratch);
+					part.insert(part.end(), block.begin(), block.begin() + size);
+				}
+			});
+
+			out.clear();
+			size_t total = 0;
+			for(const std::vector<uint8_t>& part : parts)
+				total += part.size();
+			out.reserve(total);
+			for(const std::vector<uint8_t>& part : parts)
+				out.insert(out.end(), part.begin(), part.end());
+		}
+
+		inline bool decompress(const uint8_t* in, size_t size, std::vector<vec3<float>>& out)
+		{
+			std::vector<compressedBlock> blocks;
+			out.clear();
+			if(!compressedBlocks(in, size, blocks))
+				return false;
+			out.resize(blocks.empty() ? 0 : blocks.back().first + blocks.back().count);
+
+			const size_t chunks = parallelChunkCount(blocks.size(), 1);
+			std::vector<char> ok(chunks, 1);
+			parallelFor(blocks.size(), 1, [&](size_t begin, size_t end, size_t chunk) {
+				std::vector<vec3<float>> values(CompressionBlockSize);
+				Internal::compressionScratch scratch;
+				for(size_t b = begin; b < end && ok[chunk]; b++)
+				{
+					const compressedBlock& block = blocks[b];
+					if(Internal::compressionDecode(in + block.offset, block.size, values.data(), scratch) != block.count)
+						ok[chunk] = 0;
+					else
+						std::copy(values.begin(), values.begin() + block.count, out.begin() + block.first);
+				}
+			});
+
+			if(std::find(ok.begin(), ok.end(), 0) != ok.end())
+			{
+				out.clear();
+				return false;
+			}
+			return true;
+		}
+
+		// Template implementation
+		template<typename Sink>
+		void vec3Encoder::write(const vec3<float>* in, size_t count, Sink&& sink)
+		{
+			while(count > 0)
+			{
+				const size_t take = std::min(count, CompressionBlockSize - m_pending.size());
+				m_pending.insert(m_pending.end(), in, in + take);
+				in += take;
+				count -= take;
+				if(m_pending.size() == CompressionBlockSize)
+					flush(sink);
+			}
+		}
+
+		template<typename Sink>
+		void vec3Encoder::flush(Sink&& sink)
+		{
+			if(m_pending.empty())
+				return;
+			m_block.resize(compressedBlockBound(CompressionBlockSize));
+			const size_t size = Internal::compressionEncode(m_pending.data(), m_pending.size(), m_block.data(), m_maxError, m_scratch);
+			m_pending.clear();
+			sink(static_cast<const uint8_t*>(m_block.data()), size);
+		}
+
+		template<typename Sink>
+		bool vec3Decoder::write(const uint8_t* in, size_t size, Sink&& sink)
+		{
+			if(!m_ok)
+				return false;
+			m_values.resize(CompressionBlockSize);
+
+			while(size > 0)
+			{
+				// Whole blocks are decoded straight from the input; a partial
+				// one is buffered until the rest of it arrives.
+				size_t blockSize = 0;
+				if(m_pending.empty() && size >= CompressionHeaderSize)
+				{
+					blockSize = Internal::compressionBlockSize(in);
+					if(blockSize == 0)
+						return m_ok = false;
+					if(blockSize <= size)
+					{
+						const size_t count = Internal::compressionDecode(in, blockSize, m_values.data(), m_scratch);
+						if(count == 0)
+							return m_ok = false;
+						sink(static_cast<const vec3<float>*>(m_values.data()), count);
+						in += blockSize;
+						size -= blockSize;
+						continue;
+					}
+				}
+
+				if(m_pending.size() >= CompressionHeaderSize)
+					blockSize = Internal::compressionBlockSize(m_pending.data());
+				const size_t want = blockSize > 0 ? blockSize : CompressionHeaderSize;
+				const size_t take = std::min(size, want - m_pending.size());
+				m_pending.insert(m_pending.end(), in, in + take);
+				in += take;
+				size -= take;
+
+				if(m_pending.size() < CompressionHeaderSize)
+					continue;
+				blockSize = Internal::compressionBlockSize(m_pending.data());
+				if(blockSize == 0)
+					return m_ok = false;
+				if(m_pending.size() == blockSize)
+				{
+					const size_t count = Internal::compressionDecode(m_pending.data(), blockSize, m_values.data(), m_scratch);
+					m_pending.clear();
+					if(count == 0)
+						return m_ok = false;
+					sink(static_cast<const vec3<float>*>(m_values.data()), count);
+				}
+			}
+			return true;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_COMPRESSION_H
@@ -0,0 +1,929 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/ConvexHull.h
+ * Convex hull header. This contains a 2D monotone chain hull and a
+ * 3D quickhull, both of which first discard in parallel the points
+ * that lie inside a polytope spanned by a few extreme points.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_CONVEXHULL_H
+#define AURORAFW_MATH_CONVEXHULL_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/VectorTraits.h>
+#include <AuroraFW/Math/Interval.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		namespace Internal {
+			constexpr size_t HullBlock = 256;
+			constexpr size_t HullGrain = 1 << 16;
+			constexpr int HullDirections2D = 16;
+			constexpr int HullDirections3D = 26;
+		}
+
+		/**
+		 * The convex hull of a set of 2D points, computed with Andrew's
+		 * monotone chain. Points inside the polygon spanned by the extreme
+		 * points along 16 directions (Akl–Toussaint) are discarded first,
+		 * in parallel, so only a small fraction of the input gets sorted.
+		 *
+		 * The working buffers are kept between builds, so rebuilding
+		 * allocates nothing once the input size stops growing.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API convexHull2D {
+		public:
+			/** Computes the hull of the given points.
+			 * @param points The points, as a structure of arrays.
+			 * @return The number of hull vertices.
+			 * @since snapshot20261019
+			 */
+			size_t build(const vec2SoA<const T>& );
+
+			/** Computes the hull of the given points.
+			 * @param points The points.
+			 * @param count The number of points.
+			 * @return The number of hull vertices.
+			 * @since snapshot20261019
+			 */
+			size_t build(const vec2<T>* , size_t );
+
+			/** Returns the indices of the hull vertices in counter-clockwise
+			 * order, starting at the lowest x (then lowest y). Points in the
+			 * middle of a hull edge are left out. Collinear input gives its
+			 * two end points and a single distinct point gives one index.
+			 * @since snapshot20261019
+			 */
+			const std::vector<uint32_t>& indices() const;
+
+			/** Returns the number of hull vertices.
+			 * @since snapshot20261019
+			 */
+			size_t size() const;
+
+		private:
+			template<typename G>
+			size_t build(size_t , G );
+
+			std::vector<uint32_t> m_indices;
+			std::vector<uint32_t> m_candidates;
+			std::vector<std::vector<uint32_t>> m_chunkCandidates;
+			std::vector<T> m_extremeValue;
+			std::vector<uint32_t> m_extremeIndex;
+			std::vector<T> m_planes;
+		};
+
+		/**
+		 * The convex hull of a set of 3D points, as a triangle mesh, computed
+		 * with quickhull. Points inside the polytope spanned by the extreme
+		 * points along 26 directions (Akl–Toussaint) are discarded first,
+		 * in parallel, and the remaining points are assigned to the faces
+		 * of the starting tetrahedron in parallel as well.
+		 *
+		 * The per-face conflict lists live in a single pool that is appended
+		 * to and compacted as faces are replaced, and together with the face
+		 * array it is kept between builds, so rebuilding allocates nothing
+		 * once the input size stops growing.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API convexHull3D {
+		public:
+			/** Computes the hull of the given points.
+			 * @param points The points, as a structure of arrays.
+			 * @return The number of hull triangles, 0 if all the points
+			 * are coplanar.
+			 * @since snapshot20261019
+			 */
+			size_t build(const vec3SoA<const T>& );
+
+			/** Computes the hull of the given points.
+			 * @param points The points.
+			 * @param count The number of points.
+			 * @return The number of hull triangles, 0 if all the points
+			 * are coplanar.
+			 * @since snapshot20261019
+			 */
+			size_t build(const vec3<T>* , size_t );
+
+			/** Returns three point indices per hull triangle, in
+			 * counter-clockwise order seen from outside the hull.
+			 * @since snapshot20261019
+			 */
+			const std::vector<uint32_t>& triangles() const;
+
+			/** Returns the indices of the hull vertices, in ascending order.
+			 * @since snapshot20261019
+			 */
+			const std::vector<uint32_t>& vertices() const;
+
+			/** Returns the number of hull triangles.
+			 * @since snapshot20261019
+			 */
+			size_t size() const;
+
+		private:
+			enum : uint32_t { Invalid = 0xFFFFFFFFu };
+
+			struct face {
+				uint32_t v[3];
+				uint32_t adj[3];
+				vec3<T> normal;
+				T offset;
+				uint32_t conflictBegin;
+				uint32_t conflictCount;
+				uint32_t furthest;
+				T furthestDistance;
+				uint32_t visit;
+				bool alive;
+			};
+
+			struct frame {
+				uint32_t face;
+				uint32_t edge;
+				uint32_t left;
+			};
+
+			template<typename G>
+			size_t build(size_t , G );
+			bool quickhull();
+			T distance(const face& , uint32_t ) const;
+			uint32_t addFace(uint32_t , uint32_t , uint32_t );
+			void distribute(const uint32_t* , size_t , const uint32_t* , size_t );
+			void compactPool();
+
+			T m_epsilon;
+			uint32_t m_visit;
+			size_t m_liveConflicts;
+			std::vector<vec3<T>> m_points;
+			std::vector<uint32_t> m_ids;
+			std::vector<face> m_faces;
+			std::vector<uint32_t> m_freeFaces;
+			std::vector<uint32_t> m_pool;
+			std::vector<uint32_t> m_poolSwap;
+			std::vector<uint32_t> m_pending;
+			std::vector<frame> m_stack;
+			std::vector<uint32_t> m_visible;
+			std::vector<uint32_t> m_horizon;
+			std::vector<uint32_t> m_newFaces;
+			std::vector<uint32_t> m_orphans;
+			std::vector<uint32_t> m_target;
+			std::vector<T> m_targetDistance;
+			std::vector<uint32_t> m_faceCount;
+			std::vector<uint32_t> m_candidates;
+			std::vector<std::vector<uint32_t>> m_chunkCandidates;
+			std::vector<T> m_extremeValue;
+			std::vector<uint32_t> m_extremeIndex;
+			std::vector<T> m_planes;
+			std::vector<uint32_t> m_extremes;
+			std::vector<uint32_t> m_triangles;
+			std::vector<uint32_t> m_vertices;
+		};
+
+		typedef convexHull2D<float> ConvexHull2D;
+		typedef convexHull3D<float> ConvexHull3D;
+
+		// Inline definitions
+		template<typename T>
+		inline const std::vector<uint32_t>& convexHull2D<T>::indices() const
+		{
+			return m_indices;
+		}
+
+		template<typename T>
+		inline size_t convexHull2D<T>::size() const
+		{
+			return m_indices.size();
+		}
+
+		template<typename T>
+		inline const std::vector<uint32_t>& convexHull3D<T>::triangles() const
+		{
+			return m_triangles;
+		}
+
+		template<typename T>
+		inline const std::vector<uint32_t>& convexHull3D<T>::vertices() const
+		{
+			return m_vertices;
+		}
+
+		template<typename T>
+		inline size_t convexHull3D<T>::size() const
+		{
+			return m_triangles.size() / 3;
+		}
+
+		template<typename T>
+		inline T convexHull3D<T>::distance(const face& f, uint32_t i) const
+		{
+			return f.normal.dot(m_points[i]) - f.offset;
+		}
+
+		// Template implementation
+		namespace Internal {
+			// Lets the 2D and 3D hulls share the 3D filtering kernels.
+			template<typename T>
+			inline T hullZ(const vec2<T>& )
+			{
+				return T(0);
+			}
+
+			template<typename T>
+			inline T hullZ(const vec3<T>& p)
+			{
+				return p.z;
+			}
+
+			// Finds, for each of the N directions, the point with the
+			// largest dot product, the lowest index winning ties.
+			template<typename T, int N, typename G>
+			void hullExtremes(size_t count, G get, const T (&dirs)[N][3], std::vector<T>& value, std::vector<uint32_t>& index)
+			{
+				const size_t chunks = parallelChunkCount(count, HullGrain);
+				value.assign(chunks * N, std::numeric_limits<T>::lowest());
+				index.assign(chunks * N, 0);
+
+				parallelFor(count, HullGrain, [&](size_t begin, size_t end, size_t chunk) {
+					T x[HullBlock], y[HullBlock], z[HullBlock], d[HullBlock];
+					T* best = &value[chunk * N];
+					uint32_t* bestIndex = &index[chunk * N];
+					for(size_t start = begin; start < end; start += HullBlock)
+					{
+						const size_t n = std::min(HullBlock, end - start);
+						for(size_t i = 0; i < n; i++)
+						{
+							const auto p = get(start + i);
+							x[i] = p.x;
+							y[i] = p.y;
+							z[i] = hullZ(p);
+						}
+						for(int k = 0; k < N; k++)
+						{
+							const T dx = dirs[k][0], dy = dirs[k][1], dz = dirs[k][2];
+							AFW_MATH_SIMD_LOOP
+							for(size_t i = 0; i < n; i++)
+								d[i] = x[i] * dx + y[i] * dy + z[i] * dz;
+							for(size_t i = 0; i < n; i++)
+							{
+								if(d[i] > best[k])
+								{
+									best[k] = d[i];
+									bestIndex[k] = static_cast<uint32_t>(start + i);
+								}
+							}
+						}
+					}
+				});
+
+				for(size_t chunk = 1; chunk < chunks; chunk++)
+				{
+					for(int k = 0; k < N; k++)
+					{
+						if(value[chunk * N + k] > value[k])
+						{
+							value[k] = value[chunk * N + k];
+							index[k] = index[chunk * N + k];
+						}
+					}
+				}
+				value.resize(N);
+				index.resize(N);
+			}
+
+			// Keeps, in ascending order, the indices of the points outside
+			// at least one of the planes (a, b, c, d), that is with
+			// a*x + b*y + c*z - d above epsilon.
+			template<typename T, typename G>
+			void hullFilter(size_t count, G get, const std::vector<T>& planes, T epsilon,
+				std::vector<std::vector<uint32_t>>& chunkKeep, std::vector<uint32_t>& keep)
+			{
+				const size_t chunks = parallelChunkCount(count, HullGrain);
+				if(chunkKeep.size() < chunks)
+					chunkKeep.resize(chunks);
+				const size_t planeCount = planes.size() / 4;
+
+				parallelFor(count, HullGrain, [&](size_t begin, size_t end, size_t chunk) {
+					T x[HullBlock], y[HullBlock], z[HullBlock];
+					uint8_t outside[HullBlock];
+					std::vector<uint32_t>& out = chunkKeep[chunk];
+					out.clear();
+					for(size_t start = begin; start < end; start += HullBlock)
+					{
+						const size_t n = std::min(HullBlock, end - start);
+						for(size_t i = 0; i < n; i++)
+						{
+							const auto p = get(start + i);
+							x[i] = p.x;
+							y[i] = p.y;
+							z[i] = hullZ(p);
+							outside[i] = 0;
+						}
+						for(size_t k = 0; k < planeCount; k++)
+						{
+							const T a = planes[4 * k], b = planes[4 * k + 1], c = planes[4 * k + 2];
+							const T d = planes[4 * k + 3] + epsilon;
+							AFW_MATH_SIMD_LOOP
+							for(size_t i = 0; i < n; i++)
+								outside[i] |= static_cast<uint8_t>(x[i] * a + y[i] * b + z[i] * c > d);
+						}
+						for(size_t i = 0; i < n; i++)
+						{
+							if(outside[i])
+								out.push_back(static_cast<uint32_t>(start + i));
+						}
+					}
+				});
+
+				keep.clear();
+				for(size_t chunk = 0; chunk < chunks; chunk++)
+					keep.insert(keep.end(), chunkKeep[chunk].begin(), chunkKeep[chunk].end());
+			}
+		}
+
+		template<typename T>
+		size_t convexHull2D<T>::build(const vec2SoA<const T>& points)
+		{
+			return build(points.size, [&points](size_t i) {
+				return vec2<T>(points.x[i], points.y[i]);
+			});
+		}
+
+		template<typename T>
+		size_t convexHull2D<T>::build(const vec2<T>* points, size_t count)
+		{
+			return build(count, [points](size_t i) {
+				return points[i];
+			});
+		}
+
+		template<typename T>
+		template<typename G>
+		size_t convexHull2D<T>::build(size_t count, G get)
+		{
+			const int N = Internal::HullDirections2D;
+			m_indices.clear();
+			if(count == 0)
+				return 0;
+
+			// Directions at equal angles, so the extremes come out in
+			// counter-clockwise order around the hull.
+			T dirs[N][3];
+			for(int k = 0; k < N; k++)
+			{
+				const double angle = 2 * 3.14159265358979323846 * k / N;
+				dirs[k][0] = T(std::cos(angle));
+				dirs[k][1] = T(std::sin(angle));
+				dirs[k][2] = T(0);
+			}
+			Internal::hullExtremes<T, N>(count, get, dirs, m_extremeValue, m_extremeIndex);
+
+			std::vector<uint32_t>& polygon = m_indices;
+			for(int k = 0; k < N; k++)
+			{
+				if(polygon.empty() || (polygon.back() != m_extremeIndex[k] && polygon.front() != m_extremeIndex[k]))
+					polygon.push_back(m_extremeIndex[k]);
+			}
+
+			T scale = 0;
+			for(int k = 0; k < N; k++)
+				scale = std::max(scale, std::fabs(m_extremeValue[k]));
+
+			if(polygon.size() >= 3)
+			{
+				// A point is strictly inside if it is left of every edge,
+				// that is (ey, -ex) . p < (ey, -ex) . a. Keep the others, with
+				// a negative tolerance so points on the edges stay.
+				std::vector<T>& planes = m_planes;
+				planes.clear();
+				planes.reserve(polygon.size() * 4);
+				for(size_t k = 0; k < polygon.size(); k++)
+				{
+					const vec2<T> a = get(polygon[k]);
+					const vec2<T> b = get(polygon[(k + 1) % polygon.size()]);
+					const T ex = b.x - a.x, ey = b.y - a.y;
+					planes.push_back(ey);
+					planes.push_back(-ex);
+					planes.push_back(T(0));
+					planes.push_back(ey * a.x - ex * a.y);
+				}
+				const T epsilon = 16 * scale * scale * std::numeric_limits<T>::epsilon();
+				Internal::hullFilter(count, get, planes, -epsilon, m_chunkCandidates, m_candidates);
+			}
+			else
+			{
+				m_candidates.resize(count);
+				for(size_t i = 0; i < count; i++)
+					m_candidates[i] = static_cast<uint32_t>(i);
+			}
+
+			// The extremes lie on the polygon edges, so the filter keeps them.
+			std::sort(m_candidates.begin(), m_candidates.end(), [&get](uint32_t a, uint32_t b) {
+				const vec2<T> p = get(a), q = get(b);
+				return p.x < q.x || (p.x == q.x && (p.y < q.y || (p.y == q.y && a < b)));
+			});
+			m_candidates.erase(std::unique(m_candidates.begin(), m_candidates.end(), [&get](uint32_t a, uint32_t b) {
+				const vec2<T> p = get(a), q = get(b);
+				return p.x == q.x && p.y == q.y;
+			}), m_candidates.end());
+
+			m_indices.clear();
+			const size_t n = m_candidates.size();
+			if(n < 3)
+			{
+				m_indices = m_candidates;
+				return m_indices.size();
+			}
+
+			// Exact turns, so nearly collinear points cannot fold the chain.
+			auto cross = [&get](uint32_t o, uint32_t a, uint32_t b) {
+				const vec2<T> po = get(o), pa = get(a), pb = get(b);
+				return orient2D(po, pa, pb);
+			};
+
+			m_indices.resize(2 * n);
+			size_t k = 0;
+			for(size_t i = 0; i < n; i++)
+			{
+				while(k >= 2 && cross(m_indices[k - 2], m_indices[k - 1], m_candidates[i]) <= 0)
+					k--;
+				m_indices[k++] = m_candidates[i];
+			}
+			for(size_t i = n - 1, lower = k + 1; i > 0; i--)
+			{
+				while(k >= lower && cross(m_indices[k - 2], m_indices[k - 1], m_candidates[i - 1]) <= 0)
+					k--;
+				m_indices[k++] = m_candidates[i - 1];
+			}
+			m_indices.resize(k - 1);
+			return m_indices.size();
+		}
+
+		template<typename T>
+		size_t convexHull3D<T>::build(const vec3SoA<const T>& points)
+		{
+			return build(points.size, [&points](size_t i) {
+				return vec3<T>(points.x[i], points.y[i], points.z[i]);
+			});
+		}
+
+		template<typename T>
+		size_t convexHull3D<T>::build(const vec3<T>* points, size_t count)
+		{
+			return build(count, [points](size_t i) {
+				return points[i];
+			});
+		}
+
+		template<typename T>
+		template<typename G>
+		size_t convexHull3D<T>::build(size_t count, G get)
+		{
+			const int N = Internal::HullDirections3D;
+			m_triangles.clear();
+			m_vertices.clear();
+			if(count < 4)
+				return 0;
+
+			// The 26 directions towards the neighbours of a cell in a grid.
+			T dirs[N][3];
+			int k = 0;
+			for(int x = -1; x <= 1; x++)
+				for(int y = -1; y <= 1; y++)
+					for(int z = -1; z <= 1; z++)
+						if(x != 0 || y != 0 || z != 0)
+						{
+							dirs[k][0] = T(x);
+							dirs[k][1] = T(y);
+							dirs[k][2] = T(z);
+							k++;
+						}
+			Internal::hullExtremes<T, N>(count, get, dirs, m_extremeValue, m_extremeIndex);
+
+			// Tolerance for the plane tests, relative to the extent of the input.
+			T extent = 0;
+			for(k = 0; k < N; k++)
+				if(std::fabs(dirs[k][0]) + std::fabs(dirs[k][1]) + std::fabs(dirs[k][2]) == 1)
+					extent += std::fabs(m_extremeValue[k]);
+			m_epsilon = 3 * extent * std::numeric_limits<T>::epsilon();
+
+			// Hull the extreme points alone, then drop everything inside it.
+			std::vector<uint32_t>& extremes = m_extremes;
+			extremes.assign(m_extremeIndex.begin(), m_extremeIndex.end());
+			std::sort(extremes.begin(), extremes.end());
+			extremes.erase(std::unique(extremes.begin(), extremes.end()), extremes.end());
+
+			m_ids = extremes;
+			m_points.resize(m_ids.size());
+			for(size_t i = 0; i < m_ids.size(); i++)
+				m_points[i] = get(m_ids[i]);
+
+			if(quickhull())
+			{
+				std::vector<T>& planes = m_planes;
+				planes.clear();
+				for(const face& f : m_faces)
+				{
+					if(!f.alive)
+						continue;
+					planes.push_back(f.normal.x);
+					planes.push_back(f.normal.y);
+					planes.push_back(f.normal.z);
+					planes.push_back(f.offset);
+				}
+				Internal::hullFilter(count, get, planes, m_epsilon, m_chunkCandidates, m_candidates);
+
+				const size_t kept = m_candidates.size();
+				m_candidates.insert(m_candidates.end(), extremes.begin(), extremes.end());
+				std::inplace_merge(m_candidates.begin(), m_candidates.begin() + kept, m_candidates.end());
+				m_candidates.erase(std::unique(m_candidates.begin(), m_candidates.end()), m_candidates.end());
+			}
+			else
+			{
+				m_candidates.resize(count);
+				for(size_t i = 0; i < count; i++)
+					m_candidates[i] = static_cast<uint32_t>(i);
+			}
+
+			m_ids.swap(m_candidates);
+			m_points.resize(m_ids.size());
+			parallelFor(m_ids.size(), Internal::HullGrain, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					m_points[i] = get(m_ids[i]);
+			});
+
+			if(!quickhull())
+				return 0;
+
+			for(const face& f : m_faces)
+			{
+				if(!f.alive)
+					continue;
+				for(int j = 0; j < 3; j++)
+				{
+					m_triangles.push_back(m_ids[f.v[j]]);
+					m_vertices.push_back(m_ids[f.v[j]]);
+				}
+			}
+			std::sort(m_vertices.begin(), m_vertices.end());
+			m_vertices.erase(std::unique(m_vertices.begin(), m_vertices.end()), m_vertices.end());
+			return m_triangles.size() / 3;
+		}
+
+		template<typename T>
+		uint32_t convexHull3D<T>::addFace(uint32_t a, uint32_t b, uint32_t c)
+		{
+			uint32_t id;
+			if(!m_freeFaces.empty())
+			{
+				id = m_freeFaces.back();
+				m_freeFaces.pop_back();
+			}
+			else
+			{
+				id = static_cast<uint32_t>(m_faces.size());
+				m_faces.push_back(face());
+			}
+
+			face& f = m_faces[id];
+			f.v[0] = a;
+			f.v[1] = b;
+			f.v[2] = c;
+			f.adj[0] = f.adj[1] = f.adj[2] = Invalid;
+
+			const vec3<T>& pa = m_points[a];
+			const vec3<T>& pb = m_points[b];
+			const vec3<T>& pc = m_points[c];
+			const vec3<T> ab(pb.x - pa.x, pb.y - pa.y, pb.z - pa.z);
+			const vec3<T> ac(pc.x - pa.x, pc.y - pa.y, pc.z - pa.z);
+			f.normal = ab.cross(ac);
+			const T length = f.normal.length();
+			if(length > 0)
+				f.normal = vec3<T>(f.normal.x / length, f.normal.y / length, f.normal.z / length);
+			f.offset = f.normal.dot(pa);
+
+			f.conflictBegin = 0;
+			f.conflictCount = 0;
+			f.furthest = Invalid;
+			f.furthestDistance = 0;
+			f.visit = 0;
+			f.alive = true;
+			return id;
+		}
+
+		template<typename T>
+		void convexHull3D<T>::distribute(const uint32_t* points, size_t count, const uint32_t* faces, size_t faceCount)
+		{
+			// Give each point to the face it is furthest above, then append
+			// the new conflict lists to the pool grouped by face.
+			m_target.resize(count);
+			m_targetDistance.resize(count);
+			parallelFor(count, Internal::HullGrain, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					uint32_t target = Invalid;
+					T best = m_epsilon;
+					for(size_t k = 0; k < faceCount; k++)
+					{
+						const T d = distance(m_faces[faces[k]], points[i]);
+						if(d > best)
+						{
+							best = d;
+							target = static_cast<uint32_t>(k);
+						}
+					}
+					m_target[i] = target;
+					m_targetDistance[i] = best;
+				}
+			});
+
+			m_faceCount.assign(faceCount + 1, 0);
+			for(size_t i = 0; i < count; i++)
+				if(m_target[i] != Invalid)
+					m_faceCount[m_target[i] + 1]++;
+
+			const uint32_t base = static_cast<uint32_t>(m_pool.size());
+			for(size_t k = 0; k < faceCount; k++)
+			{
+				face& f = m_faces[faces[k]];
+				f.conflictBegin = base + m_faceCount[k];
+				f.conflictCount = 0;
+				m_faceCount[k + 1] += m_faceCount[k];
+			}
+			m_pool.resize(base + m_faceCount[faceCount]);
+			m_liveConflicts += m_faceCount[faceCount];
+
+			for(size_t i = 0; i < count; i++)
+			{
+				if(m_target[i] == Invalid)
+					continue;
+				face& f = m_faces[faces[m_target[i]]];
+				m_pool[f.conflictBegin + f.conflictCount++] = points[i];
+				if(f.furthest == Invalid || m_targetDistance[i] > f.furthestDistance)
+				{
+					f.furthest = points[i];
+					f.furthestDistance = m_targetDistance[i];
+				}
+			}
+
+			for(size_t k = 0; k < faceCount; k++)
+				if(m_faces[faces[k]].conflictCount > 0)
+					m_pending.push_back(faces[k]);
+		}
+
+		template<typename T>
+		void convexHull3D<T>::compactPool()
+		{
+			m_poolSwap.clear();
+			for(face& f : m_faces)
+			{
+				if(!f.alive || f.conflictCount == 0)
+					continue;
+				const uint32_t begin = static_cast<uint32_t>(m_poolSwap.size());
+				m_poolSwap.insert(m_poolSwap.end(), m_pool.begin() + f.conflictBegin,
+					m_pool.begin() + f.conflictBegin + f.conflictCount);
+				f.conflictBegin = begin;
+			}
+			m_pool.swap(m_poolSwap);
+		}
+
+		template<typename T>
+		bool convexHull3D<T>::quickhull()
+		{
+			const uint32_t n = static_cast<uint32_t>(m_points.size());
+			m_faces.clear();
+			m_freeFaces.clear();
+			m_pool.clear();
+			m_pending.clear();
+			m_liveConflicts = 0;
+			m_visit = 0;
+			if(n < 4)
+				return false;
+
+			// Starting tetrahedron: the two furthest apart of the axis
+			// extremes, the point furthest from their line and the point
+			// furthest from the plane of those three.
+			uint32_t axis[6] = { 0, 0, 0, 0, 0, 0 };
+			for(uint32_t i = 1; i < n; i++)
+			{
+				const vec3<T>& p = m_points[i];
+				if(p.x < m_points[axis[0]].x) axis[0] = i;
+				if(p.x > m_points[axis[1]].x) axis[1] = i;
+				if(p.y < m_points[axis[2]].y) axis[2] = i;
+				if(p.y > m_points[axis[3]].y) axis[3] = i;
+				if(p.z < m_points[axis[4]].z) axis[4] = i;
+				if(p.z > m_points[axis[5]].z) axis[5] = i;
+			}
+
+			uint32_t i0 = 0, i1 = 0;
+			T best = 0;
+			for(int a = 0; a < 6; a++)
+				for(int b = a + 1; b < 6; b++)
+				{
+					const T d = distanceSquared(m_points[axis[a]], m_points[axis[b]]);
+					if(d > best)
+					{
+						best = d;
+						i0 = axis[a];
+						i1 = axis[b];
+					}
+				}
+			if(best <= m_epsilon * m_epsilon)
+				return false;
+
+			const vec3<T>& p0 = m_points[i0];
+			const vec3<T> dir(m_points[i1].x - p0.x, m_points[i1].y - p0.y, m_points[i1].z - p0.z);
+			uint32_t i2 = 0;
+			best = 0;
+			for(uint32_t i = 0; i < n; i++)
+			{
+				const vec3<T> v(m_points[i].x - p0.x, m_points[i].y - p0.y, m_points[i].z - p0.z);
+				const vec3<T> c = v.cross(dir);
+				const T d = c.dot(c);
+				if(d > best)
+				{
+					best = d;
+					i2 = i;
+				}
+			}
+			if(std::sqrt(best / dir.dot(dir)) <= m_epsilon)
+				return false;
+
+			const vec3<T> side(m_points[i2].x - p0.x, m_points[i2].y - p0.y, m_points[i2].z - p0.z);
+			vec3<T> normal = dir.cross(side);
+			normal = vec3<T>(normal.x / normal.length(), normal.y / normal.length(), normal.z / normal.length());
+			uint32_t i3 = 0;
+			best = 0;
+			for(uint32_t i = 0; i < n; i++)
+			{
+				const T d = std::fabs(normal.dot(vec3<T>(m_points[i].x - p0.x, m_points[i].y - p0.y, m_points[i].z - p0.z)));
+				if(d > best)
+				{
+					best = d;
+					i3 = i;
+				}
+			}
+			if(best <= m_epsilon)
+				return false;
+
+			// Make the first face look away from the fourth point.
+			if(normal.dot(vec3<T>(m_points[i3].x - p0.x, m_points[i3].y - p0.y, m_points[i3].z - p0.z)) > 0)
+				std::swap(i1, i2);
+
+			const uint32_t start[4] = {
+				addFace(i0, i1, i2),
+				addFace(i1, i0, i3),
+				addFace(i2, i1, i3),
+				addFace(i0, i2, i3)
+			};
+			for(uint32_t f : start)
+				for(int e = 0; e < 3; e++)
+				{
+					const uint32_t a = m_faces[f].v[e], b = m_faces[f].v[(e + 1) % 3];
+					for(uint32_t g : start)
+						for(int j = 0; j < 3; j++)
+							if(m_faces[g].v[j] == b && m_faces[g].v[(j + 1) % 3] == a)
+								m_faces[f].adj[e] = g;
+				}
+
+			m_orphans.clear();
+			for(uint32_t i = 0; i < n; i++)
+				if(i != i0 && i != i1 && i != i2 && i != i3)
+					m_orphans.push_back(i);
+			distribute(m_orphans.data(), m_orphans.size(), start, 4);
+
+			while(!m_pending.empty())
+			{
+				const uint32_t top = m_pending.back();
+				m_pending.pop_back();
+				if(!m_faces[top].alive || m_faces[top].conflictCount == 0)
+					continue;
+
+				if(m_pool.size() > 1024 && m_pool.size() > 2 * m_liveConflicts)
+					compactPool();
+
+				const uint32_t eye = m_faces[top].furthest;
+
+				// Walk the faces the eye point sees. Crossing into a face
+				// through one edge and visiting its other edges in order
+				// yields the horizon as a counter-clockwise loop.
+				m_visit++;
+				m_visible.clear();
+				m_horizon.clear();
+				m_stack.clear();
+				m_faces[top].visit = m_visit;
+				m_visible.push_back(top);
+				m_stack.push_back(frame{ top, 0, 3 });
+				while(!m_stack.empty())
+				{
+					frame& current = m_stack.back();
+					if(current.left == 0)
+					{
+						m_stack.pop_back();
+						continue;
+					}
+					const uint32_t f = current.face;
+					const uint32_t e = current.edge;
+					current.edge = (e + 1) % 3;
+					current.left--;
+
+					const uint32_t g = m_faces[f].adj[e];
+					if(m_faces[g].visit == m_visit)
+						continue;
+					if(distance(m_faces[g], eye) > m_epsilon)
+					{
+						m_faces[g].visit = m_visit;
+						m_visible.push_back(g);
+						const uint32_t b = m_faces[f].v[(e + 1) % 3];
+						uint32_t j = 0;
+						while(m_faces[g].v[j] != b)
+							j++;
+						m_stack.push_back(frame{ g, (j + 1) % 3, 2 });
+					}
+					else
+					{
+						m_horizon.push_back(f);
+						m_horizon.push_back(e);
+					}
+				}
+
+				m_orphans.clear();
+				for(uint32_t f : m_visible)
+				{
+					const face& v = m_faces[f];
+					for(uint32_t i = 0; i < v.conflictCount; i++)
+						if(m_pool[v.conflictBegin + i] != eye)
+							m_orphans.push_back(m_pool[v.conflictBegin + i]);
+					m_liveConflicts -= v.conflictCount;
+				}
+
+				// Fan new faces from the eye to the horizon.
+				m_newFaces.clear();
+				const size_t horizon = m_horizon.size() / 2;
+				for(size_t h = 0; h < horizon; h++)
+				{
+					const uint32_t f = m_horizon[2 * h], e = m_horizon[2 * h + 1];
+					const uint32_t a = m_faces[f].v[e], b = m_faces[f].v[(e + 1) % 3];
+					const uint32_t g = m_faces[f].adj[e];
+					const uint32_t nf = addFace(a, b, eye);
+					m_faces[nf].adj[0] = g;
+					for(int j = 0; j < 3; j++)
+						if(m_faces[g].v[j] == b && m_faces[g].v[(j + 1) % 3] == a)
+							m_faces[g].adj[j] = nf;
+					m_newFaces.push_back(nf);
+				}
+				for(size_t h = 0; h < horizon; h++)
+				{
+					m_faces[m_newFaces[h]].adj[1] = m_newFaces[(h + 1) % horizon];
+					m_faces[m_newFaces[h]].adj[2] = m_newFaces[(h + horizon - 1) % horizon];
+				}
+
+				for(uint32_t f : m_visible)
+				{
+					m_faces[f].alive = false;
+					m_freeFaces.push_back(f);
+				}
+
+				distribute(m_orphans.data(), m_orphans.size(), m_newFaces.data(), m_newFaces.size());
+			}
+			return true;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_CONVEXHULL_H
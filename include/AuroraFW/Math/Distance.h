@@ -0,0 +1,434 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Distance.h
+ * Distance header. This contains closest point and distance queries
+ * between points and lines, segments, planes and triangles, for single
+ * points and for batches of points stored as structure of arrays.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_DISTANCE_H
+#define AURORAFW_MATH_DISTANCE_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+#include <AuroraFW/Math/SoA.h>
+
+#include <cmath>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * Returns the point of a line closest to the given point.
+		 * @param p The query point.
+		 * @param point A point of the line.
+		 * @param direction The direction of the line. It does not need to be normalized.
+		 * @return The closest point on the line.
+		 * @see vec3::distanceToLine()
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		vec3<T> closestPointOnLine(const vec3<T>& p, const vec3<T>& point, const vec3<T>& direction)
+		{
+			const vec3<T> ap(p.x - point.x, p.y - point.y, p.z - point.z);
+			const T t = ap.dot(direction) / direction.dot(direction);
+			return vec3<T>(point.x + direction.x * t, point.y + direction.y * t, point.z + direction.z * t);
+		}
+
+		/**
+		 * Returns the point of a segment closest to the given point.
+		 * @param p The query point.
+		 * @param a The start of the segment.
+		 * @param b The end of the segment.
+		 * @return The closest point on the segment.
+		 * @see distanceToSegment()
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		vec3<T> closestPointOnSegment(const vec3<T>& p, const vec3<T>& a, const vec3<T>& b)
+		{
+			const vec3<T> ab(b.x - a.x, b.y - a.y, b.z - a.z);
+			const vec3<T> ap(p.x - a.x, p.y - a.y, p.z - a.z);
+			const T len = ab.dot(ab);
+			T t = len > 0 ? ap.dot(ab) / len : T(0);
+			t = t < 0 ? T(0) : t > 1 ? T(1) : t;
+			return vec3<T>(a.x + ab.x * t, a.y + ab.y * t, a.z + ab.z * t);
+		}
+
+		/**
+		 * Returns the distance from a point to a segment.
+		 * @param p The query point.
+		 * @param a The start of the segment.
+		 * @param b The end of the segment.
+		 * @see closestPointOnSegment()
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		T distanceToSegment(const vec3<T>& p, const vec3<T>& a, const vec3<T>& b)
+		{
+			return p.distanceToPoint(closestPointOnSegment(p, a, b));
+		}
+
+		/**
+		 * Returns the signed distance from a point to a plane. The plane is
+		 * a vec4<T> (a, b, c, d) holding the points where
+		 * a*x + b*y + c*z + d = 0, as used by frustum. The distance is only
+		 * exact if (a, b, c) is normalized.
+		 * @param p The query point.
+		 * @param plane The plane.
+		 * @return The distance, positive on the side the normal points to.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		T distanceToPlane(const vec3<T>& p, const vec4<T>& plane)
+		{
+			return plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w;
+		}
+
+		/**
+		 * Returns the point of a triangle closest to the given point.
+		 * @param p The query point.
+		 * @param a The first triangle vertex.
+		 * @param b The second triangle vertex.
+		 * @param c The third triangle vertex.
+		 * @return The closest point on the triangle.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		vec3<T> closestPointOnTriangle(const vec3<T>& p, const vec3<T>& a, const vec3<T>& b, const vec3<T>& c)
+		{
+			// Voronoi region classification, see Ericson, Real-Time
+			// Collision Detection, 5.1.5.
+			const vec3<T> ab(b.x - a.x, b.y - a.y, b.z - a.z);
+			const vec3<T> ac(c.x - a.x, c.y - a.y, c.z - a.z);
+			const vec3<T> ap(p.x - a.x, p.y - a.y, p.z - a.z);
+			const T d1 = ab.dot(ap);
+			const T d2 = ac.dot(ap);
+			if(d1 <= 0 && d2 <= 0)
+				return a;
+
+			const vec3<T> bp(p.x - b.x, p.y - b.y, p.z - b.z);
+			const T d3 = ab.dot(bp);
+			const T d4 = ac.dot(bp);
+			if(d3 >= 0 && d4 <= d3)
+				return b;
+
+			const T vc = d1 * d4 - d3 * d2;
+			if(vc <= 0 && d1 >= 0 && d3 <= 0)
+			{
+				const T v = d1 / (d1 - d3);
+				return vec3<T>(a.x + ab.x * v, a.y + ab.y * v, a.z + ab.z * v);
+			}
+
+			const vec3<T> cp(p.x - c.x, p.y - c.y, p.z - c.z);
+			const T d5 = ab.dot(cp);
+			const T d6 = ac.dot(cp);
+			if(d6 >= 0 && d5 <= d6)
+				return c;
+
+			const T vb = d5 * d2 - d1 * d6;
+			if(vb <= 0 && d2 >= 0 && d6 <= 0)
+			{
+				const T w = d2 / (d2 - d6);
+				return vec3<T>(a.x + ac.x * w, a.y + ac.y * w, a.z + ac.z * w);
+			}
+
+			const T va = d3 * d6 - d5 * d4;
+			if(va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+			{
+				const T w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+				return vec3<T>(b.x + (c.x - b.x) * w, b.y + (c.y - b.y) * w, b.z + (c.z - b.z) * w);
+			}
+
+			const T denom = 1 / (va + vb + vc);
+			const T v = vb * denom;
+			const T w = vc * denom;
+			return vec3<T>(a.x + ab.x * v + ac.x * w, a.y + ab.y * v + ac.y * w, a.z + ab.z * v + ac.z * w);
+		}
+
+		// Batch kernels
+		/**
+		 * Computes the distance from many points to one line.
+		 * @param points The points, as a structure of arrays.
+		 * @param point A point of the line.
+		 * @param direction The direction of the line. It does not need to be normalized.
+		 * @param distances Receives one distance per point.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void distancesToLine(const vec3SoA<const T>& points, const vec3<T>& point, const vec3<T>& direction, T* distances)
+		{
+			const T ax = point.x, ay = point.y, az = point.z;
+			const T dx = direction.x, dy = direction.y, dz = direction.z;
+			const T inv = 1 / direction.dot(direction);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				T px = points.x[i] - ax, py = points.y[i] - ay, pz = points.z[i] - az;
+				const T t = (px * dx + py * dy + pz * dz) * inv;
+				px -= dx * t;
+				py -= dy * t;
+				pz -= dz * t;
+				distances[i] = std::sqrt(px * px + py * py + pz * pz);
+			}
+		}
+
+		/**
+		 * Computes the distance from many 2D points to one line.
+		 * @see distancesToLine(const vec3SoA<const T>& , const vec3<T>& , const vec3<T>& , T* )
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void distancesToLine(const vec2SoA<const T>& points, const vec2<T>& point, const vec2<T>& direction, T* distances)
+		{
+			// In 2D the distance is the cross product with the unit direction.
+			const T ax = point.x, ay = point.y;
+			const T invLen = 1 / std::sqrt(direction.dot(direction));
+			const T nx = direction.x * invLen, ny = direction.y * invLen;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+				distances[i] = std::fabs((points.x[i] - ax) * ny - (points.y[i] - ay) * nx);
+		}
+
+		/**
+		 * Computes the closest point of one line to many points.
+		 * @param points The points, as a structure of arrays.
+		 * @param point A point of the line.
+		 * @param direction The direction of the line. It does not need to be normalized.
+		 * @param closest Receives one point per input point. Must have room for points.size points.
+		 * @param t Receives, per point, the closest point as point + direction * t.
+		 * May be <code>nullptr</code>.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void closestPointsOnLine(const vec3SoA<const T>& points, const vec3<T>& point, const vec3<T>& direction,
+			const vec3SoA<T>& closest, T* t = nullptr)
+		{
+			const T ax = point.x, ay = point.y, az = point.z;
+			const T dx = direction.x, dy = direction.y, dz = direction.z;
+			const T inv = 1 / direction.dot(direction);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				const T s = ((points.x[i] - ax) * dx + (points.y[i] - ay) * dy + (points.z[i] - az) * dz) * inv;
+				closest.x[i] = ax + dx * s;
+				closest.y[i] = ay + dy * s;
+				closest.z[i] = az + dz * s;
+				if(t != nullptr)
+					t[i] = s;
+			}
+		}
+
+		/**
+		 * Computes the closest point of one 2D line to many points.
+		 * @see closestPointsOnLine(const vec3SoA<const T>& , const vec3<T>& , const vec3<T>& , const vec3SoA<T>& , T* )
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void closestPointsOnLine(const vec2SoA<const T>& points, const vec2<T>& point, const vec2<T>& direction,
+			const vec2SoA<T>& closest, T* t = nullptr)
+		{
+			const T ax = point.x, ay = point.y;
+			const T dx = direction.x, dy = direction.y;
+			const T inv = 1 / direction.dot(direction);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				const T s = ((points.x[i] - ax) * dx + (points.y[i] - ay) * dy) * inv;
+				closest.x[i] = ax + dx * s;
+				closest.y[i] = ay + dy * s;
+				if(t != nullptr)
+					t[i] = s;
+			}
+		}
+
+		/**
+		 * Computes the distance from many points to one segment.
+		 * @param points The points, as a structure of arrays.
+		 * @param a The start of the segment.
+		 * @param b The end of the segment.
+		 * @param distances Receives one distance per point.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void distancesToSegment(const vec3SoA<const T>& points, const vec3<T>& a, const vec3<T>& b, T* distances)
+		{
+			const T ax = a.x, ay = a.y, az = a.z;
+			const T dx = b.x - a.x, dy = b.y - a.y, dz = b.z - a.z;
+			const T len = dx * dx + dy * dy + dz * dz;
+			const T inv = len > 0 ? 1 / len : T(0);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				T px = points.x[i] - ax, py = points.y[i] - ay, pz = points.z[i] - az;
+				T t = (px * dx + py * dy + pz * dz) * inv;
+				t = t < 0 ? T(0) : t;
+				t = t > 1 ? T(1) : t;
+				px -= dx * t;
+				py -= dy * t;
+				pz -= dz * t;
+				distances[i] = std::sqrt(px * px + py * py + pz * pz);
+			}
+		}
+
+		/**
+		 * Computes the distance from many 2D points to one segment.
+		 * @see distancesToSegment(const vec3SoA<const T>& , const vec3<T>& , const vec3<T>& , T* )
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void distancesToSegment(const vec2SoA<const T>& points, const vec2<T>& a, const vec2<T>& b, T* distances)
+		{
+			const T ax = a.x, ay = a.y;
+			const T dx = b.x - a.x, dy = b.y - a.y;
+			const T len = dx * dx + dy * dy;
+			const T inv = len > 0 ? 1 / len : T(0);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				T px = points.x[i] - ax, py = points.y[i] - ay;
+				T t = (px * dx + py * dy) * inv;
+				t = t < 0 ? T(0) : t;
+				t = t > 1 ? T(1) : t;
+				px -= dx * t;
+				py -= dy * t;
+				distances[i] = std::sqrt(px * px + py * py);
+			}
+		}
+
+		/**
+		 * Computes the closest point of one segment to many points.
+		 * @param points The points, as a structure of arrays.
+		 * @param a The start of the segment.
+		 * @param b The end of the segment.
+		 * @param closest Receives one point per input point. Must have room for points.size points.
+		 * @param t Receives, per point, the closest point as a + (b - a) * t, with t in [0, 1].
+		 * May be <code>nullptr</code>.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void closestPointsOnSegment(const vec3SoA<const T>& points, const vec3<T>& a, const vec3<T>& b,
+			const vec3SoA<T>& closest, T* t = nullptr)
+		{
+			const T ax = a.x, ay = a.y, az = a.z;
+			const T dx = b.x - a.x, dy = b.y - a.y, dz = b.z - a.z;
+			const T len = dx * dx + dy * dy + dz * dz;
+			const T inv = len > 0 ? 1 / len : T(0);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				T s = ((points.x[i] - ax) * dx + (points.y[i] - ay) * dy + (points.z[i] - az) * dz) * inv;
+				s = s < 0 ? T(0) : s;
+				s = s > 1 ? T(1) : s;
+				closest.x[i] = ax + dx * s;
+				closest.y[i] = ay + dy * s;
+				closest.z[i] = az + dz * s;
+				if(t != nullptr)
+					t[i] = s;
+			}
+		}
+
+		/**
+		 * Computes the closest point of one 2D segment to many points.
+		 * @see closestPointsOnSegment(const vec3SoA<const T>& , const vec3<T>& , const vec3<T>& , const vec3SoA<T>& , T* )
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void closestPointsOnSegment(const vec2SoA<const T>& points, const vec2<T>& a, const vec2<T>& b,
+			const vec2SoA<T>& closest, T* t = nullptr)
+		{
+			const T ax = a.x, ay = a.y;
+			const T dx = b.x - a.x, dy = b.y - a.y;
+			const T len = dx * dx + dy * dy;
+			const T inv = len > 0 ? 1 / len : T(0);
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				T s = ((points.x[i] - ax) * dx + (points.y[i] - ay) * dy) * inv;
+				s = s < 0 ? T(0) : s;
+				s = s > 1 ? T(1) : s;
+				closest.x[i] = ax + dx * s;
+				closest.y[i] = ay + dy * s;
+				if(t != nullptr)
+					t[i] = s;
+			}
+		}
+
+		/**
+		 * Computes the signed distance from many points to one plane.
+		 * @param points The points, as a structure of arrays.
+		 * @param plane The plane, as in distanceToPlane(). Its normal does
+		 * not need to be normalized.
+		 * @param distances Receives one signed distance per point.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void distancesToPlane(const vec3SoA<const T>& points, const vec4<T>& plane, T* distances)
+		{
+			const T inv = 1 / std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			const T a = plane.x * inv, b = plane.y * inv, c = plane.z * inv, d = plane.w * inv;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+				distances[i] = a * points.x[i] + b * points.y[i] + c * points.z[i] + d;
+		}
+
+		/**
+		 * Projects many points onto one plane.
+		 * @param points The points, as a structure of arrays.
+		 * @param plane The plane, as in distanceToPlane(). Its normal does
+		 * not need to be normalized.
+		 * @param projected Receives one point per input point. Must have room for points.size points.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void projectOntoPlane(const vec3SoA<const T>& points, const vec4<T>& plane, const vec3SoA<T>& projected)
+		{
+			const T inv = 1 / std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+			const T a = plane.x * inv, b = plane.y * inv, c = plane.z * inv, d = plane.w * inv;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < points.size; i++)
+			{
+				const T s = a * points.x[i] + b * points.y[i] + c * points.z[i] + d;
+				projected.x[i] = points.x[i] - a * s;
+				projected.y[i] = points.y[i] - b * s;
+				projected.z[i] = points.z[i] - c * s;
+			}
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_DISTANCE_H
@@ -0,0 +1,605 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/DoubleWord.h
+ * Double-word arithmetic header. This contains the doubleWord scalar,
+ * a float or double carried as an unevaluated sum of two, and
+ * compensated sum, dot product and accumulation kernels for vec spans.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_DOUBLEWORD_H
+#define AURORAFW_MATH_DOUBLEWORD_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector.h>
+#include <AuroraFW/Math/Interval.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		namespace Internal {
+			// Enables an overload for floating point types wider than T,
+			// which doubleWord<T> holds exactly rather than narrowing.
+			template<typename T, typename U>
+			using doubleWordWider = typename std::enable_if<(sizeof(U) > sizeof(T)) && std::is_floating_point<U>::value>::type;
+		}
+
+		/**
+		 * A number stored as the unevaluated sum hi + lo of two floats or
+		 * two doubles, with |lo| at most half a unit in the last place of
+		 * hi. A doubleWord<float> has a 48 bit significand, close to the
+		 * 53 bits of a double, while every operation runs on floats: it
+		 * keeps positions far from the origin exact to well under a
+		 * millimetre where a float would round to metres. It works as the
+		 * T of vec2, vec3, vec4 and mat.
+		 *
+		 * The operations are the double-word algorithms of Joldes, Muller
+		 * and Popescu, "Tight and rigorous error bounds for basic building
+		 * blocks of double-word arithmetic": the relative error of a sum
+		 * is below 3u², of a product below 5u² and of a quotient below
+		 * 10u², where u is the unit roundoff of T. They rely on IEEE
+		 * rounding, so they break under -ffast-math or any other option
+		 * that reassociates floating-point operations. With FMA support
+		 * they use it for the exact products.
+		 *
+		 * Wider numbers, e.g. a double for a doubleWord<float>, convert
+		 * to the nearest double-word value and take part in the
+		 * operators that way, so DoubleFloat x = 0.1 and x + 0.1 do not
+		 * round 0.1 to float first.
+		 * @tparam T float or double.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API doubleWord {
+			static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "doubleWord needs float or double words");
+
+			/** Constructs zero.
+			 * @since snapshot20261019
+			 */
+			constexpr doubleWord() : hi(0), lo(0) {}
+
+			/** Constructs a value representable in T.
+			 * @since snapshot20261019
+			 */
+			constexpr doubleWord(T v) : hi(v), lo(0) {}
+
+			/** Constructs hi + lo. The parts are normalized, so they do
+			 * not need to be.
+			 * @since snapshot20261019
+			 */
+			doubleWord(T , T );
+
+			/** Constructs the value nearest to a wider number, e.g. a
+			 * double for a doubleWord<float>.
+			 * @since snapshot20261019
+			 */
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			doubleWord(U v) : hi(T(v)), lo(T(v - U(T(v)))) {}
+
+			/** Returns hi + lo rounded to T.
+			 * @since snapshot20261019
+			 */
+			explicit operator T() const { return hi + lo; }
+
+			/** Returns hi + lo in a wider type, e.g. double for a
+			 * doubleWord<float>.
+			 * @since snapshot20261019
+			 */
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			explicit operator U() const { return U(hi) + U(lo); }
+
+			doubleWord operator-() const { return doubleWord(-hi, -lo, 0); }
+			doubleWord& operator+=(const doubleWord& );
+			doubleWord& operator-=(const doubleWord& );
+			doubleWord& operator*=(const doubleWord& );
+			doubleWord& operator/=(const doubleWord& );
+			doubleWord& operator+=(T );
+			doubleWord& operator-=(T );
+			doubleWord& operator*=(T );
+			doubleWord& operator/=(T );
+
+			// Wider numbers would otherwise be narrowed to T by the
+			// overloads above.
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			doubleWord& operator+=(U b) { return *this += doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			doubleWord& operator-=(U b) { return *this -= doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			doubleWord& operator*=(U b) { return *this *= doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			doubleWord& operator/=(U b) { return *this /= doubleWord(b); }
+
+			// Friends rather than templates, so mixed expressions like
+			// 2.0f * x convert the other operand. Operations with a plain
+			// T use the cheaper algorithms.
+			friend doubleWord operator+(doubleWord a, const doubleWord& b) { return a += b; }
+			friend doubleWord operator-(doubleWord a, const doubleWord& b) { return a -= b; }
+			friend doubleWord operator*(doubleWord a, const doubleWord& b) { return a *= b; }
+			friend doubleWord operator/(doubleWord a, const doubleWord& b) { return a /= b; }
+			friend doubleWord operator+(doubleWord a, T b) { return a += b; }
+			friend doubleWord operator-(doubleWord a, T b) { return a -= b; }
+			friend doubleWord operator*(doubleWord a, T b) { return a *= b; }
+			friend doubleWord operator/(doubleWord a, T b) { return a /= b; }
+			friend doubleWord operator+(T a, doubleWord b) { return b += a; }
+			friend doubleWord operator-(T a, const doubleWord& b) { return -b + a; }
+			friend doubleWord operator*(T a, doubleWord b) { return b *= a; }
+			friend doubleWord operator/(T a, const doubleWord& b) { return doubleWord(a) /= b; }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator+(doubleWord a, U b) { return a += doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator-(doubleWord a, U b) { return a -= doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator*(doubleWord a, U b) { return a *= doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator/(doubleWord a, U b) { return a /= doubleWord(b); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator+(U a, doubleWord b) { return b += doubleWord(a); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator-(U a, const doubleWord& b) { return doubleWord(a) -= b; }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator*(U a, doubleWord b) { return b *= doubleWord(a); }
+			template<typename U, typename = Internal::doubleWordWider<T, U>>
+			friend doubleWord operator/(U a, const doubleWord& b) { return doubleWord(a) /= b; }
+
+			// Normalized values compare by their parts.
+			friend bool operator==(const doubleWord& a, const doubleWord& b) { return a.hi == b.hi && a.lo == b.lo; }
+			friend bool operator!=(const doubleWord& a, const doubleWord& b) { return !(a == b); }
+			friend bool operator<(const doubleWord& a, const doubleWord& b) { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+			friend bool operator>(const doubleWord& a, const doubleWord& b) { return b < a; }
+			friend bool operator<=(const doubleWord& a, const doubleWord& b) { return !(b < a); }
+			friend bool operator>=(const doubleWord& a, const doubleWord& b) { return !(a < b); }
+
+			/** The rounded value. */
+			T hi;
+			/** The rounding error of hi. */
+			T lo;
+
+		private:
+			// Takes parts that are already normalized.
+			constexpr doubleWord(T h, T l, int) : hi(h), lo(l) {}
+		};
+		typedef doubleWord<float> DoubleFloat;
+		typedef doubleWord<double> DoubleDouble;
+
+		/**
+		 * Returns the square root. Negative values give NaN.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		doubleWord<T> sqrt(const doubleWord<T>& );
+
+		/**
+		 * Returns the absolute value.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		doubleWord<T> abs(const doubleWord<T>& );
+
+		template<typename T>
+		std::ostream& operator<<(std::ostream& , const doubleWord<T>& );
+
+		/**
+		 * Returns the coordinates of a double-word vector rounded to T.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		vec<T, N> narrow(const vec<doubleWord<T>, N>& );
+
+		/**
+		 * Returns the sum of the vectors, accumulated in double-word
+		 * precision in several independent lanes and returned unrounded.
+		 * Large spans are split across threads; the result does not
+		 * depend on the thread count.
+		 * @param in The vectors.
+		 * @param count The number of vectors.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		vec<doubleWord<T>, N> compensatedSum(const vec<T, N>* , size_t );
+
+		/**
+		 * Returns the sum of the values, computed as if in twice the
+		 * precision of T.
+		 * @see compensatedSum()
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		doubleWord<T> compensatedSum(const T* , size_t );
+
+		/**
+		 * Returns the dot product, computed as if in twice the precision of
+		 * T (Ogita, Rump and Oishi's Dot2).
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		doubleWord<T> compensatedDot(const vec<T, N>& , const vec<T, N>& );
+
+		/**
+		 * Returns the sum of the dot products of two spans of vectors, the
+		 * dot product of the spans as flat arrays, computed as if in twice
+		 * the precision of T. Large spans are split across threads.
+		 * @param a The first vectors.
+		 * @param b The second vectors.
+		 * @param count The number of vectors in each span.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		doubleWord<T> compensatedDot(const vec<T, N>* , const vec<T, N>* , size_t );
+
+		/**
+		 * Computes the dot product of each pair of vectors as if in twice
+		 * the precision of T, rounded to T: nearly correctly rounded even
+		 * when the terms cancel, as in plane tests far from the origin.
+		 * @param a The first vectors.
+		 * @param b The second vectors.
+		 * @param count The number of vectors in each span.
+		 * @param out Receives the dot products.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		void compensatedDot(const vec<T, N>* , const vec<T, N>* , size_t , T* );
+
+		/**
+		 * Adds scale * delta[i] to acc[i] for every vector: a step of
+		 * positions kept in double-word precision with velocities and time
+		 * steps stored as T. The product is added exactly before rounding.
+		 * @param acc The accumulated vectors.
+		 * @param delta The vectors to add.
+		 * @param count The number of vectors.
+		 * @param scale The factor for every delta, e.g. the time step.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		void accumulate(vec<doubleWord<T>, N>* , const vec<T, N>* , size_t , T );
+
+		namespace Internal {
+			constexpr size_t DoubleWordGrain = 1 << 16;
+
+			// Independent accumulators per kernel, enough to hide the
+			// latency of the error free transformations and fill a vector
+			// register.
+			constexpr size_t DoubleWordLanes = 8;
+
+			// a * b = x + y exactly, with the fused multiply-add when there
+			// is one.
+			template<typename T>
+			inline void exactProduct(T a, T b, T& x, T& y)
+			{
+#ifdef __FMA__
+				x = a * b;
+				y = std::fma(a, b, -x);
+#else
+				twoProduct(a, b, x, y);
+#endif
+			}
+
+			// a * b + c, fused when there is hardware for it.
+			template<typename T>
+			inline T multiplyAdd(T a, T b, T c)
+			{
+#ifdef __FMA__
+				return std::fma(a, b, c);
+#else
+				return a * b + c;
+#endif
+			}
+
+			// The flat coordinates of a span of vectors.
+			template<typename T, size_t N>
+			inline const T* doubleWordFlat(const vec<T, N>* v)
+			{
+				static_assert(sizeof(vec<T, N>) == N * sizeof(T), "vec is not tightly packed");
+				return reinterpret_cast<const T*>(v);
+			}
+
+			// Adds b + e, where |e| is much smaller than |b|, to the
+			// double-word s + c. Sum2 would leave c unnormalized; over
+			// millions of floats the plain sum of errors in c then loses
+			// more than the compensation gains, so c is folded back into s
+			// at every step.
+			template<typename T>
+			inline void doubleWordAdd(T& s, T& c, T b, T e)
+			{
+				T sh, sl;
+				twoSum(s, b, sh, sl);
+				fastTwoSum(sh, c + (sl + e), s, c);
+			}
+
+			// The sum of x[0, count) into L lanes of double-word sums s + c,
+			// where lane k takes the elements i with i % L == k. Independent
+			// lanes vectorize; the tail is added to the first lanes.
+			template<typename T, size_t L>
+			void compensatedSumRange(const T* x, size_t count, T* s, T* c)
+			{
+				size_t i = 0;
+				for(; i + L <= count; i += L)
+				{
+					AFW_MATH_SIMD_LOOP
+					for(size_t k = 0; k < L; k++)
+						doubleWordAdd(s[k], c[k], x[i + k], T(0));
+				}
+				for(size_t k = 0; i < count; i++, k++)
+					doubleWordAdd(s[k], c[k], x[i], T(0));
+			}
+
+			// The dot product of x[0, count) and y[0, count), laid out as
+			// above, adding each product exactly.
+			template<typename T, size_t L>
+			void compensatedDotRange(const T* x, const T* y, size_t count, T* s, T* c)
+			{
+				size_t i = 0;
+				for(; i + L <= count; i += L)
+				{
+					AFW_MATH_SIMD_LOOP
+					for(size_t k = 0; k < L; k++)
+					{
+						T p, pe;
+						exactProduct(x[i + k], y[i + k], p, pe);
+						doubleWordAdd(s[k], c[k], p, pe);
+					}
+				}
+				for(size_t k = 0; i < count; i++, k++)
+				{
+					T p, pe;
+					exactProduct(x[i], y[i], p, pe);
+					doubleWordAdd(s[k], c[k], p, pe);
+				}
+			}
+
+			// Runs a lane kernel over a flat span of N-vectors in blocks of
+			// DoubleWordGrain vectors, split across threads, and adds up the
+			// lanes of every block in a fixed order, so the result does not
+			// depend on the thread count.
+			template<typename T, size_t N, typename F>
+			vec<doubleWord<T>, N> compensatedReduce(size_t count, F kernel)
+			{
+				constexpr size_t L = N * DoubleWordLanes;
+				const size_t blocks = (count + DoubleWordGrain - 1) / DoubleWordGrain;
+				std::vector<T> partial(blocks * 2 * L, T(0));
+				parallelFor(blocks, 1, [&](size_t begin, size_t end, size_t) {
+					for(size_t block = begin; block < end; block++)
+					{
+						const size_t first = block * DoubleWordGrain;
+						const size_t size = std::min(count - first, DoubleWordGrain);
+						T* s = &partial[block * 2 * L];
+						kernel(first * N, size * N, s, s + L);
+					}
+				});
+
+				vec<doubleWord<T>, N> r;
+				for(size_t block = 0; block < blocks; block++)
+					for(size_t k = 0; k < L; k++)
+						r[k % N] += doubleWord<T>(partial[block * 2 * L + k], partial[block * 2 * L + L + k]);
+				return r;
+			}
+		}
+
+		// Inline definitions
+		template<typename T>
+		inline doubleWord<T>::doubleWord(T h, T l)
+		{
+			Internal::twoSum(h, l, hi, lo);
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator+=(const doubleWord& b)
+		{
+			// Algorithm 6 (AccurateDWPlusDW).
+			T sh, sl, th, tl;
+			Internal::twoSum(hi, b.hi, sh, sl);
+			Internal::twoSum(lo, b.lo, th, tl);
+			T vh, vl;
+			Internal::fastTwoSum(sh, sl + th, vh, vl);
+			Internal::fastTwoSum(vh, tl + vl, hi, lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator-=(const doubleWord& b)
+		{
+			return *this += -b;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator*=(const doubleWord& b)
+		{
+			// Algorithm 12 (DWTimesDW3).
+			T ch, cl;
+			Internal::exactProduct(hi, b.hi, ch, cl);
+			const T tl = Internal::multiplyAdd(hi, b.lo, lo * b.lo);
+			Internal::fastTwoSum(ch, cl + Internal::multiplyAdd(lo, b.hi, tl), hi, lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator/=(const doubleWord& b)
+		{
+			// Algorithm 17 (DWDivDW2).
+			const T th = hi / b.hi;
+			const doubleWord r = b * th;
+			const T d = (hi - r.hi) + (lo - r.lo);
+			Internal::fastTwoSum(th, d / b.hi, hi, lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator+=(T b)
+		{
+			// Algorithm 4 (DWPlusFP).
+			T sh, sl;
+			Internal::twoSum(hi, b, sh, sl);
+			Internal::fastTwoSum(sh, lo + sl, hi, lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator-=(T b)
+		{
+			return *this += -b;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator*=(T b)
+		{
+			// Algorithm 9 (DWTimesFP3).
+			T ch, cl;
+			Internal::exactProduct(hi, b, ch, cl);
+			Internal::fastTwoSum(ch, Internal::multiplyAdd(lo, b, cl), hi, lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline doubleWord<T>& doubleWord<T>::operator/=(T b)
+		{
+			// Algorithm 15 (DWDivFP3).
+			const T th = hi / b;
+			T ph, pl;
+			Internal::exactProduct(th, b, ph, pl);
+			const T d = ((hi - ph) - pl) + lo;
+			Internal::fastTwoSum(th, d / b, hi, lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline doubleWord<T> sqrt(const doubleWord<T>& x)
+		{
+			// One Newton step from the T square root, with the residual
+			// x - s² computed exactly enough by the double-word operations.
+			using std::sqrt;
+			const T s = sqrt(x.hi);
+			if(!(s > 0) || std::isinf(s))
+				return doubleWord<T>(s);
+			T p, pe;
+			Internal::exactProduct(s, s, p, pe);
+			const T r = ((x.hi - p) - pe) + x.lo;
+			return doubleWord<T>(s, r / (2 * s));
+		}
+
+		template<typename T>
+		inline doubleWord<T> abs(const doubleWord<T>& x)
+		{
+			return x.hi < 0 ? -x : x;
+		}
+
+		template<typename T>
+		inline std::ostream& operator<<(std::ostream& o, const doubleWord<T>& x)
+		{
+			// A long double holds both words of a doubleWord<float>; for
+			// doubles, it is as exact as the platform allows.
+			return o << (static_cast<long double>(x.hi) + x.lo);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> narrow(const vec<doubleWord<T>, N>& v)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = T(v[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline doubleWord<T> compensatedDot(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			T s, c;
+			Internal::exactProduct(a[0], b[0], s, c);
+			Internal::vecUnroll<1, N>::apply([&](size_t i) {
+				T p, pe, e;
+				Internal::exactProduct(a[i], b[i], p, pe);
+				Internal::twoSum(s, p, s, e);
+				c += pe + e;
+			});
+			return doubleWord<T>(s, c);
+		}
+
+		// Template implementation
+		template<typename T, size_t N>
+		vec<doubleWord<T>, N> compensatedSum(const vec<T, N>* in, size_t count)
+		{
+			const T* x = Internal::doubleWordFlat(in);
+			return Internal::compensatedReduce<T, N>(count, [x](size_t begin, size_t size, T* s, T* c) {
+				Internal::compensatedSumRange<T, N * Internal::DoubleWordLanes>(x + begin, size, s, c);
+			});
+		}
+
+		template<typename T>
+		doubleWord<T> compensatedSum(const T* in, size_t count)
+		{
+			return compensatedSum(reinterpret_cast<const vec<T, 1>*>(in), count)[0];
+		}
+
+		template<typename T, size_t N>
+		doubleWord<T> compensatedDot(const vec<T, N>* a, const vec<T, N>* b, size_t count)
+		{
+			const T* x = Internal::doubleWordFlat(a);
+			const T* y = Internal::doubleWordFlat(b);
+			const vec<doubleWord<T>, N> r = Internal::compensatedReduce<T, N>(count, [x, y](size_t begin, size_t size, T* s, T* c) {
+				Internal::compensatedDotRange<T, N * Internal::DoubleWordLanes>(x + begin, y + begin, size, s, c);
+			});
+			doubleWord<T> sum = r[0];
+			Internal::vecUnroll<1, N>::apply([&](size_t i) { sum += r[i]; });
+			return sum;
+		}
+
+		template<typename T, size_t N>
+		void compensatedDot(const vec<T, N>* a, const vec<T, N>* b, size_t count, T* out)
+		{
+			parallelFor(count, Internal::DoubleWordGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					const doubleWord<T> d = compensatedDot(a[i], b[i]);
+					out[i] = d.hi + d.lo;
+				}
+			});
+		}
+
+		template<typename T, size_t N>
+		void accumulate(vec<doubleWord<T>, N>* acc, const vec<T, N>* delta, size_t count, T scale)
+		{
+			static_assert(sizeof(vec<doubleWord<T>, N>) == N * sizeof(doubleWord<T>), "vec is not tightly packed");
+			doubleWord<T>* a = reinterpret_cast<doubleWord<T>*>(acc);
+			const T* d = Internal::doubleWordFlat(delta);
+			parallelFor(count * N, Internal::DoubleWordGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					// The exact product is already normalized.
+					doubleWord<T> p;
+					Internal::exactProduct(d[i], scale, p.hi, p.lo);
+					a[i] += p;
+				}
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_DOUBLEWORD_H
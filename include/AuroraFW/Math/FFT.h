@@ -0,0 +1,988 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/FFT.h
+ * Fast Fourier transform header. This contains complex and real FFT
+ * plans in one and two dimensions, a plan cache, and FFT based linear
+ * convolution, including a streaming overlap-add convolver.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_FFT_H
+#define AURORAFW_MATH_FFT_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * Returns the smallest size of at least n whose only prime factors
+		 * are 2, 3 and 5, the sizes the FFT plans are fastest at.
+		 * @since snapshot20261019
+		 */
+		AFW_API inline size_t fftGoodSize(size_t n)
+		{
+			if(n <= 1)
+				return 1;
+			for(;; n++)
+			{
+				size_t m = n;
+				while(m % 2 == 0) m /= 2;
+				while(m % 3 == 0) m /= 3;
+				while(m % 5 == 0) m /= 5;
+				if(m == 1)
+					return n;
+			}
+		}
+
+		/**
+		 * A complex FFT plan for one size. The constructor factors the size
+		 * into radix 4, 2, 3 and 5 stages (other primes use a generic
+		 * butterfly) and precomputes the twiddle factors and the input
+		 * permutation, so transforms only do arithmetic. Temporary arrays
+		 * come from per-thread buffers that are kept between calls, so once
+		 * a thread has run a size, transforms of it allocate nothing.
+		 *
+		 * forward() is unnormalized and inverse() divides by the size, so
+		 * inverse(forward(x)) is x. Plans are immutable and can be shared
+		 * between threads; cached() returns shared plans by size.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API fft {
+		public:
+			typedef std::complex<T> complex;
+
+			/** Constructs a plan.
+			 * @param size The transform size.
+			 * @since snapshot20261019
+			 */
+			explicit fft(size_t );
+
+			/** Returns the transform size.
+			 * @since snapshot20261019
+			 */
+			size_t size() const;
+
+			/** Computes the forward transform. The input and the output may be the same array.
+			 * @param in The size() input values.
+			 * @param out Receives the size() output values.
+			 * @since snapshot20261019
+			 */
+			void forward(const complex* , complex* ) const;
+
+			/** Computes the normalized inverse transform. The input and the
+			 * output may be the same array.
+			 * @param in The size() input values.
+			 * @param out Receives the size() output values.
+			 * @since snapshot20261019
+			 */
+			void inverse(const complex* , complex* ) const;
+
+			/** Returns the shared plan of the given size, building it on first use.
+			 * @since snapshot20261019
+			 */
+			static std::shared_ptr<const fft<T>> cached(size_t );
+
+		private:
+			template<bool Inverse>
+			void transform(const complex* , complex* ) const;
+
+			size_t m_size;
+			std::vector<uint32_t> m_factors;
+			std::vector<size_t> m_permutation;
+			std::vector<complex> m_twiddles;
+		};
+		typedef fft<float> FFT;
+
+		/**
+		 * A real FFT plan. The spectrum of n real values is hermitian, so
+		 * only its first n / 2 + 1 values are produced. Even sizes run a
+		 * complex transform of half the size.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API realFFT {
+		public:
+			typedef std::complex<T> complex;
+
+			/** Constructs a plan.
+			 * @param size The number of real values.
+			 * @since snapshot20261019
+			 */
+			explicit realFFT(size_t );
+
+			/** Returns the number of real values.
+			 * @since snapshot20261019
+			 */
+			size_t size() const;
+
+			/** Returns the number of spectrum values, size() / 2 + 1.
+			 * @since snapshot20261019
+			 */
+			size_t spectrumSize() const;
+
+			/** Computes the spectrum of real values.
+			 * @param in The size() real values.
+			 * @param out Receives the spectrumSize() spectrum values.
+			 * @since snapshot20261019
+			 */
+			void forward(const T* , complex* ) const;
+
+			/** Computes real values back from their spectrum, normalized so
+			 * inverse(forward(x)) is x.
+			 * @param in The spectrumSize() spectrum values.
+			 * @param out Receives the size() real values.
+			 * @since snapshot20261019
+			 */
+			void inverse(const complex* , T* ) const;
+
+			/** Returns the shared plan of the given size, building it on first use.
+			 * @since snapshot20261019
+			 */
+			static std::shared_ptr<const realFFT<T>> cached(size_t );
+
+		private:
+			size_t m_size;
+			std::shared_ptr<const fft<T>> m_plan;
+			std::vector<complex> m_twiddles;
+		};
+		typedef realFFT<float> RealFFT;
+
+		/**
+		 * A 2D complex FFT over row-major data: a transform of every row,
+		 * then of every column. Both passes are split across threads, and
+		 * columns are transformed in small batches gathered row by row so
+		 * memory is read in contiguous runs.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API fft2D {
+		public:
+			typedef std::complex<T> complex;
+
+			/** Constructs a plan.
+			 * @param rows The number of rows.
+			 * @param cols The number of columns.
+			 * @since snapshot20261019
+			 */
+			fft2D(size_t , size_t );
+
+			size_t rows() const;
+			size_t cols() const;
+
+			/** Computes the forward transform. The input and the output may be the same array.
+			 * @since snapshot20261019
+			 */
+			void forward(const complex* , complex* ) const;
+
+			/** Computes the normalized inverse transform. The input and the
+			 * output may be the same array.
+			 * @since snapshot20261019
+			 */
+			void inverse(const complex* , complex* ) const;
+
+		private:
+			size_t m_rows, m_cols;
+			std::shared_ptr<const fft<T>> m_rowPlan, m_colPlan;
+		};
+		typedef fft2D<float> FFT2D;
+
+		/**
+		 * A 2D real FFT over row-major data. The spectrum has rows() rows
+		 * of cols() / 2 + 1 values.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API realFFT2D {
+		public:
+			typedef std::complex<T> complex;
+
+			/** Constructs a plan.
+			 * @param rows The number of rows.
+			 * @param cols The number of columns.
+			 * @since snapshot20261019
+			 */
+			realFFT2D(size_t , size_t );
+
+			size_t rows() const;
+			size_t cols() const;
+
+			/** Returns the number of spectrum values per row, cols() / 2 + 1.
+			 * @since snapshot20261019
+			 */
+			size_t spectrumCols() const;
+
+			/** Computes the spectrum of real values.
+			 * @param in The rows() * cols() real values.
+			 * @param out Receives the rows() * spectrumCols() spectrum values.
+			 * @since snapshot20261019
+			 */
+			void forward(const T* , complex* ) const;
+
+			/** Computes real values back from their spectrum.
+			 * @param in The rows() * spectrumCols() spectrum values.
+			 * @param out Receives the rows() * cols() real values.
+			 * @since snapshot20261019
+			 */
+			void inverse(const complex* , T* ) const;
+
+		private:
+			size_t m_rows, m_cols;
+			std::shared_ptr<const realFFT<T>> m_rowPlan;
+			std::shared_ptr<const fft<T>> m_colPlan;
+		};
+		typedef realFFT2D<float> RealFFT2D;
+
+		/**
+		 * Streaming linear convolution with a fixed kernel by overlap-add.
+		 * The input is cut into blocks, each block is convolved through a
+		 * real FFT of at least blockSize() + kernelSize() - 1 values and the
+		 * overlapping tails are added up, so a stream of any length costs
+		 * O(log n) per sample.
+		 *
+		 * Output sample i is sum(kernel[k] * input[i - k]), so process()
+		 * returns as many samples as it is given and flush() returns the
+		 * remaining kernelSize() - 1.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API convolver {
+		public:
+			/** Constructs a convolver.
+			 * @param kernel The kernel values.
+			 * @param kernelSize The number of kernel values, at least 1.
+			 * @param blockSize The number of input values per FFT block.
+			 * 0 picks one from the kernel size.
+			 * @since snapshot20261019
+			 */
+			convolver(const T* , size_t , size_t = 0);
+
+			/** Convolves the next values of the stream. The input and the
+			 * output may be the same array.
+			 * @param in The input values.
+			 * @param count The number of values.
+			 * @param out Receives count output values.
+			 * @since snapshot20261019
+			 */
+			void process(const T* , size_t , T* );
+
+			/** Writes the last kernelSize() - 1 output values of the stream and
+			 * resets the convolver.
+			 * @since snapshot20261019
+			 */
+			void flush(T* );
+
+			/** Forgets the values seen so far.
+			 * @since snapshot20261019
+			 */
+			void reset();
+
+			size_t kernelSize() const;
+			size_t blockSize() const;
+
+		private:
+			size_t m_kernelSize, m_blockSize;
+			std::shared_ptr<const realFFT<T>> m_plan;
+			std::vector<std::complex<T>> m_kernel;
+			std::vector<std::complex<T>> m_spectrum;
+			std::vector<T> m_block;
+			std::vector<T> m_overlap;
+		};
+		typedef convolver<float> Convolver;
+
+		/**
+		 * Computes the full linear convolution of two sequences through a
+		 * real FFT.
+		 * @param a The first sequence.
+		 * @param aSize The length of the first sequence.
+		 * @param b The second sequence.
+		 * @param bSize The length of the second sequence.
+		 * @param out Receives aSize + bSize - 1 values.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void convolve(const T* , size_t , const T* , size_t , T* );
+
+		namespace Internal {
+			constexpr size_t FFTGrain = 1 << 14;
+			constexpr size_t FFTColumnBatch = 8;
+
+			// A temporary array taken from a per-thread stack of buffers and
+			// given back on destruction. Transforms nest, and a thread waiting
+			// in parallelFor() may run other transforms meanwhile, so buffers
+			// are taken rather than shared. Each nesting level keeps reusing
+			// the buffer it grew, so steady use allocates nothing.
+			template<typename T>
+			class fftScratch {
+			public:
+				explicit fftScratch(size_t n)
+				{
+					std::vector<std::vector<std::complex<T>>>& free = buffers();
+					if(!free.empty())
+					{
+						m_buffer.swap(free.back());
+						free.pop_back();
+					}
+					if(m_buffer.size() < n)
+						m_buffer.resize(n);
+				}
+
+				~fftScratch()
+				{
+					buffers().push_back(std::move(m_buffer));
+				}
+
+				fftScratch(const fftScratch& ) = delete;
+				fftScratch& operator=(const fftScratch& ) = delete;
+
+				std::complex<T>* data()
+				{
+					return m_buffer.data();
+				}
+
+			private:
+				static std::vector<std::vector<std::complex<T>>>& buffers()
+				{
+					static thread_local std::vector<std::vector<std::complex<T>>> free;
+					return free;
+				}
+
+				std::vector<std::complex<T>> m_buffer;
+			};
+
+			// Complex products written out, since std::complex multiplication
+			// checks for infinities and does not vectorize.
+			template<bool Conjugate, typename T>
+			inline std::complex<T> fftMul(const std::complex<T>& a, const std::complex<T>& w)
+			{
+				const T wi = Conjugate ? -w.imag() : w.imag();
+				return std::complex<T>(a.real() * w.real() - a.imag() * wi, a.real() * wi + a.imag() * w.real());
+			}
+
+			// Multiplies by -i in the forward direction and by i in the inverse one.
+			template<bool Inverse, typename T>
+			inline std::complex<T> fftRotate(const std::complex<T>& a)
+			{
+				return Inverse ? std::complex<T>(-a.imag(), a.real()) : std::complex<T>(a.imag(), -a.real());
+			}
+
+			// A stage combines n / (m * radix) groups of radix sub-transforms
+			// of size m. Twiddle j * (radix - 1) + r - 1 applies to input r
+			// of butterfly j.
+			template<bool Inverse, typename T>
+			void fftRadix2(std::complex<T>* x, size_t n, size_t m, const std::complex<T>* tw)
+			{
+				for(size_t b = 0; b < n; b += 2 * m)
+				{
+					std::complex<T>* p = x + b;
+					AFW_MATH_SIMD_LOOP
+					for(size_t j = 0; j < m; j++)
+					{
+						const std::complex<T> a0 = p[j];
+						const std::complex<T> a1 = fftMul<Inverse>(p[j + m], tw[j]);
+						p[j] = a0 + a1;
+						p[j + m] = a0 - a1;
+					}
+				}
+			}
+
+			template<bool Inverse, typename T>
+			void fftRadix3(std::complex<T>* x, size_t n, size_t m, const std::complex<T>* tw)
+			{
+				const T c = T(-0.5), s = T(0.86602540378443864676);
+				for(size_t b = 0; b < n; b += 3 * m)
+				{
+					std::complex<T>* p = x + b;
+					AFW_MATH_SIMD_LOOP
+					for(size_t j = 0; j < m; j++)
+					{
+						const std::complex<T> a0 = p[j];
+						const std::complex<T> a1 = fftMul<Inverse>(p[j + m], tw[2 * j]);
+						const std::complex<T> a2 = fftMul<Inverse>(p[j + 2 * m], tw[2 * j + 1]);
+						const std::complex<T> t1 = a1 + a2;
+						const std::complex<T> t2 = a0 + c * t1;
+						const std::complex<T> t3 = s * fftRotate<Inverse>(a1 - a2);
+						p[j] = a0 + t1;
+						p[j + m] = t2 + t3;
+						p[j + 2 * m] = t2 - t3;
+					}
+				}
+			}
+
+			template<bool Inverse, typename T>
+			void fftRadix4(std::complex<T>* x, size_t n, size_t m, const std::complex<T>* tw)
+			{
+				for(size_t b = 0; b < n; b += 4 * m)
+				{
+					std::complex<T>* p = x + b;
+					AFW_MATH_SIMD_LOOP
+					for(size_t j = 0; j < m; j++)
+					{
+						const std::complex<T> a0 = p[j];
+						const std::complex<T> a1 = fftMul<Inverse>(p[j + m], tw[3 * j]);
+						const std::complex<T> a2 = fftMul<Inverse>(p[j + 2 * m], tw[3 * j + 1]);
+						const std::complex<T> a3 = fftMul<Inverse>(p[j + 3 * m], tw[3 * j + 2]);
+						const std::complex<T> s02 = a0 + a2, d02 = a0 - a2;
+						const std::complex<T> s13 = a1 + a3, d13 = fftRotate<Inverse>(a1 - a3);
+						p[j] = s02 + s13;
+						p[j + m] = d02 + d13;
+						p[j + 2 * m] = s02 - s13;
+						p[j + 3 * m] = d02 - d13;
+					}
+				}
+			}
+
+			template<bool Inverse, typename T>
+			void fftRadix5(std::complex<T>* x, size_t n, size_t m, const std::complex<T>* tw)
+			{
+				const T c1 = T(0.30901699437494742410), c2 = T(-0.80901699437494742410);
+				const T s1 = T(0.95105651629515357212), s2 = T(0.58778525229247312917);
+				for(size_t b = 0; b < n; b += 5 * m)
+				{
+					std::complex<T>* p = x + b;
+					AFW_MATH_SIMD_LOOP
+					for(size_t j = 0; j < m; j++)
+					{
+						const std::complex<T> a0 = p[j];
+						const std::complex<T> a1 = fftMul<Inverse>(p[j + m], tw[4 * j]);
+						const std::complex<T> a2 = fftMul<Inverse>(p[j + 2 * m], tw[4 * j + 1]);
+						const std::complex<T> a3 = fftMul<Inverse>(p[j + 3 * m], tw[4 * j + 2]);
+						const std::complex<T> a4 = fftMul<Inverse>(p[j + 4 * m], tw[4 * j + 3]);
+						const std::complex<T> s14 = a1 + a4, d14 = a1 - a4;
+						const std::complex<T> s23 = a2 + a3, d23 = a2 - a3;
+						const std::complex<T> e1 = a0 + c1 * s14 + c2 * s23;
+						const std::complex<T> e2 = a0 + c2 * s14 + c1 * s23;
+						const std::complex<T> o1 = fftRotate<Inverse>(s1 * d14 + s2 * d23);
+						const std::complex<T> o2 = fftRotate<Inverse>(s2 * d14 - s1 * d23);
+						p[j] = a0 + s14 + s23;
+						p[j + m] = e1 + o1;
+						p[j + 2 * m] = e2 + o2;
+						p[j + 3 * m] = e2 - o2;
+						p[j + 4 * m] = e1 - o1;
+					}
+				}
+			}
+
+			// Any other prime radix, as a direct DFT per butterfly.
+			template<bool Inverse, typename T>
+			void fftRadixGeneric(std::complex<T>* x, size_t n, size_t m, size_t radix, const std::complex<T>* tw)
+			{
+				fftScratch<T> scratch(2 * radix);
+				std::complex<T>* roots = scratch.data();
+				std::complex<T>* a = roots + radix;
+				for(size_t k = 0; k < radix; k++)
+					roots[k] = std::polar(T(1), T(-2 * 3.14159265358979323846 * double(k) / double(radix)));
+
+				for(size_t b = 0; b < n; b += radix * m)
+					for(size_t j = 0; j < m; j++)
+					{
+						std::complex<T>* p = x + b + j;
+						a[0] = p[0];
+						for(size_t r = 1; r < radix; r++)
+							a[r] = fftMul<Inverse>(p[r * m], tw[j * (radix - 1) + r - 1]);
+						for(size_t q = 0; q < radix; q++)
+						{
+							std::complex<T> acc = a[0];
+							for(size_t r = 1; r < radix; r++)
+								acc += fftMul<Inverse>(a[r], roots[r * q % radix]);
+							p[q * m] = acc;
+						}
+					}
+			}
+
+			template<typename T>
+			inline std::complex<T> fftTwiddle(size_t k, size_t n)
+			{
+				const double angle = -2 * 3.14159265358979323846 * double(k) / double(n);
+				return std::complex<T>(T(std::cos(angle)), T(std::sin(angle)));
+			}
+
+			// Transforms the columns of a row-major rows x cols array, in
+			// batches of FFTColumnBatch columns.
+			template<bool Inverse, typename T>
+			void fftColumns(const fft<T>& plan, std::complex<T>* data, size_t rows, size_t cols)
+			{
+				const size_t batches = (cols + FFTColumnBatch - 1) / FFTColumnBatch;
+				const size_t grain = std::max<size_t>(1, FFTGrain / (rows * FFTColumnBatch));
+				parallelFor(batches, grain, [&](size_t begin, size_t end, size_t) {
+					fftScratch<T> scratch(rows * FFTColumnBatch);
+					std::complex<T>* columns = scratch.data();
+					for(size_t batch = begin; batch < end; batch++)
+					{
+						const size_t c0 = batch * FFTColumnBatch;
+						const size_t width = std::min(FFTColumnBatch, cols - c0);
+						for(size_t r = 0; r < rows; r++)
+							for(size_t c = 0; c < width; c++)
+								columns[c * rows + r] = data[r * cols + c0 + c];
+						for(size_t c = 0; c < width; c++)
+						{
+							std::complex<T>* column = &columns[c * rows];
+							if(Inverse)
+								plan.inverse(column, column);
+							else
+								plan.forward(column, column);
+						}
+						for(size_t r = 0; r < rows; r++)
+							for(size_t c = 0; c < width; c++)
+								data[r * cols + c0 + c] = columns[c * rows + r];
+					}
+				});
+			}
+		}
+
+		// Template implementation
+		template<typename T>
+		fft<T>::fft(size_t size)
+			: m_size(size)
+		{
+			// Stages run in the order of m_factors, the first one combining
+			// single values.
+			size_t n = size;
+			while(n > 1 && n % 4 == 0) { m_factors.push_back(4); n /= 4; }
+			while(n > 1 && n % 2 == 0) { m_factors.push_back(2); n /= 2; }
+			while(n > 1 && n % 3 == 0) { m_factors.push_back(3); n /= 3; }
+			while(n > 1 && n % 5 == 0) { m_factors.push_back(5); n /= 5; }
+			for(size_t p = 7; n > 1; p += 2)
+			{
+				if(p * p > n)
+					p = n;
+				while(n % p == 0) { m_factors.push_back(uint32_t(p)); n /= p; }
+			}
+
+			// Decimation in time: the last stage splits the input by its
+			// radix, so the input index of an output position is its digit
+			// reversal in the mixed radix of the stages, last stage first.
+			m_permutation.assign(size, 0);
+			for(size_t pos = 0; pos < size; pos++)
+			{
+				size_t rest = pos, index = 0, stride = 1, block = size;
+				for(size_t s = m_factors.size(); s-- > 0;)
+				{
+					block /= m_factors[s];
+					index += (rest / block) * stride;
+					rest %= block;
+					stride *= m_factors[s];
+				}
+				m_permutation[pos] = index;
+			}
+
+			size_t m = 1;
+			for(uint32_t radix : m_factors)
+			{
+				for(size_t j = 0; j < m; j++)
+					for(size_t r = 1; r < radix; r++)
+						m_twiddles.push_back(Internal::fftTwiddle<T>(j * r, m * radix));
+				m *= radix;
+			}
+		}
+
+		template<typename T>
+		size_t fft<T>::size() const
+		{
+			return m_size;
+		}
+
+		template<typename T>
+		template<bool Inverse>
+		void fft<T>::transform(const complex* in, complex* out) const
+		{
+			// The permutation is not in place, so an in-place call first
+			// copies the input aside.
+			Internal::fftScratch<T> copy(in == out ? m_size : 0);
+			if(in == out)
+			{
+				std::copy(in, in + m_size, copy.data());
+				in = copy.data();
+			}
+
+			for(size_t i = 0; i < m_size; i++)
+				out[i] = in[m_permutation[i]];
+
+			const complex* tw = m_twiddles.data();
+			size_t m = 1;
+			for(uint32_t radix : m_factors)
+			{
+				switch(radix)
+				{
+					case 2: Internal::fftRadix2<Inverse>(out, m_size, m, tw); break;
+					case 3: Internal::fftRadix3<Inverse>(out, m_size, m, tw); break;
+					case 4: Internal::fftRadix4<Inverse>(out, m_size, m, tw); break;
+					case 5: Internal::fftRadix5<Inverse>(out, m_size, m, tw); break;
+					default: Internal::fftRadixGeneric<Inverse>(out, m_size, m, radix, tw); break;
+				}
+				tw += m * (radix - 1);
+				m *= radix;
+			}
+
+			if(Inverse && m_size > 0)
+			{
+				const T scale = T(1) / T(m_size);
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = 0; i < m_size; i++)
+					out[i] *= scale;
+			}
+		}
+
+		template<typename T>
+		void fft<T>::forward(const complex* in, complex* out) const
+		{
+			transform<false>(in, out);
+		}
+
+		template<typename T>
+		void fft<T>::inverse(const complex* in, complex* out) const
+		{
+			transform<true>(in, out);
+		}
+
+		template<typename T>
+		std::shared_ptr<const fft<T>> fft<T>::cached(size_t size)
+		{
+			static std::mutex mutex;
+			static std::map<size_t, std::shared_ptr<const fft<T>>> plans;
+
+			std::lock_guard<std::mutex> lock(mutex);
+			std::shared_ptr<const fft<T>>& plan = plans[size];
+			if(!plan)
+				plan = std::make_shared<fft<T>>(size);
+			return plan;
+		}
+
+		template<typename T>
+		realFFT<T>::realFFT(size_t size)
+			: m_size(size)
+		{
+			if(size % 2 == 0)
+			{
+				m_plan = fft<T>::cached(size / 2);
+				m_twiddles.resize(size / 2 + 1);
+				for(size_t k = 0; k <= size / 2; k++)
+					m_twiddles[k] = Internal::fftTwiddle<T>(k, size);
+			}
+			else
+				m_plan = fft<T>::cached(size);
+		}
+
+		template<typename T>
+		size_t realFFT<T>::size() const
+		{
+			return m_size;
+		}
+
+		template<typename T>
+		size_t realFFT<T>::spectrumSize() const
+		{
+			return m_size / 2 + 1;
+		}
+
+		template<typename T>
+		void realFFT<T>::forward(const T* in, complex* out) const
+		{
+			if(m_size % 2 != 0)
+			{
+				Internal::fftScratch<T> scratch(m_size);
+				complex* z = scratch.data();
+				std::copy(in, in + m_size, z);
+				m_plan->forward(z, z);
+				std::copy(z, z + spectrumSize(), out);
+				return;
+			}
+			if(m_size == 0)
+			{
+				out[0] = complex();
+				return;
+			}
+
+			// Even and odd values as one complex sequence of half the size,
+			// then split with Z[k] = E[k] + i O[k], X[k] = E[k] + W^k O[k].
+			const size_t h = m_size / 2;
+			Internal::fftScratch<T> scratch(h);
+			complex* z = scratch.data();
+			for(size_t k = 0; k < h; k++)
+				z[k] = complex(in[2 * k], in[2 * k + 1]);
+			m_plan->forward(z, z);
+
+			for(size_t k = 0; k <= h; k++)
+			{
+				const complex zk = z[k % h];
+				const complex zc = std::conj(z[(h - k) % h]);
+				const complex e = T(0.5) * (zk + zc);
+				const complex d = zk - zc;
+				const complex o(T(0.5) * d.imag(), T(-0.5) * d.real());
+				out[k] = e + Internal::fftMul<false>(o, m_twiddles[k]);
+			}
+		}
+
+		template<typename T>
+		void realFFT<T>::inverse(const complex* in, T* out) const
+		{
+			if(m_size % 2 != 0)
+			{
+				Internal::fftScratch<T> scratch(m_size);
+				complex* z = scratch.data();
+				for(size_t k = 0; k < spectrumSize(); k++)
+				{
+					z[k] = in[k];
+					if(k > 0)
+						z[m_size - k] = std::conj(in[k]);
+				}
+				m_plan->inverse(z, z);
+				for(size_t i = 0; i < m_size; i++)
+					out[i] = z[i].real();
+				return;
+			}
+			if(m_size == 0)
+				return;
+
+			const size_t h = m_size / 2;
+			Internal::fftScratch<T> scratch(h);
+			complex* z = scratch.data();
+			for(size_t k = 0; k < h; k++)
+			{
+				const complex xk = in[k];
+				const complex xc = std::conj(in[h - k]);
+				const complex e = T(0.5) * (xk + xc);
+				const complex o = Internal::fftMul<true>(T(0.5) * (xk - xc), m_twiddles[k]);
+				z[k] = e + complex(-o.imag(), o.real());
+			}
+			m_plan->inverse(z, z);
+			for(size_t k = 0; k < h; k++)
+			{
+				out[2 * k] = z[k].real();
+				out[2 * k + 1] = z[k].imag();
+			}
+		}
+
+		template<typename T>
+		std::shared_ptr<const realFFT<T>> realFFT<T>::cached(size_t size)
+		{
+			static std::mutex mutex;
+			static std::map<size_t, std::shared_ptr<const realFFT<T>>> plans;
+
+			std::lock_guard<std::mutex> lock(mutex);
+			std::shared_ptr<const realFFT<T>>& plan = plans[size];
+			if(!plan)
+				plan = std::make_shared<realFFT<T>>(size);
+			return plan;
+		}
+
+		template<typename T>
+		fft2D<T>::fft2D(size_t rows, size_t cols)
+			: m_rows(rows), m_cols(cols),
+			m_rowPlan(fft<T>::cached(cols)), m_colPlan(fft<T>::cached(rows))
+		{}
+
+		template<typename T>
+		size_t fft2D<T>::rows() const
+		{
+			return m_rows;
+		}
+
+		template<typename T>
+		size_t fft2D<T>::cols() const
+		{
+			return m_cols;
+		}
+
+		template<typename T>
+		void fft2D<T>::forward(const complex* in, complex* out) const
+		{
+			parallelFor(m_rows, std::max<size_t>(1, Internal::FFTGrain / std::max<size_t>(1, m_cols)), [&](size_t begin, size_t end, size_t) {
+				for(size_t r = begin; r < end; r++)
+					m_rowPlan->forward(in + r * m_cols, out + r * m_cols);
+			});
+			Internal::fftColumns<false>(*m_colPlan, out, m_rows, m_cols);
+		}
+
+		template<typename T>
+		void fft2D<T>::inverse(const complex* in, complex* out) const
+		{
+			parallelFor(m_rows, std::max<size_t>(1, Internal::FFTGrain / std::max<size_t>(1, m_cols)), [&](size_t begin, size_t end, size_t) {
+				for(size_t r = begin; r < end; r++)
+					m_rowPlan->inverse(in + r * m_cols, out + r * m_cols);
+			});
+			Internal::fftColumns<true>(*m_colPlan, out, m_rows, m_cols);
+		}
+
+		template<typename T>
+		realFFT2D<T>::realFFT2D(size_t rows, size_t cols)
+			: m_rows(rows), m_cols(cols),
+			m_rowPlan(realFFT<T>::cached(cols)), m_colPlan(fft<T>::cached(rows))
+		{}
+
+		template<typename T>
+		size_t realFFT2D<T>::rows() const
+		{
+			return m_rows;
+		}
+
+		template<typename T>
+		size_t realFFT2D<T>::cols() const
+		{
+			return m_cols;
+		}
+
+		template<typename T>
+		size_t realFFT2D<T>::spectrumCols() const
+		{
+			return m_cols / 2 + 1;
+		}
+
+		template<typename T>
+		void realFFT2D<T>::forward(const T* in, complex* out) const
+		{
+			const size_t width = spectrumCols();
+			parallelFor(m_rows, std::max<size_t>(1, Internal::FFTGrain / std::max<size_t>(1, m_cols)), [&](size_t begin, size_t end, size_t) {
+				for(size_t r = begin; r < end; r++)
+					m_rowPlan->forward(in + r * m_cols, out + r * width);
+			});
+			Internal::fftColumns<false>(*m_colPlan, out, m_rows, width);
+		}
+
+		template<typename T>
+		void realFFT2D<T>::inverse(const complex* in, T* out) const
+		{
+			const size_t width = spectrumCols();
+			// The columns are transformed in place, so the input is copied
+			// aside first.
+			Internal::fftScratch<T> scratch(m_rows * width);
+			complex* spectrum = scratch.data();
+			std::copy(in, in + m_rows * width, spectrum);
+			Internal::fftColumns<true>(*m_colPlan, spectrum, m_rows, width);
+			parallelFor(m_rows, std::max<size_t>(1, Internal::FFTGrain / std::max<size_t>(1, m_cols)), [&](size_t begin, size_t end, size_t) {
+				for(size_t r = begin; r < end; r++)
+					m_rowPlan->inverse(spectrum + r * width, out + r * m_cols);
+			});
+		}
+
+		template<typename T>
+		convolver<T>::convolver(const T* kernel, size_t kernelSize, size_t blockSize)
+			: m_kernelSize(std::max<size_t>(1, kernelSize))
+		{
+			// Blocks about as long as the kernel keep the FFT work per
+			// output sample near its minimum.
+			if(blockSize == 0)
+				blockSize = std::max<size_t>(m_kernelSize, 256);
+			const size_t n = fftGoodSize(blockSize + m_kernelSize - 1);
+			m_blockSize = n - m_kernelSize + 1;
+			m_plan = realFFT<T>::cached(n);
+
+			m_block.assign(n, T(0));
+			std::copy(kernel, kernel + kernelSize, m_block.begin());
+			m_kernel.resize(m_plan->spectrumSize());
+			m_plan->forward(m_block.data(), m_kernel.data());
+			m_spectrum.resize(m_plan->spectrumSize());
+			m_overlap.assign(n, T(0));
+		}
+
+		template<typename T>
+		void convolver<T>::process(const T* in, size_t count, T* out)
+		{
+			while(count > 0)
+			{
+				const size_t len = std::min(count, m_blockSize);
+				std::copy(in, in + len, m_block.begin());
+				std::fill(m_block.begin() + len, m_block.end(), T(0));
+
+				m_plan->forward(m_block.data(), m_spectrum.data());
+				for(size_t k = 0; k < m_spectrum.size(); k++)
+					m_spectrum[k] = Internal::fftMul<false>(m_spectrum[k], m_kernel[k]);
+				m_plan->inverse(m_spectrum.data(), m_block.data());
+
+				const size_t tail = len + m_kernelSize - 1;
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = 0; i < tail; i++)
+					m_overlap[i] += m_block[i];
+				std::copy(m_overlap.begin(), m_overlap.begin() + len, out);
+				std::copy(m_overlap.begin() + len, m_overlap.begin() + tail, m_overlap.begin());
+				std::fill(m_overlap.begin() + (tail - len), m_overlap.begin() + tail, T(0));
+
+				in += len;
+				out += len;
+				count -= len;
+			}
+		}
+
+		template<typename T>
+		void convolver<T>::flush(T* out)
+		{
+			std::copy(m_overlap.begin(), m_overlap.begin() + (m_kernelSize - 1), out);
+			reset();
+		}
+
+		template<typename T>
+		void convolver<T>::reset()
+		{
+			std::fill(m_overlap.begin(), m_overlap.end(), T(0));
+		}
+
+		template<typename T>
+		size_t convolver<T>::kernelSize() const
+		{
+			return m_kernelSize;
+		}
+
+		template<typename T>
+		size_t convolver<T>::blockSize() const
+		{
+			return m_blockSize;
+		}
+
+		template<typename T>
+		void convolve(const T* a, size_t aSize, const T* b, size_t bSize, T* out)
+		{
+			if(aSize == 0 || bSize == 0)
+				return;
+
+			const size_t size = aSize + bSize - 1;
+			const std::shared_ptr<const realFFT<T>> plan = realFFT<T>::cached(fftGoodSize(size));
+			std::vector<T> x(plan->size(), T(0)), y(plan->size(), T(0));
+			std::copy(a, a + aSize, x.begin());
+			std::copy(b, b + bSize, y.begin());
+
+			std::vector<std::complex<T>> fx(plan->spectrumSize()), fy(plan->spectrumSize());
+			plan->forward(x.data(), fx.data());
+			plan->forward(y.data(), fy.data());
+			for(size_t k = 0; k < fx.size(); k++)
+				fx[k] = Internal::fftMul<false>(fx[k], fy[k]);
+			plan->inverse(fx.data(), x.data());
+			std::copy(x.begin(), x.begin() + size, out);
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_FFT_H
@@ -0,0 +1,645 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Fixed.h
+ * Fixed-point header. This contains the Q-format fixed-point scalar
+ * for bit-exact math across platforms, with its square root, table
+ * based trigonometry and bulk kernels.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_FIXED_H
+#define AURORAFW_MATH_FIXED_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A signed fixed-point number in Q format: a raw integer I holding
+		 * the value times 2^F. Every operation is integer arithmetic, so
+		 * results are bit-exact on every platform and compiler, which is
+		 * what lockstep simulations need. It works as the T of vec2, vec3,
+		 * vec4 and mat; length() and normalize() then use the exact integer
+		 * sqrt() below.
+		 *
+		 * Addition, subtraction and multiplication wrap around on overflow;
+		 * multiplication rounds to nearest. Division truncates toward zero
+		 * and saturates, including on division by zero. Conversions from
+		 * floating point round to nearest and saturate.
+		 * @tparam I int32_t or int64_t.
+		 * @tparam F The number of fractional bits.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		struct AFW_API fixed {
+			static_assert(std::is_same<I, int32_t>::value || std::is_same<I, int64_t>::value, "fixed needs int32_t or int64_t storage");
+			// The trigonometry rounds Q62 and Q61 constants to F bits, so F
+			// stays below 61.
+			static_assert(F > 0 && F < int(sizeof(I) * 8) - 1 && F <= 60, "invalid number of fractional bits");
+
+			/** Constructs a zero.
+			 * @since snapshot20261019
+			 */
+			constexpr fixed() : raw(0) {}
+
+			/** Constructs the nearest fixed-point value to a number.
+			 * @since snapshot20261019
+			 */
+			template<typename A, typename = typename std::enable_if<std::is_arithmetic<A>::value>::type>
+			fixed(A );
+
+			/** Returns the value as a float.
+			 * @since snapshot20261019
+			 */
+			explicit operator float() const;
+
+			/** Returns the value as a double.
+			 * @since snapshot20261019
+			 */
+			explicit operator double() const;
+
+			/** Returns the integer part, rounded toward negative infinity.
+			 * @since snapshot20261019
+			 */
+			I floor() const;
+
+			/** Returns the value with the given raw integer.
+			 * @since snapshot20261019
+			 */
+			static fixed fromRaw(I );
+
+			/** Returns pi, rounded to nearest.
+			 * @since snapshot20261019
+			 */
+			static fixed pi();
+
+			/** Returns the smallest positive value, 2^-F.
+			 * @since snapshot20261019
+			 */
+			static fixed epsilon();
+
+			fixed operator-() const;
+			fixed& operator+=(const fixed& );
+			fixed& operator-=(const fixed& );
+			fixed& operator*=(const fixed& );
+			fixed& operator/=(const fixed& );
+
+			// Friends rather than templates, so mixed expressions like
+			// 2.0f * x convert the other operand.
+			friend fixed operator+(fixed a, const fixed& b) { return a += b; }
+			friend fixed operator-(fixed a, const fixed& b) { return a -= b; }
+			friend fixed operator*(fixed a, const fixed& b) { return a *= b; }
+			friend fixed operator/(fixed a, const fixed& b) { return a /= b; }
+
+			friend bool operator==(const fixed& a, const fixed& b) { return a.raw == b.raw; }
+			friend bool operator!=(const fixed& a, const fixed& b) { return a.raw != b.raw; }
+			friend bool operator<(const fixed& a, const fixed& b) { return a.raw < b.raw; }
+			friend bool operator>(const fixed& a, const fixed& b) { return a.raw > b.raw; }
+			friend bool operator<=(const fixed& a, const fixed& b) { return a.raw <= b.raw; }
+			friend bool operator>=(const fixed& a, const fixed& b) { return a.raw >= b.raw; }
+
+			/** The value times 2^F. */
+			I raw;
+		};
+		typedef fixed<int32_t, 16> Fixed16_16;
+		typedef fixed<int64_t, 32> Fixed32_32;
+
+		/**
+		 * Returns the square root, exact to the last bit (rounded down).
+		 * Negative values give zero.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		fixed<I, F> sqrt(const fixed<I, F>& );
+
+		/**
+		 * Returns the sine of an angle in radians, from a quarter wave table
+		 * with cubic Hermite interpolation. The error is below 1e-11 plus
+		 * the rounding to F bits, and the result is the same everywhere.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		fixed<I, F> sin(const fixed<I, F>& );
+
+		/**
+		 * Returns the cosine of an angle in radians.
+		 * @see sin()
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		fixed<I, F> cos(const fixed<I, F>& );
+
+		/**
+		 * Returns the tangent of an angle in radians, as sin() / cos().
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		fixed<I, F> tan(const fixed<I, F>& );
+
+		/**
+		 * Converts degrees to radians.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		fixed<I, F> toRadians(const fixed<I, F>& );
+
+		/**
+		 * Converts radians to degrees.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		fixed<I, F> toDegrees(const fixed<I, F>& );
+
+		/**
+		 * Converts a span of floats to fixed-point values.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		void convert(const float* , fixed<I, F>* , size_t );
+
+		/**
+		 * Converts a span of fixed-point values to floats.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		void convert(const fixed<I, F>* , float* , size_t );
+
+		/**
+		 * Multiplies two spans element by element. With 32 bit storage the
+		 * loop is plain 64 bit integer arithmetic and vectorizes.
+		 * @param a The first factors.
+		 * @param b The second factors.
+		 * @param out Receives the products. May be one of the inputs.
+		 * @param count The number of values.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		void multiply(const fixed<I, F>* , const fixed<I, F>* , fixed<I, F>* , size_t );
+
+		/**
+		 * Computes the dot products of two spans of vectors.
+		 * @param a The first vectors.
+		 * @param b The second vectors.
+		 * @param out Receives the dot products.
+		 * @param count The number of vectors.
+		 * @since snapshot20261019
+		 */
+		template<typename I, int F>
+		void dot(const vec3<fixed<I, F>>* , const vec3<fixed<I, F>>* , fixed<I, F>* , size_t );
+
+		namespace Internal {
+			constexpr size_t FixedGrain = 1 << 16;
+
+			// sin(k * pi / 512) * 2^62 for k in [0, 256], correctly rounded.
+			static const int64_t FixedSinTable[257] = {
+				0ll, 28296773447188932ll, 56592481536850979ll, 84886058951569363ll,
+				113176440454146016ll, 141462560927707152ll, 169743355415804323ll, 198017759162509421ll,
+				226284707652502141ll, 254543136651148378ll, 282791982244568062ll, 311030180879690912ll,
+				339256669404298611ll, 367470385107051883ll, 395670265757500976ll, 423855249646078038ll,
+				452024275624069880ll, 480176283143569630ll, 508310212297405757ll, 536425003859046981ll,
+				564519599322481549ll, 592592940942069394ll, 620643971772365654ll, 648671635707914075ll,
+				676674877523008785ll, 704652642911422941ll, 732603878526102765ll, 760527532018825469ll,
+				788422552079819562ll, 816287888477346079ll, 844122492097239204ll, 871925314982404829ll,
+				899695310372275547ll, 927431432742220595ll, 955132637842909263ll, 982797882739626295ll,
+				1010426125851537790ll, 1038016326990906130ll, 1065567447402252463ll, 1093078449801465257ll,
+				1120548298414853464ll, 1147975959018142810ll, 1175360398975413759ll, 1202700587277979668ll,
+				1229995494583203681ll, 1257244093253252900ll, 1284445357393788370ll, 1311598262892589414ll,
+				1338701787458110889ll, 1365754910657971875ll, 1392756613957374385ll, 1419705880757450621ll,
+				1446601696433537347ll, 1473443048373375936ll, 1500228926015236645ll, 1526958320885965697ll,
+				1553630226638953726ll, 1580243639092024153ll, 1606797556265240081ll, 1633290978418628274ll,
+				1659722908089818799ll, 1686092350131598923ll, 1712398311749379842ll, 1738639802538574835ll,
+				1764815834521887442ll, 1790925422186508242ll, 1816967582521218861ll, 1842941335053401787ll,
+				1868845701885954606ll, 1894679707734107280ll, 1920442379962141067ll, 1946132748620007700ll,
+				1971749846479847467ll, 1997292709072404788ll, 2022760374723339936ll, 2048151884589435536ll,
+				2073466282694696471ll, 2098702615966341831ll, 2123859934270687573ll, 2148937290448918513ll,
+				2173933740352748318ll, 2198848342879966161ll, 2223680160009868681ll, 2248428256838575938ll,
+				2273091701614230011ll, 2297669565772074934ll, 2322160923969416627ll, 2346564854120461533ll,
+				2370880437431032621ll, 2395106758433161473ll, 2419242905019555129ll, 2443287968477936418ll,
+				2467241043525256456ll, 2491101228341778045ll, 2514867624605028673ll, 2538539337523621850ll,
+				2562115475870945497ll, 2585595152018716126ll, 2608977481970397539ll, 2632261585394482801ll,
+				2655446585657638225ll, 2678531609857708118ll, 2701515788856579055ll, 2724398257312902439ll,
+				2747178153714674114ll, 2769854620411669802ll, 2792426803647735152ll, 2814893853592929176ll,
+				2837254924375519865ll, 2859509174113830783ll, 2881655764947937435ll, 2903693863071212222ll,
+				2925622638761716784ll, 2947441266413440569ll, 2969148924567384428ll, 2990744795942488082ll,
+				3012228067466400296ll, 3033597930306090586ll, 3054853579898301336ll, 3075994215979839139ll,
+				3097019042617704261ll, 3117927268239057068ll, 3138718105661020291ll, 3159390772120316024ll,
+				3179944489302736311ll, 3200378483372446242ll, 3220691985001118434ll, 3240884229396897804ll,
+				3260954456333195553ll, 3280901910177311269ll, 3300725839918882066ll, 3320425499198157706ll,
+				3340000146334100615ll, 3359449044352309761ll, 3378771461012767319ll, 3397966668837407099ll,
+				3417033945137503676ll, 3435972572040881222ll, 3454781836518940978ll, 3473461030413506385ll,
+				3492009450463484836ll, 3510426398331345059ll, 3528711180629409129ll, 3546863108945958126ll,
+				3564881499871150442ll, 3582765675022751780ll, 3600514961071675858ll, 3618128689767334873ll,
+				3635606197962798751ll, 3652946827639762261ll, 3670149925933319029ll, 3687214845156541534ll,
+				3704140942824866152ll, 3720927581680282339ll, 3737574129715325036ll, 3754079960196869392ll,
+				3770444451689726907ll, 3786666988080042126ll, 3802746958598488966ll, 3818683757843265844ll,
+				3834476785802888710ll, 3850125447878781140ll, 3865629154907660636ll, 3880987323183720291ll,
+				3896199374480604983ll, 3911264736073181271ll, 3926182840759100170ll, 3940953126880152004ll,
+				3955575038343412514ll, 3970048024642179445ll, 3984371540876698815ll, 3998545047774680078ll,
+				4012568011711599423ll, 4026439904730790436ll, 4040160204563321371ll, 4053728394647658278ll,
+				4067143964149113252ll, 4080406407979077076ll, 4093515226814035515ll, 4106469927114368566ll,
+				4119270021142931949ll, 4131915026983420130ll, 4144404468558510201ll, 4156737875647785922ll,
+				4168914783905441250ll, 4180934734877762701ll, 4192797276020389871ll, 4204501960715353476ll,
+				4216048348287890265ll, 4227436004023034176ll, 4238664499181983110ll, 4249733411018240704ll,
+				4260642322793532497ll, 4271390823793495892ll, 4281978509343143317ll, 4292404980822098011ll,
+				4302669845679601858ll, 4312772717449294698ll, 4322713215763764567ll, 4332490966368868320ll,
+				4342105601137822079ll, 4351556758085061009ll, 4360844081379867860ll, 4369967221359769800ll,
+				4378925834543703005ll, 4387719583644944529ll, 4396348137583810956ll, 4404811171500123367ll,
+				4413108366765438139ll, 4421239410995043127ll, 4429203998059718770ll, 4437001828097263686ll,
+				4444632607523784314ll, 4452096049044748178ll, 4459391871665800370ll, 4466519800703342820ll,
+				4473479567794875989ll, 4480270910909102555ll, 4486893574355792752ll, 4493347308795410955ll,
+				4499631871248503178ll, 4505747025104845112ll, 4511692540132350364ll, 4517468192485738568ll,
+				4523073764714963030ll, 4528509045773397601ll, 4533773831025782466ll, 4538867922255928541ll,
+				4543791127674180203ll, 4548543261924636061ll, 4553124146092127503ll, 4557533607708954749ll,
+				4561771480761380163ll, 4565837605695878577ll, 4569731829425144391ll, 4573454005333855221ll,
+				4577003993284191887ll, 4580381659621114521ll, 4583586877177394601ll, 4586619525278402729ll,
+				4589479489746651964ll, 4592166662906096533ll, 4594680943586185780ll, 4597022237125673177ll,
+				4599190455376180266ll, 4601185516705515398ll, 4603007346000747137ll, 4604655874671032219ll,
+				4606131040650197959ll, 4607432788399079011ll, 4608561068907608378ll, 4609515839696662623ll,
+				4610297064819661174ll, 4610904714863919703ll, 4611338766951757487ll, 4611599204741358747ll,
+				4611686018427387904ll
+			};
+
+			// pi * 2^61, pi / 512 * 2^62 and 2^64 / (2 pi), rounded.
+			constexpr int64_t FixedPi61 = 7244019458077122842ll;
+			constexpr int64_t FixedSinStep62 = 28296951008113761ll;
+			constexpr uint64_t FixedTurn64 = 2935890503282001226ull;
+
+			// Full 128 bit products, with a portable fallback that gives
+			// the same bits.
+			inline void fixedUMul128(uint64_t a, uint64_t b, uint64_t& hi, uint64_t& lo)
+			{
+#if defined(__SIZEOF_INT128__)
+				__extension__ typedef unsigned __int128 uint128;
+				const uint128 p = uint128(a) * b;
+				hi = uint64_t(p >> 64);
+				lo = uint64_t(p);
+#else
+				const uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32, b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+				const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+				const uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+				hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+				lo = (mid << 32) | (p00 & 0xFFFFFFFFu);
+#endif
+			}
+
+			inline void fixedMul128(int64_t a, int64_t b, int64_t& hi, uint64_t& lo)
+			{
+				uint64_t h;
+				fixedUMul128(uint64_t(a), uint64_t(b), h, lo);
+				h -= a < 0 ? uint64_t(b) : 0;
+				h -= b < 0 ? uint64_t(a) : 0;
+				hi = int64_t(h);
+			}
+
+			// (a * b + 2^(s - 1)) >> s, wrapped to 64 bits, for 0 < s < 64.
+			inline int64_t fixedMulShift(int64_t a, int64_t b, int s)
+			{
+				int64_t hi;
+				uint64_t lo;
+				fixedMul128(a, b, hi, lo);
+				const uint64_t half = uint64_t(1) << (s - 1);
+				const uint64_t sum = lo + half;
+				const uint64_t h = uint64_t(hi) + (sum < lo ? 1 : 0);
+				return int64_t((sum >> s) | (h << (64 - s)));
+			}
+
+			inline int32_t fixedMul(int32_t a, int32_t b, int f)
+			{
+				return int32_t((int64_t(a) * b + (int64_t(1) << (f - 1))) >> f);
+			}
+
+			inline int64_t fixedMul(int64_t a, int64_t b, int f)
+			{
+				return fixedMulShift(a, b, f);
+			}
+
+			inline int32_t fixedDiv(int32_t a, int32_t b, int f)
+			{
+				if(b == 0)
+					return a >= 0 ? std::numeric_limits<int32_t>::max() : std::numeric_limits<int32_t>::min();
+				const int64_t q = (int64_t(a) * (int64_t(1) << f)) / b;
+				return q > std::numeric_limits<int32_t>::max() ? std::numeric_limits<int32_t>::max()
+					: q < std::numeric_limits<int32_t>::min() ? std::numeric_limits<int32_t>::min() : int32_t(q);
+			}
+
+			inline int64_t fixedDiv(int64_t a, int64_t b, int f)
+			{
+				if(b == 0)
+					return a >= 0 ? std::numeric_limits<int64_t>::max() : std::numeric_limits<int64_t>::min();
+
+				// Long division of |a| * 2^f by |b|, truncating toward zero.
+				const bool negative = (a < 0) != (b < 0);
+				const uint64_t ua = a < 0 ? 0 - uint64_t(a) : uint64_t(a);
+				const uint64_t ub = b < 0 ? 0 - uint64_t(b) : uint64_t(b);
+				const uint64_t limit = negative ? uint64_t(1) << 63 : (uint64_t(1) << 63) - 1;
+#if defined(__SIZEOF_INT128__)
+				__extension__ typedef unsigned __int128 uint128;
+				const uint128 q = (uint128(ua) << f) / ub;
+				const uint64_t quotient = q > limit ? limit : uint64_t(q);
+#else
+				uint64_t nhi = ua >> (64 - f), nlo = ua << f;
+				uint64_t rem = 0, q = 0;
+				bool overflow = false;
+				for(int bit = 127; bit >= 0; bit--)
+				{
+					const bool top = (rem >> 63) != 0;
+					rem = (rem << 1) | ((bit >= 64 ? nhi >> (bit - 64) : nlo >> bit) & 1);
+					const bool take = top || rem >= ub;
+					if(take)
+						rem -= ub;
+					if(q >> 63)
+						overflow = true;
+					q = (q << 1) | (take ? 1 : 0);
+				}
+				const uint64_t quotient = overflow || q > limit ? limit : q;
+#endif
+				return negative ? int64_t(0 - quotient) : int64_t(quotient);
+			}
+
+			// floor(sqrt(a * 2^f)) for a >= 0.
+			inline int32_t fixedSqrt(int32_t a, int f)
+			{
+				const uint64_t n = uint64_t(a) << f;
+				uint64_t r = 0;
+				for(int bit = 31; bit >= 0; bit--)
+				{
+					const uint64_t c = r | (uint64_t(1) << bit);
+					if(c * c <= n)
+						r = c;
+				}
+				return int32_t(r);
+			}
+
+			inline int64_t fixedSqrt(int64_t a, int f)
+			{
+				const uint64_t nhi = f == 0 ? 0 : uint64_t(a) >> (64 - f), nlo = uint64_t(a) << f;
+				uint64_t r = 0;
+				for(int bit = 63; bit >= 0; bit--)
+				{
+					const uint64_t c = r | (uint64_t(1) << bit);
+					uint64_t hi, lo;
+					fixedUMul128(c, c, hi, lo);
+					if(hi < nhi || (hi == nhi && lo <= nlo))
+						r = c;
+				}
+				return int64_t(r);
+			}
+
+			// The fraction of a turn of an angle with f fractional bits, as a
+			// wrapping 64 bit phase.
+			inline uint64_t fixedPhase(int64_t raw, int f)
+			{
+				int64_t hi;
+				uint64_t lo;
+				fixedMul128(raw, int64_t(FixedTurn64), hi, lo);
+				return (lo >> f) | (uint64_t(hi) << (64 - f));
+			}
+
+			// sin(2 pi phase / 2^64) * 2^62.
+			inline int64_t fixedSinPhase(uint64_t phase)
+			{
+				const uint64_t quarter = uint64_t(1) << 62;
+				const uint64_t quadrant = phase >> 62;
+				uint64_t u = phase & (quarter - 1);
+				if(quadrant & 1)
+					u = quarter - u;
+
+				const uint64_t index = u >> 54;
+				const int64_t t = int64_t((u >> 22) & 0xFFFFFFFFu); // Q32
+				int64_t value = FixedSinTable[index];
+				if(t != 0)
+				{
+					// Cubic Hermite over one table step, with the derivatives
+					// (cosines) read from the mirrored table.
+					const int64_t s0 = FixedSinTable[index], s1 = FixedSinTable[index + 1];
+					const int64_t m0 = fixedMulShift(FixedSinStep62, FixedSinTable[256 - index], 62);
+					const int64_t m1 = fixedMulShift(FixedSinStep62, FixedSinTable[255 - index], 62);
+					const int64_t c2 = 3 * (s1 - s0) - 2 * m0 - m1;
+					const int64_t c3 = 2 * (s0 - s1) + m0 + m1;
+					value = s0 + fixedMulShift(t, m0 + fixedMulShift(t, c2 + fixedMulShift(t, c3, 32), 32), 32);
+				}
+				return quadrant >= 2 ? -value : value;
+			}
+
+			template<typename I, int F>
+			inline I fixedFromQ62(int64_t v)
+			{
+				return I((v + (int64_t(1) << (61 - F))) >> (62 - F));
+			}
+
+			template<typename I, int F, typename A>
+			inline I fixedFrom(A value, std::true_type)
+			{
+				// The scaling is exact, so only the final rounding happens.
+				const double scaled = std::floor(double(value) * double(int64_t(1) << F) + 0.5);
+				const double hi = double(std::numeric_limits<I>::max()), lo = double(std::numeric_limits<I>::min());
+				return scaled >= hi ? std::numeric_limits<I>::max() : scaled > lo ? I(scaled) : scaled == scaled ? std::numeric_limits<I>::min() : I(0);
+			}
+
+			template<typename I, int F, typename A>
+			inline I fixedFrom(A value, std::false_type)
+			{
+				return I(uint64_t(int64_t(value)) << F);
+			}
+		}
+
+		// Inline definitions
+		template<typename I, int F>
+		template<typename A, typename>
+		inline fixed<I, F>::fixed(A value)
+			: raw(Internal::fixedFrom<I, F>(value, std::is_floating_point<A>()))
+		{}
+
+		template<typename I, int F>
+		inline fixed<I, F>::operator float() const
+		{
+			return float(raw) * (1.0f / float(int64_t(1) << F));
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F>::operator double() const
+		{
+			return double(raw) * (1.0 / double(int64_t(1) << F));
+		}
+
+		template<typename I, int F>
+		inline I fixed<I, F>::floor() const
+		{
+			return raw >> F;
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F> fixed<I, F>::fromRaw(I raw)
+		{
+			fixed<I, F> r;
+			r.raw = raw;
+			return r;
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F> fixed<I, F>::pi()
+		{
+			return fromRaw(I((Internal::FixedPi61 + (int64_t(1) << (60 - F))) >> (61 - F)));
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F> fixed<I, F>::epsilon()
+		{
+			return fromRaw(I(1));
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F> fixed<I, F>::operator-() const
+		{
+			typedef typename std::make_unsigned<I>::type U;
+			return fromRaw(I(U(0) - U(raw)));
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F>& fixed<I, F>::operator+=(const fixed<I, F>& other)
+		{
+			typedef typename std::make_unsigned<I>::type U;
+			raw = I(U(raw) + U(other.raw));
+			return *this;
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F>& fixed<I, F>::operator-=(const fixed<I, F>& other)
+		{
+			typedef typename std::make_unsigned<I>::type U;
+			raw = I(U(raw) - U(other.raw));
+			return *this;
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F>& fixed<I, F>::operator*=(const fixed<I, F>& other)
+		{
+			raw = Internal::fixedMul(raw, other.raw, F);
+			return *this;
+		}
+
+		template<typename I, int F>
+		inline fixed<I, F>& fixed<I, F>::operator/=(const fixed<I, F>& other)
+		{
+			raw = Internal::fixedDiv(raw, other.raw, F);
+			return *this;
+		}
+
+		// Template implementation
+		template<typename I, int F>
+		fixed<I, F> sqrt(const fixed<I, F>& v)
+		{
+			return fixed<I, F>::fromRaw(v.raw > 0 ? Internal::fixedSqrt(v.raw, F) : I(0));
+		}
+
+		template<typename I, int F>
+		fixed<I, F> sin(const fixed<I, F>& angle)
+		{
+			const uint64_t phase = Internal::fixedPhase(angle.raw, F);
+			return fixed<I, F>::fromRaw(Internal::fixedFromQ62<I, F>(Internal::fixedSinPhase(phase)));
+		}
+
+		template<typename I, int F>
+		fixed<I, F> cos(const fixed<I, F>& angle)
+		{
+			const uint64_t phase = Internal::fixedPhase(angle.raw, F) + (uint64_t(1) << 62);
+			return fixed<I, F>::fromRaw(Internal::fixedFromQ62<I, F>(Internal::fixedSinPhase(phase)));
+		}
+
+		template<typename I, int F>
+		fixed<I, F> tan(const fixed<I, F>& angle)
+		{
+			const uint64_t phase = Internal::fixedPhase(angle.raw, F);
+			const int64_t s = Internal::fixedSinPhase(phase), c = Internal::fixedSinPhase(phase + (uint64_t(1) << 62));
+			// The quotient has 64 bits; saturate it to I as division does.
+			const int64_t q = Internal::fixedDiv(s, c, F);
+			const int64_t lo = std::numeric_limits<I>::min(), hi = std::numeric_limits<I>::max();
+			return fixed<I, F>::fromRaw(I(q < lo ? lo : q > hi ? hi : q));
+		}
+
+		template<typename I, int F>
+		fixed<I, F> toRadians(const fixed<I, F>& degrees)
+		{
+			return degrees * fixed<I, F>::pi() / fixed<I, F>(180);
+		}
+
+		template<typename I, int F>
+		fixed<I, F> toDegrees(const fixed<I, F>& radians)
+		{
+			return radians * fixed<I, F>(180) / fixed<I, F>::pi();
+		}
+
+		template<typename I, int F>
+		void convert(const float* in, fixed<I, F>* out, size_t count)
+		{
+			parallelFor(count, Internal::FixedGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i].raw = Internal::fixedFrom<I, F>(in[i], std::true_type());
+			});
+		}
+
+		template<typename I, int F>
+		void convert(const fixed<I, F>* in, float* out, size_t count)
+		{
+			parallelFor(count, Internal::FixedGrain, [=](size_t begin, size_t end, size_t) {
+				const float scale = 1.0f / float(int64_t(1) << F);
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i] = float(in[i].raw) * scale;
+			});
+		}
+
+		template<typename I, int F>
+		void multiply(const fixed<I, F>* a, const fixed<I, F>* b, fixed<I, F>* out, size_t count)
+		{
+			parallelFor(count, Internal::FixedGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i].raw = Internal::fixedMul(a[i].raw, b[i].raw, F);
+			});
+		}
+
+		template<typename I, int F>
+		void dot(const vec3<fixed<I, F>>* a, const vec3<fixed<I, F>>* b, fixed<I, F>* out, size_t count)
+		{
+			parallelFor(count, Internal::FixedGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i] = a[i].x * b[i].x + a[i].y * b[i].y + a[i].z * b[i].z;
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_FIXED_H
@@ -0,0 +1,326 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Frustum.h
+ * View frustum header. This contains a frustum struct extracted from a
+ * view-projection matrix and kernels that cull spheres and boxes
+ * against it.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_FRUSTUM_H
+#define AURORAFW_MATH_FRUSTUM_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+#include <AuroraFW/Math/Matrix.h>
+#include <AuroraFW/Math/AABB.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A struct that represents a view frustum as six planes. Each plane
+		 * is stored as a vec4<T> (a, b, c, d) with a normalized normal
+		 * pointing inside, so a point p is inside when a*x + b*y + c*z + d >= 0.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API frustum {
+			/** The index of each plane in planes.
+			 * @since snapshot20261019
+			 */
+			enum Plane {
+				Left = 0,
+				Right,
+				Bottom,
+				Top,
+				Near,
+				Far
+			};
+
+			/** Constructs a frustum with all planes set to zero, which
+			 * contains everything.
+			 * @since snapshot20261019
+			 */
+			frustum();
+
+			/** Extracts the frustum planes from the given view-projection
+			 * matrix, using the OpenGL clip space convention (-w <= z <= w).
+			 * @param viewProj The view-projection matrix.
+			 * @since snapshot20261019
+			 */
+			explicit frustum(const mat<T, 4, 4>& );
+
+			/** Returns <code>true</code> if the given point is inside the frustum.
+			 * @since snapshot20261019
+			 */
+			bool contains(const vec3<T>& ) const;
+
+			/** Returns <code>true</code> if the given sphere is at least
+			 * partially inside the frustum.
+			 * @param center The sphere center.
+			 * @param radius The sphere radius.
+			 * @since snapshot20261019
+			 */
+			bool intersectsSphere(const vec3<T>& , const T& ) const;
+
+			/** Returns <code>true</code> if the given box is at least
+			 * partially inside the frustum. Boxes near the frustum corners
+			 * may be reported as visible although they are outside.
+			 * @since snapshot20261019
+			 */
+			bool intersects(const aabb<T>& ) const;
+
+			/** The six frustum planes, indexed by Plane.
+			 * @since snapshot20261019
+			 */
+			vec4<T> planes[6];
+		};
+
+		typedef frustum<float> Frustum;
+
+		// Template implementation
+		template<typename T>
+		frustum<T>::frustum()
+		{}
+
+		template<typename T>
+		frustum<T>::frustum(const mat<T, 4, 4>& m)
+		{
+			// Gribb-Hartmann: every plane is the last matrix row plus or
+			// minus one of the other rows. The matrix is column major.
+			for(int i = 0; i < 3; i++)
+			{
+				for(int s = 0; s < 2; s++)
+				{
+					T sign = s == 0 ? 1 : -1;
+					vec4<T>& p = planes[i * 2 + s];
+					p.x = m.matrix[0][3] + sign * m.matrix[0][i];
+					p.y = m.matrix[1][3] + sign * m.matrix[1][i];
+					p.z = m.matrix[2][3] + sign * m.matrix[2][i];
+					p.w = m.matrix[3][3] + sign * m.matrix[3][i];
+
+					using std::sqrt;
+					T length = sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+					p.divide(length);
+				}
+			}
+		}
+
+		template<typename T>
+		bool frustum<T>::contains(const vec3<T>& p) const
+		{
+			for(const vec4<T>& plane : planes)
+			{
+				if(plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w < 0)
+					return false;
+			}
+
+			return true;
+		}
+
+		template<typename T>
+		bool frustum<T>::intersectsSphere(const vec3<T>& center, const T& radius) const
+		{
+			for(const vec4<T>& plane : planes)
+			{
+				if(plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w < -radius)
+					return false;
+			}
+
+			return true;
+		}
+
+		template<typename T>
+		bool frustum<T>::intersects(const aabb<T>& box) const
+		{
+			// Only the corner furthest along the plane normal matters.
+			for(const vec4<T>& plane : planes)
+			{
+				T px = plane.x > 0 ? box.max.x : box.min.x;
+				T py = plane.y > 0 ? box.max.y : box.min.y;
+				T pz = plane.z > 0 ? box.max.z : box.min.z;
+				if(plane.x * px + plane.y * py + plane.z * pz + plane.w < 0)
+					return false;
+			}
+
+			return true;
+		}
+
+		namespace Internal {
+			/** Number of objects tested per block before compaction. */
+			constexpr size_t FrustumCullBlock = 256;
+
+			/** Number of objects below which culling stays on one thread. */
+			constexpr size_t FrustumCullGrain = 1 << 16;
+
+			/** Appends the indices of set mask entries to visible. */
+			inline size_t compactMask(const uint8_t* mask, size_t count, uint32_t base, uint32_t* visible)
+			{
+				size_t n = 0;
+				for(size_t i = 0; i < count; i++)
+				{
+					visible[n] = base + static_cast<uint32_t>(i);
+					n += mask[i];
+				}
+				return n;
+			}
+
+			template<typename T>
+			size_t cullSpheresRange(const frustum<T>& f, const vec3SoA<const T>& centers, const T* radii,
+				size_t begin, size_t end, uint32_t* visible)
+			{
+				uint8_t mask[FrustumCullBlock];
+				size_t n = 0;
+
+				for(size_t block = begin; block < end; block += FrustumCullBlock)
+				{
+					const size_t count = end - block < FrustumCullBlock ? end - block : FrustumCullBlock;
+					const T* cx = centers.x + block;
+					const T* cy = centers.y + block;
+					const T* cz = centers.z + block;
+					const T* r = radii + block;
+
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = 0; i < count; i++)
+					{
+						uint8_t in = 1;
+						for(const vec4<T>& p : f.planes)
+							in &= p.x * cx[i] + p.y * cy[i] + p.z * cz[i] + p.w >= -r[i];
+						mask[i] = in;
+					}
+
+					n += compactMask(mask, count, static_cast<uint32_t>(block), visible + n);
+				}
+
+				return n;
+			}
+
+			template<typename T>
+			size_t cullBoxesRange(const frustum<T>& f, const aabbSoA<const T>& boxes,
+				size_t begin, size_t end, uint32_t* visible)
+			{
+				uint8_t mask[FrustumCullBlock];
+				size_t n = 0;
+
+				for(size_t block = begin; block < end; block += FrustumCullBlock)
+				{
+					const size_t count = end - block < FrustumCullBlock ? end - block : FrustumCullBlock;
+
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = 0; i < count; i++)
+					{
+						const size_t j = block + i;
+						uint8_t in = 1;
+						for(const vec4<T>& p : f.planes)
+						{
+							T px = p.x > 0 ? boxes.maxX[j] : boxes.minX[j];
+							T py = p.y > 0 ? boxes.maxY[j] : boxes.minY[j];
+							T pz = p.z > 0 ? boxes.maxZ[j] : boxes.minZ[j];
+							in &= p.x * px + p.y * py + p.z * pz + p.w >= 0;
+						}
+						mask[i] = in;
+					}
+
+					n += compactMask(mask, count, static_cast<uint32_t>(block), visible + n);
+				}
+
+				return n;
+			}
+
+			/** Runs a range culler over all chunks and packs the per-chunk
+			 * results so the visible indices end up sorted and contiguous.
+			 */
+			template<typename F>
+			size_t cullParallel(size_t size, uint32_t* visible, F cullRange)
+			{
+				std::vector<size_t> found(parallelChunkCount(size, FrustumCullGrain));
+				parallelFor(size, FrustumCullGrain, [&](size_t begin, size_t end, size_t chunk) {
+					found[chunk] = cullRange(begin, end, visible + begin);
+				});
+
+				// Every chunk wrote at most as many indices as it has objects,
+				// starting at its own offset, so moving them down in chunk
+				// order never overwrites pending results.
+				size_t n = found[0];
+				for(size_t chunk = 1; chunk < found.size(); chunk++)
+				{
+					size_t begin = size * chunk / found.size();
+					memmove(visible + n, visible + begin, found[chunk] * sizeof(uint32_t));
+					n += found[chunk];
+				}
+
+				return n;
+			}
+		}
+
+		/**
+		 * Culls many spheres against a frustum. Large inputs are split
+		 * across hardware threads.
+		 * @param f The frustum to cull against.
+		 * @param centers The sphere centers, as a structure of arrays.
+		 * @param radii The sphere radii, one per center.
+		 * @param visible Receives the sorted indices of the visible spheres.
+		 * Must have room for centers.size indices.
+		 * @return The number of visible spheres.
+		 * @see cullBoxes()
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t cullSpheres(const frustum<T>& f, const vec3SoA<const T>& centers, const T* radii, uint32_t* visible)
+		{
+			return Internal::cullParallel(centers.size, visible, [&](size_t begin, size_t end, uint32_t* out) {
+				return Internal::cullSpheresRange(f, centers, radii, begin, end, out);
+			});
+		}
+
+		/**
+		 * Culls many boxes against a frustum. Large inputs are split
+		 * across hardware threads.
+		 * @param f The frustum to cull against.
+		 * @param boxes The boxes, as a structure of arrays.
+		 * @param visible Receives the sorted indices of the visible boxes.
+		 * Must have room for boxes.size indices.
+		 * @return The number of visible boxes.
+		 * @see cullSpheres()
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t cullBoxes(const frustum<T>& f, const aabbSoA<const T>& boxes, uint32_t* visible)
+		{
+			return Internal::cullParallel(boxes.size, visible, [&](size_t begin, size_t end, uint32_t* out) {
+				return Internal::cullBoxesRange(f, boxes, begin, end, out);
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_FRUSTUM_H
@@ -0,0 +1,446 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Half.h
+ * Half precision header. This contains the 16 bit half and bfloat16
+ * storage types and bulk conversions between them and float spans.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_HALF_H
+#define AURORAFW_MATH_HALF_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__F16C__) || defined(__AVX512F__)
+	#include <immintrin.h>
+#endif
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * An IEEE 754 binary16 number: 1 sign, 5 exponent and 10 mantissa
+		 * bits, about 3 decimal digits over +-65504. It is a storage type:
+		 * it converts implicitly to float, so all arithmetic happens in
+		 * float, and from float with round to nearest even. It can be used
+		 * as the T of vec2, vec3 and vec4 to halve their size.
+		 * @since snapshot20261019
+		 */
+		struct AFW_API half {
+			/** Constructs a zero.
+			 * @since snapshot20261019
+			 */
+			half();
+
+			/** Constructs the nearest half to a float. Values past the range
+			 * become infinities.
+			 * @since snapshot20261019
+			 */
+			half(float );
+
+			/** Returns the value as a float. This is exact.
+			 * @since snapshot20261019
+			 */
+			operator float() const;
+
+			half& operator+=(float );
+			half& operator-=(float );
+			half& operator*=(float );
+			half& operator/=(float );
+
+			/** Returns the half with the given bit pattern.
+			 * @since snapshot20261019
+			 */
+			static half fromBits(uint16_t );
+
+			/** The bit pattern. */
+			uint16_t bits;
+		};
+
+		/**
+		 * A bfloat16 number: the upper 16 bits of a float, so 1 sign, 8
+		 * exponent and 7 mantissa bits. It keeps the whole float range with
+		 * about 2 decimal digits. Like half it is a storage type that
+		 * promotes to float.
+		 * @since snapshot20261019
+		 */
+		struct AFW_API bfloat16 {
+			/** Constructs a zero.
+			 * @since snapshot20261019
+			 */
+			bfloat16();
+
+			/** Constructs the nearest bfloat16 to a float.
+			 * @since snapshot20261019
+			 */
+			bfloat16(float );
+
+			/** Returns the value as a float. This is exact.
+			 * @since snapshot20261019
+			 */
+			operator float() const;
+
+			bfloat16& operator+=(float );
+			bfloat16& operator-=(float );
+			bfloat16& operator*=(float );
+			bfloat16& operator/=(float );
+
+			/** Returns the bfloat16 with the given bit pattern.
+			 * @since snapshot20261019
+			 */
+			static bfloat16 fromBits(uint16_t );
+
+			/** The bit pattern. */
+			uint16_t bits;
+		};
+
+		/**
+		 * Converts a span of halves to floats. Uses the F16C or AVX-512
+		 * conversion instructions when the target has them, and large spans
+		 * are split across threads.
+		 * @param in The halves.
+		 * @param out Receives the floats.
+		 * @param count The number of values.
+		 * @since snapshot20261019
+		 */
+		AFW_API void convert(const half* , float* , size_t );
+
+		/**
+		 * Converts a span of floats to halves, rounding to nearest even.
+		 * @see convert(const half* , float* , size_t )
+		 * @since snapshot20261019
+		 */
+		AFW_API void convert(const float* , half* , size_t );
+
+		/**
+		 * Converts a span of bfloat16 values to floats.
+		 * @since snapshot20261019
+		 */
+		AFW_API void convert(const bfloat16* , float* , size_t );
+
+		/**
+		 * Converts a span of floats to bfloat16 values, rounding to nearest even.
+		 * @since snapshot20261019
+		 */
+		AFW_API void convert(const float* , bfloat16* , size_t );
+
+		/**
+		 * Converts a span of half or bfloat16 vectors to float vectors.
+		 * @param in The vectors.
+		 * @param out Receives the converted vectors.
+		 * @param count The number of vectors.
+		 * @since snapshot20261019
+		 */
+		template<typename H> void convert(const vec2<H>* , vec2<float>* , size_t );
+		template<typename H> void convert(const vec3<H>* , vec3<float>* , size_t );
+		template<typename H> void convert(const vec4<H>* , vec4<float>* , size_t );
+
+		/**
+		 * Converts a span of float vectors to half or bfloat16 vectors.
+		 * @param in The vectors.
+		 * @param out Receives the converted vectors.
+		 * @param count The number of vectors.
+		 * @since snapshot20261019
+		 */
+		template<typename H> void convert(const vec2<float>* , vec2<H>* , size_t );
+		template<typename H> void convert(const vec3<float>* , vec3<H>* , size_t );
+		template<typename H> void convert(const vec4<float>* , vec4<H>* , size_t );
+
+		/**
+		 * Converts half or bfloat16 vectors to float SoA, for the batch
+		 * kernels.
+		 * @param in The out.size vectors.
+		 * @param out Receives the coordinates.
+		 * @since snapshot20261019
+		 */
+		template<typename H> void convert(const vec3<H>* , const vec3SoA<float>& );
+
+		/**
+		 * Converts float SoA to half or bfloat16 vectors.
+		 * @param in The coordinates.
+		 * @param out Receives the in.size vectors.
+		 * @since snapshot20261019
+		 */
+		template<typename H> void convert(const vec3SoA<const float>& , vec3<H>* );
+
+		namespace Internal {
+			constexpr size_t HalfGrain = 1 << 16;
+
+			inline uint32_t halfFloatBits(float f)
+			{
+				uint32_t u;
+				std::memcpy(&u, &f, sizeof(u));
+				return u;
+			}
+
+			inline float halfBitsFloat(uint32_t u)
+			{
+				float f;
+				std::memcpy(&f, &u, sizeof(f));
+				return f;
+			}
+
+			// Written with selects rather than branches so the span loops
+			// vectorize on targets without F16C.
+			inline uint16_t floatToHalfBits(float value)
+			{
+				const uint32_t u = halfFloatBits(value);
+				const uint32_t sign = (u >> 16) & 0x8000u;
+				const uint32_t a = u & 0x7FFFFFFFu;
+
+				// Subnormal results: adding 0.5 aligns the mantissa so the
+				// FPU rounds it to nearest even.
+				const uint32_t small = halfFloatBits(halfBitsFloat(a) + 0.5f) - 0x3F000000u;
+				// Normal results: rebias the exponent and round to nearest even.
+				const uint32_t normal = (a + 0xC8000FFFu + ((a >> 13) & 1)) >> 13;
+				const uint32_t special = a > 0x7F800000u ? 0x7E00u : 0x7C00u;
+
+				const uint32_t bits = a >= 0x47800000u ? special : a < 0x38800000u ? small : normal;
+				return uint16_t(bits | sign);
+			}
+
+			inline float halfBitsToFloat(uint16_t h)
+			{
+				const uint32_t sign = uint32_t(h & 0x8000u) << 16;
+				const uint32_t a = uint32_t(h & 0x7FFFu) << 13;
+				const uint32_t exponent = a & 0x0F800000u;
+
+				const uint32_t normal = a + 0x38000000u;
+				const uint32_t special = a + 0x70000000u;
+				// Subnormals: scale the mantissa through the FPU.
+				const uint32_t small = halfFloatBits(halfBitsFloat(a + 0x38800000u) - halfBitsFloat(0x38800000u));
+
+				const uint32_t bits = exponent == 0x0F800000u ? special : exponent == 0 ? small : normal;
+				return halfBitsFloat(bits | sign);
+			}
+
+			inline uint16_t floatToBFloat16Bits(float value)
+			{
+				const uint32_t u = halfFloatBits(value);
+				const uint32_t rounded = (u + 0x7FFFu + ((u >> 16) & 1)) >> 16;
+				const uint32_t nan = (u >> 16) | 0x40u;
+				return uint16_t((u & 0x7FFFFFFFu) > 0x7F800000u ? nan : rounded);
+			}
+
+			inline float bfloat16BitsToFloat(uint16_t b)
+			{
+				return halfBitsFloat(uint32_t(b) << 16);
+			}
+
+			// The element conversions used by the vector span templates.
+			inline float toFloat(const half& h) { return halfBitsToFloat(h.bits); }
+			inline float toFloat(const bfloat16& b) { return bfloat16BitsToFloat(b.bits); }
+
+			// Vectors of H are arrays of H, so their spans convert as
+			// scalar spans.
+			template<typename V, typename W, int N>
+			inline void convertVectors(const V* in, W* out, size_t count)
+			{
+				static_assert(sizeof(V) == N * sizeof(in->x) && sizeof(W) == N * sizeof(out->x),
+					"vector types must be tightly packed");
+				convert(&in->x, &out->x, count * N);
+			}
+		}
+
+		// Inline definitions
+		inline half::half()
+			: bits(0)
+		{}
+
+		inline half::half(float value)
+			: bits(Internal::floatToHalfBits(value))
+		{}
+
+		inline half::operator float() const
+		{
+			return Internal::halfBitsToFloat(bits);
+		}
+
+		inline half& half::operator+=(float v) { return *this = half(float(*this) + v); }
+		inline half& half::operator-=(float v) { return *this = half(float(*this) - v); }
+		inline half& half::operator*=(float v) { return *this = half(float(*this) * v); }
+		inline half& half::operator/=(float v) { return *this = half(float(*this) / v); }
+
+		inline half half::fromBits(uint16_t bits)
+		{
+			half h;
+			h.bits = bits;
+			return h;
+		}
+
+		inline bfloat16::bfloat16()
+			: bits(0)
+		{}
+
+		inline bfloat16::bfloat16(float value)
+			: bits(Internal::floatToBFloat16Bits(value))
+		{}
+
+		inline bfloat16::operator float() const
+		{
+			return Internal::bfloat16BitsToFloat(bits);
+		}
+
+		inline bfloat16& bfloat16::operator+=(float v) { return *this = bfloat16(float(*this) + v); }
+		inline bfloat16& bfloat16::operator-=(float v) { return *this = bfloat16(float(*this) - v); }
+		inline bfloat16& bfloat16::operator*=(float v) { return *this = bfloat16(float(*this) * v); }
+		inline bfloat16& bfloat16::operator/=(float v) { return *this = bfloat16(float(*this) / v); }
+
+		inline bfloat16 bfloat16::fromBits(uint16_t bits)
+		{
+			bfloat16 b;
+			b.bits = bits;
+			return b;
+		}
+
+		inline void convert(const half* in, float* out, size_t count)
+		{
+			parallelFor(count, Internal::HalfGrain, [=](size_t begin, size_t end, size_t) {
+				size_t i = begin;
+#if defined(__AVX512F__)
+				for(; i + 16 <= end; i += 16)
+					_mm512_storeu_ps(out + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i))));
+#elif defined(__F16C__)
+				for(; i + 8 <= end; i += 8)
+					_mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+#endif
+				AFW_MATH_SIMD_LOOP
+				for(; i < end; i++)
+					out[i] = Internal::halfBitsToFloat(in[i].bits);
+			});
+		}
+
+		inline void convert(const float* in, half* out, size_t count)
+		{
+			parallelFor(count, Internal::HalfGrain, [=](size_t begin, size_t end, size_t) {
+				size_t i = begin;
+#if defined(__AVX512F__)
+				for(; i + 16 <= end; i += 16)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+						_mm512_cvtps_ph(_mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#elif defined(__F16C__)
+				for(; i + 8 <= end; i += 8)
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+						_mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+#endif
+				AFW_MATH_SIMD_LOOP
+				for(; i < end; i++)
+					out[i].bits = Internal::floatToHalfBits(in[i]);
+			});
+		}
+
+		inline void convert(const bfloat16* in, float* out, size_t count)
+		{
+			parallelFor(count, Internal::HalfGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i] = Internal::bfloat16BitsToFloat(in[i].bits);
+			});
+		}
+
+		inline void convert(const float* in, bfloat16* out, size_t count)
+		{
+			parallelFor(count, Internal::HalfGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					out[i].bits = Internal::floatToBFloat16Bits(in[i]);
+			});
+		}
+
+		// Template implementation
+		template<typename H>
+		void convert(const vec2<H>* in, vec2<float>* out, size_t count)
+		{
+			Internal::convertVectors<vec2<H>, vec2<float>, 2>(in, out, count);
+		}
+
+		template<typename H>
+		void convert(const vec3<H>* in, vec3<float>* out, size_t count)
+		{
+			Internal::convertVectors<vec3<H>, vec3<float>, 3>(in, out, count);
+		}
+
+		template<typename H>
+		void convert(const vec4<H>* in, vec4<float>* out, size_t count)
+		{
+			Internal::convertVectors<vec4<H>, vec4<float>, 4>(in, out, count);
+		}
+
+		template<typename H>
+		void convert(const vec2<float>* in, vec2<H>* out, size_t count)
+		{
+			Internal::convertVectors<vec2<float>, vec2<H>, 2>(in, out, count);
+		}
+
+		template<typename H>
+		void convert(const vec3<float>* in, vec3<H>* out, size_t count)
+		{
+			Internal::convertVectors<vec3<float>, vec3<H>, 3>(in, out, count);
+		}
+
+		template<typename H>
+		void convert(const vec4<float>* in, vec4<H>* out, size_t count)
+		{
+			Internal::convertVectors<vec4<float>, vec4<H>, 4>(in, out, count);
+		}
+
+		template<typename H>
+		void convert(const vec3<H>* in, const vec3SoA<float>& out)
+		{
+			parallelFor(out.size, Internal::HalfGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					out.x[i] = Internal::toFloat(in[i].x);
+					out.y[i] = Internal::toFloat(in[i].y);
+					out.z[i] = Internal::toFloat(in[i].z);
+				}
+			});
+		}
+
+		template<typename H>
+		void convert(const vec3SoA<const float>& in, vec3<H>* out)
+		{
+			parallelFor(in.size, Internal::HalfGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					out[i].x = H(in.x[i]);
+					out[i].y = H(in.y[i]);
+					out[i].z = H(in.z[i]);
+				}
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_HALF_H
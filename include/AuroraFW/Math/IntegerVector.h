@@ -0,0 +1,564 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/IntegerVector.h
+ * Integer vector header. This contains the ivec2, ivec3 and ivec4
+ * types, wrapping, saturating and bitwise operations on integer
+ * vectors, exact dot products, and span kernels for grid coordinates.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_INTEGERVECTOR_H
+#define AURORAFW_MATH_INTEGERVECTOR_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector.h>
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * Vectors of 32 bit signed integers, e.g. voxel and tile coordinates.
+		 *
+		 * The usual vec operators use the arithmetic of T, so signed
+		 * overflow is undefined as it is for int. The wrapping and
+		 * saturating functions below define it. length() is the exact
+		 * integer length rounded down; normalize() is not available.
+		 * @since snapshot20261019
+		 */
+		typedef vec2<int32_t> ivec2;
+		typedef vec3<int32_t> ivec3;
+		typedef vec4<int32_t> ivec4;
+
+		namespace Internal {
+			// R, for vectors of integers only.
+			template<typename T, typename R>
+			using vecIfIntegral = typename std::enable_if<std::is_integral<T>::value, R>::type;
+
+			// The unsigned type that integer arithmetic on T is done in, at
+			// least unsigned int so small types do not promote to int.
+			template<typename T>
+			using vecUnsigned = typename std::conditional<(sizeof(T) < sizeof(unsigned)),
+				unsigned, typename std::make_unsigned<T>::type>::type;
+
+			template<typename T>
+			inline T wrappingAdd(T a, T b) { return T(vecUnsigned<T>(a) + vecUnsigned<T>(b)); }
+
+			template<typename T>
+			inline T wrappingSubtract(T a, T b) { return T(vecUnsigned<T>(a) - vecUnsigned<T>(b)); }
+
+			template<typename T>
+			inline T wrappingMultiply(T a, T b) { return T(vecUnsigned<T>(a) * vecUnsigned<T>(b)); }
+
+			// The saturating operations: through the wide type when it is
+			// wider, otherwise by checking for overflow.
+			template<typename T>
+			inline T saturatingClamp(typename vecWide<T>::type v)
+			{
+				typedef typename vecWide<T>::type W;
+				const W lo = W(std::numeric_limits<T>::lowest()), hi = W(std::numeric_limits<T>::max());
+				return T(v < lo ? lo : v > hi ? hi : v);
+			}
+
+			template<typename T>
+			inline T saturatingAdd(T a, T b)
+			{
+				typedef typename vecWide<T>::type W;
+				if(sizeof(W) > sizeof(T))
+					return saturatingClamp<T>(W(a) + W(b));
+				const T r = wrappingAdd(a, b);
+				if(std::is_signed<T>::value)
+					return (a < 0) == (b < 0) && (r < 0) != (a < 0) ? (a < 0 ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max()) : r;
+				return r < a ? std::numeric_limits<T>::max() : r;
+			}
+
+			template<typename T>
+			inline T saturatingSubtract(T a, T b)
+			{
+				typedef typename vecWide<T>::type W;
+				if(!std::is_signed<T>::value)
+					return a < b ? T(0) : T(a - b);
+				if(sizeof(W) > sizeof(T))
+					return saturatingClamp<T>(W(a) - W(b));
+				const T r = wrappingSubtract(a, b);
+				return (a < 0) != (b < 0) && (r < 0) != (a < 0) ? (a < 0 ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max()) : r;
+			}
+
+			template<typename T>
+			inline T saturatingMultiply(T a, T b)
+			{
+				typedef typename vecWide<T>::type W;
+				if(sizeof(W) > sizeof(T))
+					return saturatingClamp<T>(W(a) * W(b));
+				if(a == 0 || b == 0)
+					return T(0);
+				const T hi = std::numeric_limits<T>::max(), lo = std::numeric_limits<T>::lowest();
+				const bool negative = (a < 0) != (b < 0);
+				bool overflow;
+				if(!std::is_signed<T>::value)
+					overflow = a > hi / b;
+				else if(a > 0)
+					overflow = b > 0 ? a > hi / b : b < lo / a;
+				else
+					overflow = b > 0 ? a < lo / b : b < hi / a;
+				return overflow ? (negative ? lo : hi) : wrappingMultiply(a, b);
+			}
+
+			// Division rounded toward negative infinity, and the matching
+			// remainder, which has the sign of the divisor.
+			template<typename T>
+			inline T floorDivide(T a, T b)
+			{
+				const T q = a / b;
+				return q - T((a % b != 0) && ((a < 0) != (b < 0)));
+			}
+
+			template<typename T>
+			inline T floorModulo(T a, T b)
+			{
+				const T r = a % b;
+				return r != 0 && ((r < 0) != (b < 0)) ? r + b : r;
+			}
+
+			constexpr size_t IntegerGrain = 1 << 16;
+
+			// The coordinates of a span of vectors as one flat array.
+			template<typename T, size_t N>
+			inline const T* vecFlat(const vec<T, N>* v)
+			{
+				static_assert(sizeof(vec<T, N>) == N * sizeof(T), "vec is not tightly packed");
+				return reinterpret_cast<const T*>(v);
+			}
+
+			template<typename T, size_t N>
+			inline T* vecFlat(vec<T, N>* v)
+			{
+				static_assert(sizeof(vec<T, N>) == N * sizeof(T), "vec is not tightly packed");
+				return reinterpret_cast<T*>(v);
+			}
+		}
+
+		/**
+		 * Returns the dot product in a wider integer type: 64 bits for 8
+		 * and 16 bit coordinates, 128 bits for 32 and 64 bit ones where the
+		 * compiler has 128 bit integers, and 64 bits otherwise (e.g. MSVC).
+		 * The result is exact while the sum of the |a[i] * b[i]| fits that
+		 * type, which with up to four coordinates means: always for 8, 16
+		 * and 32 bit coordinates with 128 bits; magnitudes below 2^62 for
+		 * 64 bit ones with 128 bits; and magnitudes below 2^30 with only
+		 * 64 bits. Beyond that, the sum overflows.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, typename Internal::vecWide<T>::type> dotExact(const vec<T, N>& , const vec<T, N>& );
+
+		/**
+		 * Returns the squared length in a wider integer type.
+		 * @see dotExact()
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, typename Internal::vecWide<T>::type> lengthSquaredExact(const vec<T, N>& );
+
+		/**
+		 * Adds, subtracts or multiplies coordinates modulo 2^bits, as
+		 * unsigned arithmetic does, for signed types too.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> wrappingAdd(const vec<T, N>& , const vec<T, N>& );
+
+		/** @see wrappingAdd()
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> wrappingSubtract(const vec<T, N>& , const vec<T, N>& );
+
+		/** @see wrappingAdd()
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> wrappingMultiply(const vec<T, N>& , const vec<T, N>& );
+
+		/**
+		 * Adds, subtracts or multiplies coordinates, clamping results to the
+		 * range of T instead of overflowing.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> saturatingAdd(const vec<T, N>& , const vec<T, N>& );
+
+		/** @see saturatingAdd()
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> saturatingSubtract(const vec<T, N>& , const vec<T, N>& );
+
+		/** @see saturatingAdd()
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> saturatingMultiply(const vec<T, N>& , const vec<T, N>& );
+
+		/**
+		 * Returns the smallest of each pair of coordinates.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> componentMin(const vec<T, N>& , const vec<T, N>& );
+
+		/**
+		 * Returns the biggest of each pair of coordinates.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> componentMax(const vec<T, N>& , const vec<T, N>& );
+
+		/**
+		 * Divides every coordinate, rounding toward negative infinity: the
+		 * tile holding a coordinate, for tiles of the given size.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> floorDivide(const vec<T, N>& , T );
+
+		/**
+		 * The remainder of floorDivide(), with the sign of the divisor: the
+		 * position of a coordinate within its tile.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> floorModulo(const vec<T, N>& , T );
+
+		/**
+		 * Splits grid coordinates into tile coordinates and positions
+		 * within the tile, for tiles 2^shift wide, with arithmetic shifts
+		 * and masks. Negative coordinates go to negative tiles. Large spans
+		 * are split across threads.
+		 * @param in The coordinates.
+		 * @param count The number of coordinates.
+		 * @param shift The log2 of the tile size.
+		 * @param tiles Receives the tile coordinates. May be <code>nullptr</code>.
+		 * @param local Receives the positions in the tiles. May be <code>nullptr</code>.
+		 * @since snapshot20261019
+		 */
+		template<size_t N>
+		void splitCoordinates(const vec<int32_t, N>* , size_t , int , vec<int32_t, N>* , vec<int32_t, N>* );
+
+		/**
+		 * Computes the row major index x + sx * (y + sy * z) of coordinates
+		 * in a grid of the given size, e.g. of voxels within a chunk. The
+		 * coordinates must be inside the grid.
+		 * @param in The coordinates.
+		 * @param count The number of coordinates.
+		 * @param size The size of the grid.
+		 * @param out Receives the indices.
+		 * @since snapshot20261019
+		 */
+		template<size_t N>
+		void linearIndex(const vec<int32_t, N>* , size_t , const vec<int32_t, N>& , uint32_t* );
+
+		/**
+		 * Converts positions to the coordinates of the grid cells holding
+		 * them: floor(p / cellSize), saturated to the int32 range, with NaN
+		 * going to the lowest value.
+		 * @param in The positions.
+		 * @param count The number of positions.
+		 * @param cellSize The size of a cell.
+		 * @param out Receives the cell coordinates.
+		 * @since snapshot20261019
+		 */
+		template<size_t N>
+		void toGrid(const vec<float, N>* , size_t , float , vec<int32_t, N>* );
+
+		// Bitwise operators, for integer coordinates only. Shifts are by
+		// a count for every coordinate or by one count per coordinate;
+		// left shifts are done on the unsigned bits.
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator~(const vec<T, N>& );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator&=(vec<T, N>& , const vec<T, N>& );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator|=(vec<T, N>& , const vec<T, N>& );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator^=(vec<T, N>& , const vec<T, N>& );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator<<=(vec<T, N>& , const vec<T, N>& );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator>>=(vec<T, N>& , const vec<T, N>& );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator<<=(vec<T, N>& , int );
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>&> operator>>=(vec<T, N>& , int );
+
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator&(vec<T, N> a, const vec<T, N>& b) { return a &= b; }
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator|(vec<T, N> a, const vec<T, N>& b) { return a |= b; }
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator^(vec<T, N> a, const vec<T, N>& b) { return a ^= b; }
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator<<(vec<T, N> a, const vec<T, N>& b) { return a <<= b; }
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator>>(vec<T, N> a, const vec<T, N>& b) { return a >>= b; }
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator<<(vec<T, N> a, int b) { return a <<= b; }
+		template<typename T, size_t N>
+		Internal::vecIfIntegral<T, vec<T, N>> operator>>(vec<T, N> a, int b) { return a >>= b; }
+
+		// Inline definitions
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, typename Internal::vecWide<T>::type> dotExact(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			typedef typename Internal::vecWide<T>::type W;
+			W sum = 0;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { sum += W(a[i]) * W(b[i]); });
+			return sum;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, typename Internal::vecWide<T>::type> lengthSquaredExact(const vec<T, N>& v)
+		{
+			return dotExact(v, v);
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> wrappingAdd(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::wrappingAdd(a[i], b[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> wrappingSubtract(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::wrappingSubtract(a[i], b[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> wrappingMultiply(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::wrappingMultiply(a[i], b[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> saturatingAdd(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::saturatingAdd(a[i], b[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> saturatingSubtract(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::saturatingSubtract(a[i], b[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> saturatingMultiply(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::saturatingMultiply(a[i], b[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> componentMin(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = b[i] < a[i] ? b[i] : a[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> componentMax(const vec<T, N>& a, const vec<T, N>& b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = a[i] < b[i] ? b[i] : a[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> floorDivide(const vec<T, N>& a, T b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::floorDivide(a[i], b); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> floorModulo(const vec<T, N>& a, T b)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = Internal::floorModulo(a[i], b); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>> operator~(const vec<T, N>& a)
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = T(~a[i]); });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator&=(vec<T, N>& a, const vec<T, N>& b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(a[i] & b[i]); });
+			return a;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator|=(vec<T, N>& a, const vec<T, N>& b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(a[i] | b[i]); });
+			return a;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator^=(vec<T, N>& a, const vec<T, N>& b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(a[i] ^ b[i]); });
+			return a;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator<<=(vec<T, N>& a, const vec<T, N>& b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(Internal::vecUnsigned<T>(a[i]) << b[i]); });
+			return a;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator>>=(vec<T, N>& a, const vec<T, N>& b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(a[i] >> b[i]); });
+			return a;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator<<=(vec<T, N>& a, int b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(Internal::vecUnsigned<T>(a[i]) << b); });
+			return a;
+		}
+
+		template<typename T, size_t N>
+		inline Internal::vecIfIntegral<T, vec<T, N>&> operator>>=(vec<T, N>& a, int b)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { a[i] = T(a[i] >> b); });
+			return a;
+		}
+
+		// Template implementation
+		template<size_t N>
+		void splitCoordinates(const vec<int32_t, N>* in, size_t count, int shift, vec<int32_t, N>* tiles, vec<int32_t, N>* local)
+		{
+			// Flat loops over every coordinate: the same shift and mask
+			// apply to all of them, so they vectorize at any dimension.
+			const int32_t* src = Internal::vecFlat(in);
+			int32_t* t = tiles != nullptr ? Internal::vecFlat(tiles) : nullptr;
+			int32_t* l = local != nullptr ? Internal::vecFlat(local) : nullptr;
+			const int32_t mask = int32_t((uint32_t(1) << shift) - 1);
+			parallelFor(count * N, Internal::IntegerGrain, [=](size_t begin, size_t end, size_t) {
+				if(t != nullptr)
+				{
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+						t[i] = src[i] >> shift;
+				}
+				if(l != nullptr)
+				{
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+						l[i] = src[i] & mask;
+				}
+			});
+		}
+
+		template<size_t N>
+		void linearIndex(const vec<int32_t, N>* in, size_t count, const vec<int32_t, N>& size, uint32_t* out)
+		{
+			uint32_t stride[N];
+			stride[0] = 1;
+			for(size_t d = 1; d < N; d++)
+				stride[d] = stride[d - 1] * uint32_t(size[d - 1]);
+			const int32_t* src = Internal::vecFlat(in);
+			parallelFor(count, Internal::IntegerGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					uint32_t index = 0;
+					for(size_t d = 0; d < N; d++)
+						index += uint32_t(src[i * N + d]) * stride[d];
+					out[i] = index;
+				}
+			});
+		}
+
+		template<size_t N>
+		void toGrid(const vec<float, N>* in, size_t count, float cellSize, vec<int32_t, N>* out)
+		{
+			const float* src = Internal::vecFlat(in);
+			int32_t* dst = Internal::vecFlat(out);
+			parallelFor(count * N, Internal::IntegerGrain, [=](size_t begin, size_t end, size_t) {
+				// Truncate, then step down where that rounded up: a branch
+				// free floor made of conversions and compares. The quotient
+				// is clamped to the largest float below 2^31 before
+				// converting, and values from 2^31 up are masked to the int32
+				// maximum afterwards.
+				const float lo = -2147483648.0f, hi = 2147483520.0f;
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					const float q = src[i] / cellSize;
+					float x = q > lo ? q : lo;
+					x = x < hi ? x : hi;
+					const int32_t t = int32_t(x);
+					const int32_t over = -int32_t(q >= 2147483648.0f);
+					dst[i] = ((t - int32_t(x < float(t))) & ~over) | (std::numeric_limits<int32_t>::max() & over);
+				}
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_INTEGERVECTOR_H
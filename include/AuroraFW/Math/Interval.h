@@ -0,0 +1,527 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Interval.h
+ * Interval header. This contains an interval number type with outward
+ * rounding, and orientation and incircle predicates that use it as a
+ * filter in front of exact arithmetic.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_INTERVAL_H
+#define AURORAFW_MATH_INTERVAL_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A closed interval [lo, hi] of float or double that is guaranteed
+		 * to contain the exact result of the operations that produced it.
+		 * Every operation rounds its lower bound down and its upper bound
+		 * up, so a sign that the interval proves is the sign of the exact
+		 * value. It works as the T of vec2, vec3, vec4 and mat.
+		 *
+		 * The rounding is done by moving the round-to-nearest result one or
+		 * two units in the last place outward, rather than by switching the
+		 * FPU rounding mode: it needs no floating-point environment access,
+		 * is safe across threads, and cannot be undone by constant folding.
+		 * The bounds are at most two units wider than with true directed
+		 * rounding.
+		 *
+		 * Equality compares the bounds. The ordering operators are certain
+		 * comparisons: a < b holds only if every value of a is less than
+		 * every value of b.
+		 * @tparam T float or double.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API interval {
+			static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value, "interval needs float or double bounds");
+
+			/** Constructs the point zero.
+			 * @since snapshot20261019
+			 */
+			constexpr interval() : lo(0), hi(0) {}
+
+			/** Constructs a point.
+			 * @since snapshot20261019
+			 */
+			constexpr interval(T v) : lo(v), hi(v) {}
+
+			/** Constructs the interval [lo, hi].
+			 * @since snapshot20261019
+			 */
+			constexpr interval(T lo, T hi) : lo(lo), hi(hi) {}
+
+			/** Returns the interval of all numbers.
+			 * @since snapshot20261019
+			 */
+			static interval whole();
+
+			/** Returns the midpoint.
+			 * @since snapshot20261019
+			 */
+			T mid() const;
+
+			/** Returns hi - lo, rounded up.
+			 * @since snapshot20261019
+			 */
+			T width() const;
+
+			/** Returns <code>true</code> if the value is within the bounds.
+			 * @since snapshot20261019
+			 */
+			bool contains(T ) const;
+
+			/** Returns 1 if every value is positive, -1 if every value is
+			 * negative, and 0 if the interval contains zero.
+			 * @since snapshot20261019
+			 */
+			int sign() const;
+
+			interval operator-() const;
+			interval& operator+=(const interval& );
+			interval& operator-=(const interval& );
+			interval& operator*=(const interval& );
+			interval& operator/=(const interval& );
+
+			// Friends rather than templates, so mixed expressions like
+			// 2.0f * x convert the other operand.
+			friend interval operator+(interval a, const interval& b) { return a += b; }
+			friend interval operator-(interval a, const interval& b) { return a -= b; }
+			friend interval operator*(interval a, const interval& b) { return a *= b; }
+			friend interval operator/(interval a, const interval& b) { return a /= b; }
+
+			friend bool operator==(const interval& a, const interval& b) { return a.lo == b.lo && a.hi == b.hi; }
+			friend bool operator!=(const interval& a, const interval& b) { return !(a == b); }
+			friend bool operator<(const interval& a, const interval& b) { return a.hi < b.lo; }
+			friend bool operator>(const interval& a, const interval& b) { return a.lo > b.hi; }
+			friend bool operator<=(const interval& a, const interval& b) { return a.hi <= b.lo; }
+			friend bool operator>=(const interval& a, const interval& b) { return a.lo >= b.hi; }
+
+			/** The lower bound. */
+			T lo;
+			/** The upper bound. */
+			T hi;
+		};
+		typedef interval<float> Interval;
+		typedef interval<double> IntervalD;
+
+		/**
+		 * Returns an interval containing the square roots of the values.
+		 * Negative values are ignored.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		interval<T> sqrt(const interval<T>& );
+
+		/**
+		 * Returns the interval of the absolute values.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		interval<T> abs(const interval<T>& );
+
+		/**
+		 * Returns the orientation of three points: 1 if a, b and c turn
+		 * counter-clockwise, -1 if clockwise and 0 if they are collinear.
+		 * The answer is exact. It is computed with intervals first, and
+		 * with exact expansion arithmetic only if they cannot decide.
+		 * Exactness needs the products of coordinates not to overflow or
+		 * underflow.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		int orient2D(const vec2<T>& , const vec2<T>& , const vec2<T>& );
+
+		/**
+		 * Returns on which side of the plane through a, b and c the point d
+		 * lies: 1 if it is on the side the normal (b - a) x (c - a) points
+		 * to, -1 on the other side and 0 on the plane. Exact, like orient2D().
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		int orient3D(const vec3<T>& , const vec3<T>& , const vec3<T>& , const vec3<T>& );
+
+		/**
+		 * Returns 1 if d lies inside the circle through a, b and c, -1 if
+		 * outside and 0 on it. a, b and c must be counter-clockwise, or the
+		 * sign flips. Exact, like orient2D().
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		int inCircle(const vec2<T>& , const vec2<T>& , const vec2<T>& , const vec2<T>& );
+
+		namespace Internal {
+			template<typename T>
+			struct intervalBits;
+
+			template<>
+			struct intervalBits<float> {
+				typedef uint32_t type;
+				// 2^12 + 1, for Dekker's product.
+				static constexpr float splitter() { return 4097.0f; }
+			};
+
+			template<>
+			struct intervalBits<double> {
+				typedef uint64_t type;
+				// 2^27 + 1, for Dekker's product.
+				static constexpr double splitter() { return 134217729.0; }
+			};
+
+			// A number above x by at least one unit in the last place, and at
+			// most two: since rounding is monotonic, x + |x| epsilon rounds to
+			// at least the next representable number. It is branch free,
+			// which matters as the signs are unpredictable. Overflowed results
+			// come back from -infinity to the lowest finite value.
+			template<typename T>
+			inline T intervalUp(T x)
+			{
+				typedef std::numeric_limits<T> limits;
+				const T y = x + (std::fabs(x) * limits::epsilon() + limits::denorm_min());
+				return x == -limits::infinity() ? -limits::max() : y;
+			}
+
+			// A number below x by one or two units in the last place.
+			template<typename T>
+			inline T intervalDown(T x)
+			{
+				return -intervalUp(-x);
+			}
+
+			// A product where zero times infinity is zero, as interval
+			// arithmetic wants.
+			template<typename T>
+			inline T intervalProduct(T a, T b)
+			{
+				return a == 0 || b == 0 ? T(0) : a * b;
+			}
+
+			// a + b = x + y exactly, where x is the rounded sum.
+			template<typename T>
+			inline void twoSum(T a, T b, T& x, T& y)
+			{
+				x = a + b;
+				const T bv = x - a;
+				const T av = x - bv;
+				y = (a - av) + (b - bv);
+			}
+
+			// The same, when |a| >= |b|.
+			template<typename T>
+			inline void fastTwoSum(T a, T b, T& x, T& y)
+			{
+				x = a + b;
+				y = b - (x - a);
+			}
+
+			// a * b = x + y exactly, where x is the rounded product.
+			template<typename T>
+			inline void twoProduct(T a, T b, T& x, T& y)
+			{
+				x = a * b;
+				const T s = intervalBits<T>::splitter();
+				const T ac = s * a, bc = s * b;
+				const T ahi = ac - (ac - a), bhi = bc - (bc - b);
+				const T alo = a - ahi, blo = b - bhi;
+				y = alo * blo - (((x - ahi * bhi) - alo * bhi) - ahi * blo);
+			}
+
+			// A nonoverlapping expansion: a sum of floats in increasing
+			// magnitude whose exact value is the sum of its components, as
+			// in Shewchuk's "Adaptive Precision Floating-Point Arithmetic".
+			template<typename T, int Capacity>
+			struct expansion {
+				expansion() : n(0) {}
+
+				// Adds b, dropping zero components.
+				void add(T b)
+				{
+					int k = 0;
+					T q = b;
+					for(int i = 0; i < n; i++)
+					{
+						T sum, error;
+						twoSum(q, e[i], sum, error);
+						if(error != 0)
+							e[k++] = error;
+						q = sum;
+					}
+					if(q != 0 || k == 0)
+						e[k++] = q;
+					n = k;
+				}
+
+				// Adds the product of the factors, times sign.
+				void addProduct(const T* factors, int count, T sign)
+				{
+					T p[16], h[16];
+					int m = 1;
+					p[0] = factors[0] * sign;
+					for(int f = 1; f < count; f++)
+					{
+						const T b = factors[f];
+						int k = 0;
+						T q, low;
+						twoProduct(p[0], b, q, low);
+						if(low != 0)
+							h[k++] = low;
+						for(int i = 1; i < m; i++)
+						{
+							T high, sum, error;
+							twoProduct(p[i], b, high, low);
+							twoSum(q, low, sum, error);
+							if(error != 0)
+								h[k++] = error;
+							fastTwoSum(high, sum, q, error);
+							if(error != 0)
+								h[k++] = error;
+						}
+						if(q != 0 || k == 0)
+							h[k++] = q;
+						std::copy(h, h + k, p);
+						m = k;
+					}
+					for(int i = 0; i < m; i++)
+						add(p[i]);
+				}
+
+				// The largest component carries the sign.
+				int sign() const
+				{
+					const T top = n > 0 ? e[n - 1] : T(0);
+					return top > 0 ? 1 : top < 0 ? -1 : 0;
+				}
+
+				T e[Capacity];
+				int n;
+			};
+
+			// Calls term(rows, sign) for each permutation of N rows, with the
+			// sign of the permutation: the terms of Leibniz's determinant.
+			template<int N, typename F>
+			inline void leibniz(F term)
+			{
+				int rows[N];
+				for(int i = 0; i < N; i++)
+					rows[i] = i;
+				do {
+					int inversions = 0;
+					for(int i = 0; i < N; i++)
+						for(int j = i + 1; j < N; j++)
+							inversions += rows[i] > rows[j];
+					term(rows, inversions % 2 ? -1 : 1);
+				} while(std::next_permutation(rows, rows + N));
+			}
+
+			// The exact signs, from determinants of the points with a last
+			// column of ones, expanded into products of coordinates.
+			template<typename T>
+			inline int exactOrient2D(const vec2<T>& a, const vec2<T>& b, const vec2<T>& c)
+			{
+				const vec2<T> p[3] = { a, b, c };
+				expansion<T, 16> sum;
+				leibniz<3>([&](const int* r, int sign) {
+					const T f[2] = { p[r[0]].x, p[r[1]].y };
+					sum.addProduct(f, 2, T(sign));
+				});
+				return sum.sign();
+			}
+
+			template<typename T>
+			inline int exactOrient3D(const vec3<T>& a, const vec3<T>& b, const vec3<T>& c, const vec3<T>& d)
+			{
+				const vec3<T> p[4] = { a, b, c, d };
+				expansion<T, 128> sum;
+				leibniz<4>([&](const int* r, int sign) {
+					const T f[3] = { p[r[0]].x, p[r[1]].y, p[r[2]].z };
+					sum.addProduct(f, 3, T(-sign));
+				});
+				return sum.sign();
+			}
+
+			template<typename T>
+			inline int exactInCircle(const vec2<T>& a, const vec2<T>& b, const vec2<T>& c, const vec2<T>& d)
+			{
+				// The lifted column x^2 + y^2 splits into two determinants.
+				const vec2<T> p[4] = { a, b, c, d };
+				expansion<T, 512> sum;
+				leibniz<4>([&](const int* r, int sign) {
+					const vec2<T>& l = p[r[2]];
+					const T fx[4] = { p[r[0]].x, p[r[1]].y, l.x, l.x };
+					const T fy[4] = { p[r[0]].x, p[r[1]].y, l.y, l.y };
+					sum.addProduct(fx, 4, T(sign));
+					sum.addProduct(fy, 4, T(sign));
+				});
+				return sum.sign();
+			}
+		}
+
+		// Inline definitions
+		template<typename T>
+		inline interval<T> interval<T>::whole()
+		{
+			return interval(-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity());
+		}
+
+		template<typename T>
+		inline T interval<T>::mid() const
+		{
+			return lo / 2 + hi / 2;
+		}
+
+		template<typename T>
+		inline T interval<T>::width() const
+		{
+			return Internal::intervalUp(hi - lo);
+		}
+
+		template<typename T>
+		inline bool interval<T>::contains(T v) const
+		{
+			return lo <= v && v <= hi;
+		}
+
+		template<typename T>
+		inline int interval<T>::sign() const
+		{
+			return lo > 0 ? 1 : hi < 0 ? -1 : 0;
+		}
+
+		template<typename T>
+		inline interval<T> interval<T>::operator-() const
+		{
+			return interval(-hi, -lo);
+		}
+
+		template<typename T>
+		inline interval<T>& interval<T>::operator+=(const interval<T>& other)
+		{
+			lo = Internal::intervalDown(lo + other.lo);
+			hi = Internal::intervalUp(hi + other.hi);
+			return *this;
+		}
+
+		template<typename T>
+		inline interval<T>& interval<T>::operator-=(const interval<T>& other)
+		{
+			lo = Internal::intervalDown(lo - other.hi);
+			hi = Internal::intervalUp(hi - other.lo);
+			return *this;
+		}
+
+		template<typename T>
+		inline interval<T>& interval<T>::operator*=(const interval<T>& other)
+		{
+			using Internal::intervalProduct;
+			const T a = intervalProduct(lo, other.lo), b = intervalProduct(lo, other.hi);
+			const T c = intervalProduct(hi, other.lo), d = intervalProduct(hi, other.hi);
+			lo = Internal::intervalDown(std::min(std::min(a, b), std::min(c, d)));
+			hi = Internal::intervalUp(std::max(std::max(a, b), std::max(c, d)));
+			return *this;
+		}
+
+		template<typename T>
+		inline interval<T>& interval<T>::operator/=(const interval<T>& other)
+		{
+			if(other.lo <= 0 && other.hi >= 0)
+				return *this = whole();
+			const T a = lo / other.lo, b = lo / other.hi;
+			const T c = hi / other.lo, d = hi / other.hi;
+			lo = Internal::intervalDown(std::min(std::min(a, b), std::min(c, d)));
+			hi = Internal::intervalUp(std::max(std::max(a, b), std::max(c, d)));
+			return *this;
+		}
+
+		// Template implementation
+		template<typename T>
+		interval<T> sqrt(const interval<T>& x)
+		{
+			if(x.hi < 0)
+				return interval<T>(std::numeric_limits<T>::quiet_NaN());
+			const T lo = x.lo > 0 ? std::max(T(0), Internal::intervalDown(std::sqrt(x.lo))) : T(0);
+			return interval<T>(lo, Internal::intervalUp(std::sqrt(x.hi)));
+		}
+
+		template<typename T>
+		interval<T> abs(const interval<T>& x)
+		{
+			if(x.lo >= 0)
+				return x;
+			if(x.hi <= 0)
+				return -x;
+			return interval<T>(0, std::max(-x.lo, x.hi));
+		}
+
+		template<typename T>
+		int orient2D(const vec2<T>& a, const vec2<T>& b, const vec2<T>& c)
+		{
+			typedef interval<T> I;
+			const I det = (I(b.x) - I(a.x)) * (I(c.y) - I(a.y)) - (I(b.y) - I(a.y)) * (I(c.x) - I(a.x));
+			if(det.sign() != 0)
+				return det.sign();
+			return Internal::exactOrient2D(a, b, c);
+		}
+
+		template<typename T>
+		int orient3D(const vec3<T>& a, const vec3<T>& b, const vec3<T>& c, const vec3<T>& d)
+		{
+			typedef vec3<interval<T>> V;
+			const V ia(a.x, a.y, a.z);
+			const V ab = V(b.x, b.y, b.z) - ia, ac = V(c.x, c.y, c.z) - ia, ad = V(d.x, d.y, d.z) - ia;
+			const interval<T> det = ab.cross(ac).dot(ad);
+			if(det.sign() != 0)
+				return det.sign();
+			return Internal::exactOrient3D(a, b, c, d);
+		}
+
+		template<typename T>
+		int inCircle(const vec2<T>& a, const vec2<T>& b, const vec2<T>& c, const vec2<T>& d)
+		{
+			typedef interval<T> I;
+			const I adx = I(a.x) - I(d.x), ady = I(a.y) - I(d.y);
+			const I bdx = I(b.x) - I(d.x), bdy = I(b.y) - I(d.y);
+			const I cdx = I(c.x) - I(d.x), cdy = I(c.y) - I(d.y);
+			const I det = (adx * adx + ady * ady) * (bdx * cdy - bdy * cdx)
+				+ (bdx * bdx + bdy * bdy) * (cdx * ady - cdy * adx)
+				+ (cdx * cdx + cdy * cdy) * (adx * bdy - ady * bdx);
+			if(det.sign() != 0)
+				return det.sign();
+			return Internal::exactInCircle(a, b, c, d);
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_INTERVAL_H
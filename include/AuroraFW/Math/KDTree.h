@@ -0,0 +1,480 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/KDTree.h
+ * k-d tree header. This contains a balanced k-d tree over 2D or 3D
+ * points answering nearest neighbour, k nearest neighbours and radius
+ * queries.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_KDTREE_H
+#define AURORAFW_MATH_KDTREE_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/VectorTraits.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A balanced k-d tree over vec2<T> or vec3<T> points. Every node
+		 * splits its points at the median of the axis with the largest
+		 * spread, so the tree is implicit: only the split planes are
+		 * stored, and the points are reordered so that every leaf is a
+		 * contiguous bucket of at most LeafSize points.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		class AFW_API kdtree {
+		public:
+			typedef typename vecTraits<V>::scalar T;
+
+			enum {
+				/** Number of coordinates of a point. */
+				Dimension = vecTraits<V>::Dimension,
+				/** Maximum number of points in a leaf. */
+				LeafSize = 16
+			};
+
+			/** The index reported for missing neighbours. */
+			static constexpr uint32_t InvalidIndex = 0xFFFFFFFFu;
+
+			/** Constructs an empty tree.
+			 * @since snapshot20261019
+			 */
+			kdtree();
+
+			/** Builds the tree over a copy of the given points, splitting
+			 * independent subtrees across hardware threads.
+			 * @param points The points.
+			 * @param count The number of points.
+			 * @since snapshot20261019
+			 */
+			void build(const V* , size_t );
+
+			/** Returns the number of points in the tree.
+			 * @since snapshot20261019
+			 */
+			size_t size() const;
+
+			/** Finds the point closest to the query.
+			 * @param query The query point.
+			 * @param index Receives the index of the closest point, as given to build().
+			 * @param distanceSquared Receives the squared distance to it.
+			 * @return <code>false</code> if the tree is empty.
+			 * @since snapshot20261019
+			 */
+			bool nearest(const V& , uint32_t& , T& ) const;
+
+			/** Finds the k points closest to the query.
+			 * @param query The query point.
+			 * @param k The number of neighbours to find.
+			 * @param indices Receives the neighbour indices, closest first. Must
+			 * have room for k entries.
+			 * @param distancesSquared Receives the squared distances, one per
+			 * neighbour. Must have room for k entries.
+			 * @return The number of neighbours found, at most k.
+			 * @since snapshot20261019
+			 */
+			size_t knn(const V& , size_t , uint32_t* , T* ) const;
+
+			/** Finds the k nearest neighbours of many queries in parallel.
+			 * Queries with fewer than k neighbours get InvalidIndex and the
+			 * biggest T in their remaining entries.
+			 * @param queries The query points.
+			 * @param count The number of queries.
+			 * @param k The number of neighbours per query.
+			 * @param indices Receives k indices per query.
+			 * @param distancesSquared Receives k squared distances per query.
+			 * @since snapshot20261019
+			 */
+			void knn(const V* , size_t , size_t , uint32_t* , T* ) const;
+
+			/** Finds all points within the given radius of the query.
+			 * @param query The query point.
+			 * @param radius The search radius.
+			 * @param indices Receives the indices of the points found, in no
+			 * particular order. Previous contents are kept.
+			 * @return The number of points found.
+			 * @since snapshot20261019
+			 */
+			size_t radius(const V& , T , std::vector<uint32_t>& ) const;
+
+			/** Finds all points within the given radius of many queries in
+			 * parallel. The neighbours of query i are
+			 * indices[offsets[i]] to indices[offsets[i + 1] - 1].
+			 * @param queries The query points.
+			 * @param count The number of queries.
+			 * @param radius The search radius.
+			 * @param offsets Receives count + 1 offsets into indices.
+			 * @param indices Receives the neighbours of all queries.
+			 * @since snapshot20261019
+			 */
+			void radius(const V* , size_t , T , std::vector<size_t>& , std::vector<uint32_t>& ) const;
+
+			/** Returns the points in leaf order.
+			 * @see ids()
+			 * @since snapshot20261019
+			 */
+			const std::vector<V>& points() const;
+
+			/** Returns, for every point in leaf order, its index as given
+			 * to build().
+			 * @see points()
+			 * @since snapshot20261019
+			 */
+			const std::vector<uint32_t>& ids() const;
+
+		private:
+			struct heap {
+				uint32_t* ids;
+				T* dist;
+				size_t size;
+				size_t capacity;
+
+				T worst() const;
+				void push(T , uint32_t );
+				void sort();
+				void siftDown(size_t , size_t );
+			};
+
+			template<typename F>
+			void search(const V& , T& , F& ) const;
+
+			std::vector<V> m_points;
+			std::vector<uint32_t> m_ids;
+			std::vector<T> m_split;
+			std::vector<uint8_t> m_axis;
+			int m_depth;
+		};
+
+		typedef kdtree<vec2<float>> KDTree2D;
+		typedef kdtree<vec3<float>> KDTree3D;
+
+		template<typename V>
+		constexpr uint32_t kdtree<V>::InvalidIndex;
+
+		// Inline definitions
+		template<typename V>
+		inline size_t kdtree<V>::size() const
+		{
+			return m_points.size();
+		}
+
+		template<typename V>
+		inline const std::vector<V>& kdtree<V>::points() const
+		{
+			return m_points;
+		}
+
+		template<typename V>
+		inline const std::vector<uint32_t>& kdtree<V>::ids() const
+		{
+			return m_ids;
+		}
+
+		// Template implementation
+		template<typename V>
+		kdtree<V>::kdtree()
+			: m_depth(0)
+		{}
+
+		template<typename V>
+		void kdtree<V>::build(const V* points, size_t count)
+		{
+			typedef vecTraits<V> traits;
+
+			// Split every leaf the same number of times, so that nodes are
+			// numbered implicitly: the children of node n are 2n+1 and 2n+2.
+			m_depth = 0;
+			while(((count + (size_t(1) << m_depth) - 1) >> m_depth) > LeafSize)
+				m_depth++;
+
+			struct entry {
+				V p;
+				uint32_t id;
+			};
+			std::vector<entry> entries(count);
+			parallelFor(count, 1 << 16, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					entries[i] = { points[i], static_cast<uint32_t>(i) };
+			});
+
+			m_split.assign((size_t(1) << m_depth) - 1, T(0));
+			m_axis.assign(m_split.size(), 0);
+
+			std::vector<size_t> bounds = { 0, count };
+			for(int level = 0; level < m_depth; level++)
+			{
+				const size_t nodes = size_t(1) << level;
+				std::vector<size_t> next(nodes * 2 + 1);
+				parallelFor(nodes, 1, [&](size_t first, size_t last, size_t) {
+					for(size_t j = first; j < last; j++)
+					{
+						const size_t begin = bounds[j], end = bounds[j + 1];
+						const size_t mid = begin + (end - begin) / 2;
+						const size_t node = nodes - 1 + j;
+						next[2 * j] = begin;
+						next[2 * j + 1] = mid;
+						next[2 * j + 2] = end;
+						if(begin == end)
+							continue;
+
+						T lo[Dimension], hi[Dimension];
+						for(int a = 0; a < Dimension; a++)
+							lo[a] = hi[a] = traits::get(entries[begin].p, a);
+						for(size_t i = begin + 1; i < end; i++)
+						{
+							for(int a = 0; a < Dimension; a++)
+							{
+								const T v = traits::get(entries[i].p, a);
+								lo[a] = v < lo[a] ? v : lo[a];
+								hi[a] = v > hi[a] ? v : hi[a];
+							}
+						}
+
+						int axis = 0;
+						for(int a = 1; a < Dimension; a++)
+						{
+							if(hi[a] - lo[a] > hi[axis] - lo[axis])
+								axis = a;
+						}
+
+						std::nth_element(entries.begin() + begin, entries.begin() + mid, entries.begin() + end,
+							[axis](const entry& a, const entry& b) {
+								return traits::get(a.p, axis) < traits::get(b.p, axis);
+							});
+						m_axis[node] = static_cast<uint8_t>(axis);
+						m_split[node] = mid < end ? traits::get(entries[mid].p, axis) : lo[axis];
+					}
+				});
+				bounds.swap(next);
+			}
+
+			m_points.resize(count);
+			m_ids.resize(count);
+			parallelFor(count, 1 << 16, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					m_points[i] = entries[i].p;
+					m_ids[i] = entries[i].id;
+				}
+			});
+		}
+
+		template<typename V>
+		template<typename F>
+		void kdtree<V>::search(const V& query, T& bound, F& visitLeaf) const
+		{
+			typedef vecTraits<V> traits;
+
+			struct entry {
+				size_t node, begin, end;
+				int level;
+				T distance;
+			};
+			entry stack[64];
+			int sp = 0;
+			stack[sp++] = { 0, 0, m_points.size(), 0, T(0) };
+
+			while(sp > 0)
+			{
+				const entry e = stack[--sp];
+				if(e.distance > bound)
+					continue;
+
+				if(e.level == m_depth)
+				{
+					visitLeaf(e.begin, e.end);
+					continue;
+				}
+
+				const size_t mid = e.begin + (e.end - e.begin) / 2;
+				const T diff = traits::get(query, m_axis[e.node]) - m_split[e.node];
+				const entry left = { 2 * e.node + 1, e.begin, mid, e.level + 1, diff > 0 ? diff * diff : e.distance };
+				const entry right = { 2 * e.node + 2, mid, e.end, e.level + 1, diff < 0 ? diff * diff : e.distance };
+
+				// Visit the side of the split plane holding the query first.
+				if(diff < 0)
+				{
+					stack[sp++] = right;
+					stack[sp++] = left;
+				}
+				else
+				{
+					stack[sp++] = left;
+					stack[sp++] = right;
+				}
+			}
+		}
+
+		template<typename V>
+		typename kdtree<V>::T kdtree<V>::heap::worst() const
+		{
+			return size < capacity ? std::numeric_limits<T>::max() : dist[0];
+		}
+
+		template<typename V>
+		void kdtree<V>::heap::siftDown(size_t i, size_t n)
+		{
+			for(;;)
+			{
+				size_t largest = i;
+				const size_t l = 2 * i + 1, r = 2 * i + 2;
+				if(l < n && dist[l] > dist[largest]) largest = l;
+				if(r < n && dist[r] > dist[largest]) largest = r;
+				if(largest == i)
+					return;
+				std::swap(dist[i], dist[largest]);
+				std::swap(ids[i], ids[largest]);
+				i = largest;
+			}
+		}
+
+		template<typename V>
+		void kdtree<V>::heap::push(T d, uint32_t id)
+		{
+			if(size < capacity)
+			{
+				size_t i = size++;
+				dist[i] = d;
+				ids[i] = id;
+				while(i > 0 && dist[(i - 1) / 2] < dist[i])
+				{
+					std::swap(dist[i], dist[(i - 1) / 2]);
+					std::swap(ids[i], ids[(i - 1) / 2]);
+					i = (i - 1) / 2;
+				}
+			}
+			else if(d < dist[0])
+			{
+				dist[0] = d;
+				ids[0] = id;
+				siftDown(0, size);
+			}
+		}
+
+		template<typename V>
+		void kdtree<V>::heap::sort()
+		{
+			for(size_t n = size; n > 1; n--)
+			{
+				std::swap(dist[0], dist[n - 1]);
+				std::swap(ids[0], ids[n - 1]);
+				siftDown(0, n - 1);
+			}
+		}
+
+		template<typename V>
+		size_t kdtree<V>::knn(const V& query, size_t k, uint32_t* indices, T* distancesSquared) const
+		{
+			if(k == 0 || m_points.empty())
+				return 0;
+
+			heap h = { indices, distancesSquared, 0, k };
+			T bound = std::numeric_limits<T>::max();
+			auto visitLeaf = [&](size_t begin, size_t end) {
+				for(size_t i = begin; i < end; i++)
+					h.push(distanceSquared(query, m_points[i]), m_ids[i]);
+				bound = h.worst();
+			};
+			search(query, bound, visitLeaf);
+
+			h.sort();
+			return h.size;
+		}
+
+		template<typename V>
+		bool kdtree<V>::nearest(const V& query, uint32_t& index, T& distSquared) const
+		{
+			return knn(query, 1, &index, &distSquared) == 1;
+		}
+
+		template<typename V>
+		void kdtree<V>::knn(const V* queries, size_t count, size_t k, uint32_t* indices, T* distancesSquared) const
+		{
+			parallelFor(count, 256, [=](size_t begin, size_t end, size_t) {
+				for(size_t q = begin; q < end; q++)
+				{
+					size_t found = knn(queries[q], k, indices + q * k, distancesSquared + q * k);
+					for(size_t i = found; i < k; i++)
+					{
+						indices[q * k + i] = InvalidIndex;
+						distancesSquared[q * k + i] = std::numeric_limits<T>::max();
+					}
+				}
+			});
+		}
+
+		template<typename V>
+		size_t kdtree<V>::radius(const V& query, T r, std::vector<uint32_t>& indices) const
+		{
+			if(m_points.empty())
+				return 0;
+
+			const size_t before = indices.size();
+			T bound = r * r;
+			auto visitLeaf = [&](size_t begin, size_t end) {
+				for(size_t i = begin; i < end; i++)
+				{
+					if(distanceSquared(query, m_points[i]) <= bound)
+						indices.push_back(m_ids[i]);
+				}
+			};
+			search(query, bound, visitLeaf);
+
+			return indices.size() - before;
+		}
+
+		template<typename V>
+		void kdtree<V>::radius(const V* queries, size_t count, T r, std::vector<size_t>& offsets,
+			std::vector<uint32_t>& indices) const
+		{
+			offsets.assign(count + 1, 0);
+			std::vector<std::vector<uint32_t>> found(parallelChunkCount(count, 256));
+			parallelFor(count, 256, [&](size_t begin, size_t end, size_t chunk) {
+				for(size_t q = begin; q < end; q++)
+					offsets[q + 1] = radius(queries[q], r, found[chunk]);
+			});
+
+			for(size_t q = 0; q < count; q++)
+				offsets[q + 1] += offsets[q];
+
+			indices.clear();
+			indices.reserve(offsets[count]);
+			for(const std::vector<uint32_t>& chunk : found)
+				indices.insert(indices.end(), chunk.begin(), chunk.end());
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_KDTREE_H
@@ -30,6 +30,8 @@
 
 #include <AuroraFW/Internal/Config.h>
 
+#include <AuroraFW/Math/Utils.h>
+
 namespace AuroraFW {
 	namespace Math {
 		template<typename T, uint m, uint n>
@@ -89,7 +91,7 @@ namespace AuroraFW {
 					data[col][row] = sum;
 				}
 			}
-			memcpy(m, data, 4 * 4 * sizeof(float));
+			memcpy(matrix, data, 4 * 4 * sizeof(T));
 			return *this;
 		}
 
@@ -144,6 +146,47 @@ namespace AuroraFW {
 			return ret;
 		}
 
+		template<typename T, uint m, uint n>
+		mat<T, m, n> mat<T, m, n>::perspective(T fov, T aspectRatio, T near_, T far_)
+		{
+			mat<T, m, n> ret(1.0f);
+
+			T q = 1.0f / tan(toRadians(0.5f * fov));
+			ret.matrix[0][0] = q / aspectRatio;
+			ret.matrix[1][1] = q;
+			ret.matrix[2][2] = (near_ + far_) / (near_ - far_);
+			ret.matrix[2][3] = -1.0f;
+			ret.matrix[3][2] = (2.0f * near_ * far_) / (near_ - far_);
+			ret.matrix[3][3] = 0.0f;
+
+			return ret;
+		}
+
+		template<typename T, uint m, uint n>
+		mat<T, m, n> mat<T, m, n>::lookAt(const vec3<T>& camera, const vec3<T>& object, const vec3<T>& up)
+		{
+			mat<T, m, n> ret(1.0f);
+
+			vec3<T> f = vec3<T>(object.x - camera.x, object.y - camera.y, object.z - camera.z).normalized();
+			vec3<T> s = f.cross(up.normalized()).normalized();
+			vec3<T> u = s.cross(f);
+
+			ret.matrix[0][0] = s.x;
+			ret.matrix[1][0] = s.y;
+			ret.matrix[2][0] = s.z;
+			ret.matrix[0][1] = u.x;
+			ret.matrix[1][1] = u.y;
+			ret.matrix[2][1] = u.z;
+			ret.matrix[0][2] = -f.x;
+			ret.matrix[1][2] = -f.y;
+			ret.matrix[2][2] = -f.z;
+			ret.matrix[3][0] = -s.dot(camera);
+			ret.matrix[3][1] = -u.dot(camera);
+			ret.matrix[3][2] = f.dot(camera);
+
+			return ret;
+		}
+
 		template<typename T, uint m, uint n>
 		mat<T, m, n> mat<T, m, n>::translate(const vec3<T>& vec)
 		{
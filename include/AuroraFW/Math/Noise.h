@@ -0,0 +1,747 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Noise.h
+ * Noise header. This contains seeded Perlin, simplex and Worley noise
+ * in 2, 3 and 4 dimensions, with fractal layering and batch fills of
+ * point spans and regular grids.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_NOISE_H
+#define AURORAFW_MATH_NOISE_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <cmath>
+#include <cstdint>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * The kinds of noise a noise generator produces.
+		 * @since snapshot20261019
+		 */
+		enum NoiseType {
+			/** Gradient noise on a square grid, in about [-1, 1]. */
+			PerlinNoise,
+			/** Gradient noise on a simplex grid, in about [-1, 1]. Cheaper than
+			 * Perlin noise in 3D and 4D, with fewer axis-aligned artifacts. */
+			SimplexNoise,
+			/** Distance to the nearest of one random feature point per cell,
+			 * in [0, about 1]. */
+			WorleyNoise
+		};
+
+		/**
+		 * Fractal Brownian motion settings: octaves of noise at growing
+		 * frequencies and shrinking amplitudes, summed and divided by the
+		 * total amplitude so the range matches a single octave.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API fractal {
+			/** Constructs fractal settings.
+			 * @param octaves The number of octaves, 1 for plain noise.
+			 * @param lacunarity The frequency multiplier between octaves.
+			 * @param gain The amplitude multiplier between octaves.
+			 * @since snapshot20261019
+			 */
+			fractal(int = 1, T = T(2), T = T(0.5));
+
+			int octaves;
+			T lacunarity;
+			T gain;
+		};
+
+		/**
+		 * A seeded noise generator. Lattice points are hashed with 32 bit
+		 * integer arithmetic instead of a shuffled table, so the same seed
+		 * gives the same noise on every machine, and a generator is just
+		 * its seed.
+		 *
+		 * The batch fills are split across threads and their inner loops
+		 * are branch free so the compiler can vectorize them.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API noise {
+		public:
+			/** Constructs a noise generator.
+			 * @param seed The seed.
+			 * @since snapshot20261019
+			 */
+			explicit noise(uint32_t = 0);
+
+			/** Returns the seed.
+			 * @since snapshot20261019
+			 */
+			uint32_t seed() const;
+
+			/** Returns Perlin noise at the given point.
+			 * @since snapshot20261019
+			 */
+			T perlin(const vec2<T>& ) const;
+			T perlin(const vec3<T>& ) const;
+			T perlin(const vec4<T>& ) const;
+
+			/** Returns simplex noise at the given point.
+			 * @since snapshot20261019
+			 */
+			T simplex(const vec2<T>& ) const;
+			T simplex(const vec3<T>& ) const;
+			T simplex(const vec4<T>& ) const;
+
+			/** Returns Worley (cellular) noise at the given point.
+			 * @since snapshot20261019
+			 */
+			T worley(const vec2<T>& ) const;
+			T worley(const vec3<T>& ) const;
+			T worley(const vec4<T>& ) const;
+
+			/** Returns fractal noise at the given point. Each octave uses
+			 * its own seed so the octaves do not line up.
+			 * @param type The kind of noise.
+			 * @param p The point.
+			 * @param settings The fractal settings.
+			 * @since snapshot20261019
+			 */
+			T fbm(NoiseType , const vec2<T>& , const fractal<T>& ) const;
+			T fbm(NoiseType , const vec3<T>& , const fractal<T>& ) const;
+			T fbm(NoiseType , const vec4<T>& , const fractal<T>& ) const;
+
+			/** Evaluates noise at many points, in parallel for large batches.
+			 * @param type The kind of noise.
+			 * @param points The points, as a structure of arrays.
+			 * @param values Receives one value per point.
+			 * @param settings The fractal settings.
+			 * @since snapshot20261019
+			 */
+			void fill(NoiseType , const vec2SoA<const T>& , T* , const fractal<T>& = fractal<T>()) const;
+			void fill(NoiseType , const vec3SoA<const T>& , T* , const fractal<T>& = fractal<T>()) const;
+			void fill(NoiseType , const vec4SoA<const T>& , T* , const fractal<T>& = fractal<T>()) const;
+
+			/** Fills a 2D grid of samples, row by row. Rows are split
+			 * across threads in blocks.
+			 * @param type The kind of noise.
+			 * @param origin The point of the first sample.
+			 * @param spacing The distance between samples along each axis.
+			 * @param width The number of samples per row.
+			 * @param height The number of rows.
+			 * @param values Receives the sample at column x and row y in
+			 * values[y * width + x].
+			 * @param settings The fractal settings.
+			 * @since snapshot20261019
+			 */
+			void fillGrid(NoiseType , const vec2<T>& , const vec2<T>& , size_t , size_t , T* ,
+				const fractal<T>& = fractal<T>()) const;
+
+			/** Fills a 3D grid of samples, slice by slice.
+			 * @param type The kind of noise.
+			 * @param origin The point of the first sample.
+			 * @param spacing The distance between samples along each axis.
+			 * @param width The number of samples per row.
+			 * @param height The number of rows per slice.
+			 * @param depth The number of slices.
+			 * @param values Receives the sample at (x, y, z) in
+			 * values[(z * height + y) * width + x].
+			 * @param settings The fractal settings.
+			 * @since snapshot20261019
+			 */
+			void fillGrid(NoiseType , const vec3<T>& , const vec3<T>& , size_t , size_t , size_t , T* ,
+				const fractal<T>& = fractal<T>()) const;
+
+		private:
+			uint32_t m_seed;
+		};
+
+		typedef noise<float> Noise;
+
+		namespace Internal {
+			constexpr size_t NoiseGrain = 1 << 12;
+
+			inline uint32_t noiseMix(uint32_t h)
+			{
+				h ^= h >> 16;
+				h *= 0x7FEB352Du;
+				h ^= h >> 15;
+				h *= 0x846CA68Bu;
+				h ^= h >> 16;
+				return h;
+			}
+
+			inline uint32_t noiseHash(uint32_t seed, int32_t x, int32_t y)
+			{
+				return noiseMix(seed ^ (uint32_t(x) * 0x8DA6B343u) ^ (uint32_t(y) * 0xD8163841u));
+			}
+
+			inline uint32_t noiseHash(uint32_t seed, int32_t x, int32_t y, int32_t z)
+			{
+				return noiseMix(seed ^ (uint32_t(x) * 0x8DA6B343u) ^ (uint32_t(y) * 0xD8163841u) ^ (uint32_t(z) * 0xCB1AB31Fu));
+			}
+
+			inline uint32_t noiseHash(uint32_t seed, int32_t x, int32_t y, int32_t z, int32_t w)
+			{
+				return noiseMix(seed ^ (uint32_t(x) * 0x8DA6B343u) ^ (uint32_t(y) * 0xD8163841u)
+					^ (uint32_t(z) * 0xCB1AB31Fu) ^ (uint32_t(w) * 0x165667B1u));
+			}
+
+			// Floor without a call into the C library, so loops vectorize.
+			// Converting NaN or values outside int32_t is undefined, so they
+			// are clamped first: NaN goes to the lower end. 2^31 - 128 is the
+			// largest float below 2^31.
+			template<typename T>
+			inline int32_t noiseFloor(T v)
+			{
+				const T lo = T(-2147483648.0), hi = T(2147483520.0);
+				v = v > lo ? (v < hi ? v : hi) : lo;
+				const int32_t i = static_cast<int32_t>(v);
+				return i - static_cast<int32_t>(v < T(i));
+			}
+
+			template<typename T>
+			inline T noiseFade(T t)
+			{
+				return t * t * t * (t * (t * 6 - 15) + 10);
+			}
+
+			template<typename T>
+			inline T noiseLerp(T a, T b, T t)
+			{
+				return a + (b - a) * t;
+			}
+
+			// Gradients as in Gustavson's reference implementations: 8
+			// directions in 2D, the 12 cube edges in 3D and 32 in 4D. The
+			// kernels below scale their sums to about [-1, 1] for these.
+			template<typename T>
+			inline T noiseGradient(uint32_t h, T x, T y)
+			{
+				h &= 7;
+				const T u = h < 4 ? x : y;
+				const T v = h < 4 ? y : x;
+				return ((h & 1) ? -u : u) + ((h & 2) ? -2 * v : 2 * v);
+			}
+
+			template<typename T>
+			inline T noiseGradient(uint32_t h, T x, T y, T z)
+			{
+				h &= 15;
+				const T u = h < 8 ? x : y;
+				const T v = h < 4 ? y : (h == 12 || h == 14) ? x : z;
+				return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+			}
+
+			template<typename T>
+			inline T noiseGradient(uint32_t h, T x, T y, T z, T w)
+			{
+				h &= 31;
+				const T u = h < 24 ? x : y;
+				const T v = h < 16 ? y : z;
+				const T s = h < 8 ? z : w;
+				return ((h & 1) ? -u : u) + ((h & 2) ? -v : v) + ((h & 4) ? -s : s);
+			}
+
+			template<typename T>
+			T perlinNoise(T x, T y, uint32_t seed)
+			{
+				const int32_t ix = noiseFloor(x), iy = noiseFloor(y);
+				const T fx = x - T(ix), fy = y - T(iy);
+				const T u = noiseFade(fx), v = noiseFade(fy);
+
+				const T n00 = noiseGradient(noiseHash(seed, ix, iy), fx, fy);
+				const T n10 = noiseGradient(noiseHash(seed, ix + 1, iy), fx - 1, fy);
+				const T n01 = noiseGradient(noiseHash(seed, ix, iy + 1), fx, fy - 1);
+				const T n11 = noiseGradient(noiseHash(seed, ix + 1, iy + 1), fx - 1, fy - 1);
+				return T(0.66) * noiseLerp(noiseLerp(n00, n10, u), noiseLerp(n01, n11, u), v);
+			}
+
+			template<typename T>
+			T perlinNoise(T x, T y, T z, uint32_t seed)
+			{
+				const int32_t ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z);
+				const T fx = x - T(ix), fy = y - T(iy), fz = z - T(iz);
+				const T u = noiseFade(fx), v = noiseFade(fy), w = noiseFade(fz);
+
+				T n[2];
+				for(int c = 0; c < 2; c++)
+				{
+					const T gz = fz - T(c);
+					const T n00 = noiseGradient(noiseHash(seed, ix, iy, iz + c), fx, fy, gz);
+					const T n10 = noiseGradient(noiseHash(seed, ix + 1, iy, iz + c), fx - 1, fy, gz);
+					const T n01 = noiseGradient(noiseHash(seed, ix, iy + 1, iz + c), fx, fy - 1, gz);
+					const T n11 = noiseGradient(noiseHash(seed, ix + 1, iy + 1, iz + c), fx - 1, fy - 1, gz);
+					n[c] = noiseLerp(noiseLerp(n00, n10, u), noiseLerp(n01, n11, u), v);
+				}
+				return noiseLerp(n[0], n[1], w);
+			}
+
+			template<typename T>
+			T perlinNoise(T x, T y, T z, T w, uint32_t seed)
+			{
+				const int32_t ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z), iw = noiseFloor(w);
+				const T fx = x - T(ix), fy = y - T(iy), fz = z - T(iz), fw = w - T(iw);
+				const T u = noiseFade(fx), v = noiseFade(fy), s = noiseFade(fz), t = noiseFade(fw);
+
+				T n[4];
+				for(int c = 0; c < 4; c++)
+				{
+					const int32_t cz = c & 1, cw = c >> 1;
+					const T gz = fz - T(cz), gw = fw - T(cw);
+					const T n00 = noiseGradient(noiseHash(seed, ix, iy, iz + cz, iw + cw), fx, fy, gz, gw);
+					const T n10 = noiseGradient(noiseHash(seed, ix + 1, iy, iz + cz, iw + cw), fx - 1, fy, gz, gw);
+					const T n01 = noiseGradient(noiseHash(seed, ix, iy + 1, iz + cz, iw + cw), fx, fy - 1, gz, gw);
+					const T n11 = noiseGradient(noiseHash(seed, ix + 1, iy + 1, iz + cz, iw + cw), fx - 1, fy - 1, gz, gw);
+					n[c] = noiseLerp(noiseLerp(n00, n10, u), noiseLerp(n01, n11, u), v);
+				}
+				return T(0.87) * noiseLerp(noiseLerp(n[0], n[1], s), noiseLerp(n[2], n[3], s), t);
+			}
+
+			template<typename T>
+			T simplexNoise(T x, T y, uint32_t seed)
+			{
+				const T F2 = T(0.36602540378443864676), G2 = T(0.21132486540518711775);
+				const T s = (x + y) * F2;
+				const int32_t i = noiseFloor(x + s), j = noiseFloor(y + s);
+				const T t = T(i + j) * G2;
+				const T x0 = x - (T(i) - t), y0 = y - (T(j) - t);
+
+				const int32_t i1 = x0 > y0, j1 = 1 - i1;
+				const T x1 = x0 - T(i1) + G2, y1 = y0 - T(j1) + G2;
+				const T x2 = x0 - 1 + 2 * G2, y2 = y0 - 1 + 2 * G2;
+
+				T t0 = T(0.5) - x0 * x0 - y0 * y0;
+				T t1 = T(0.5) - x1 * x1 - y1 * y1;
+				T t2 = T(0.5) - x2 * x2 - y2 * y2;
+				t0 = t0 > 0 ? t0 * t0 : T(0);
+				t1 = t1 > 0 ? t1 * t1 : T(0);
+				t2 = t2 > 0 ? t2 * t2 : T(0);
+
+				const T n = t0 * t0 * noiseGradient(noiseHash(seed, i, j), x0, y0)
+					+ t1 * t1 * noiseGradient(noiseHash(seed, i + i1, j + j1), x1, y1)
+					+ t2 * t2 * noiseGradient(noiseHash(seed, i + 1, j + 1), x2, y2);
+				return T(45) * n;
+			}
+
+			template<typename T>
+			T simplexNoise(T x, T y, T z, uint32_t seed)
+			{
+				const T F3 = T(1) / 3, G3 = T(1) / 6;
+				const T s = (x + y + z) * F3;
+				const int32_t i = noiseFloor(x + s), j = noiseFloor(y + s), k = noiseFloor(z + s);
+				const T t = T(i + j + k) * G3;
+				const T x0 = x - (T(i) - t), y0 = y - (T(j) - t), z0 = z - (T(k) - t);
+
+				// Rank the offsets to find the simplex the point is in,
+				// without branches. Ties go to the earlier axis.
+				const int32_t rx = int32_t(x0 > y0) + int32_t(x0 > z0);
+				const int32_t ry = int32_t(y0 >= x0) + int32_t(y0 > z0);
+				const int32_t rz = int32_t(z0 >= x0) + int32_t(z0 >= y0);
+				const int32_t i1 = rx >= 2, j1 = ry >= 2, k1 = rz >= 2;
+				const int32_t i2 = rx >= 1, j2 = ry >= 1, k2 = rz >= 1;
+
+				const T x1 = x0 - T(i1) + G3, y1 = y0 - T(j1) + G3, z1 = z0 - T(k1) + G3;
+				const T x2 = x0 - T(i2) + 2 * G3, y2 = y0 - T(j2) + 2 * G3, z2 = z0 - T(k2) + 2 * G3;
+				const T x3 = x0 - 1 + 3 * G3, y3 = y0 - 1 + 3 * G3, z3 = z0 - 1 + 3 * G3;
+
+				T t0 = T(0.6) - x0 * x0 - y0 * y0 - z0 * z0;
+				T t1 = T(0.6) - x1 * x1 - y1 * y1 - z1 * z1;
+				T t2 = T(0.6) - x2 * x2 - y2 * y2 - z2 * z2;
+				T t3 = T(0.6) - x3 * x3 - y3 * y3 - z3 * z3;
+				t0 = t0 > 0 ? t0 * t0 : T(0);
+				t1 = t1 > 0 ? t1 * t1 : T(0);
+				t2 = t2 > 0 ? t2 * t2 : T(0);
+				t3 = t3 > 0 ? t3 * t3 : T(0);
+
+				const T n = t0 * t0 * noiseGradient(noiseHash(seed, i, j, k), x0, y0, z0)
+					+ t1 * t1 * noiseGradient(noiseHash(seed, i + i1, j + j1, k + k1), x1, y1, z1)
+					+ t2 * t2 * noiseGradient(noiseHash(seed, i + i2, j + j2, k + k2), x2, y2, z2)
+					+ t3 * t3 * noiseGradient(noiseHash(seed, i + 1, j + 1, k + 1), x3, y3, z3);
+				return T(32) * n;
+			}
+
+			template<typename T>
+			T simplexNoise(T x, T y, T z, T w, uint32_t seed)
+			{
+				const T F4 = T(0.30901699437494742410), G4 = T(0.13819660112501051518);
+				const T s = (x + y + z + w) * F4;
+				const int32_t i = noiseFloor(x + s), j = noiseFloor(y + s), k = noiseFloor(z + s), l = noiseFloor(w + s);
+				const T t = T(i + j + k + l) * G4;
+				const T x0 = x - (T(i) - t), y0 = y - (T(j) - t), z0 = z - (T(k) - t), w0 = w - (T(l) - t);
+
+				const int32_t rx = int32_t(x0 > y0) + int32_t(x0 > z0) + int32_t(x0 > w0);
+				const int32_t ry = int32_t(y0 >= x0) + int32_t(y0 > z0) + int32_t(y0 > w0);
+				const int32_t rz = int32_t(z0 >= x0) + int32_t(z0 >= y0) + int32_t(z0 > w0);
+				const int32_t rw = int32_t(w0 >= x0) + int32_t(w0 >= y0) + int32_t(w0 >= z0);
+
+				T n = 0;
+				int32_t ci = 0, cj = 0, ck = 0, cl = 0;
+				for(int c = 0; c < 5; c++)
+				{
+					// Corner c steps along the c axes with the largest offsets.
+					if(c > 0)
+					{
+						ci = rx >= 4 - c;
+						cj = ry >= 4 - c;
+						ck = rz >= 4 - c;
+						cl = rw >= 4 - c;
+					}
+					const T g = T(c) * G4;
+					const T dx = x0 - T(ci) + g, dy = y0 - T(cj) + g, dz = z0 - T(ck) + g, dw = w0 - T(cl) + g;
+					T tc = T(0.6) - dx * dx - dy * dy - dz * dz - dw * dw;
+					tc = tc > 0 ? tc * tc : T(0);
+					n += tc * tc * noiseGradient(noiseHash(seed, i + ci, j + cj, k + ck, l + cl), dx, dy, dz, dw);
+				}
+				return T(27) * n;
+			}
+
+			// Feature point of a cell: a random position inside it.
+			template<typename T>
+			inline T noiseJitter(uint32_t h)
+			{
+				return T(h >> 8) * T(1.0 / 16777216.0);
+			}
+
+			template<typename T>
+			T worleyNoise(T x, T y, uint32_t seed)
+			{
+				const int32_t ix = noiseFloor(x), iy = noiseFloor(y);
+				const T fx = x - T(ix), fy = y - T(iy);
+				T best = T(8);
+				for(int32_t cy = -1; cy <= 1; cy++)
+					for(int32_t cx = -1; cx <= 1; cx++)
+					{
+						const uint32_t h = noiseHash(seed, ix + cx, iy + cy);
+						const T dx = T(cx) + noiseJitter<T>(h) - fx;
+						const T dy = T(cy) + noiseJitter<T>(noiseMix(h)) - fy;
+						const T d = dx * dx + dy * dy;
+						best = d < best ? d : best;
+					}
+				return std::sqrt(best);
+			}
+
+			template<typename T>
+			T worleyNoise(T x, T y, T z, uint32_t seed)
+			{
+				const int32_t ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z);
+				const T fx = x - T(ix), fy = y - T(iy), fz = z - T(iz);
+				T best = T(8);
+				for(int32_t cz = -1; cz <= 1; cz++)
+					for(int32_t cy = -1; cy <= 1; cy++)
+						for(int32_t cx = -1; cx <= 1; cx++)
+						{
+							const uint32_t h = noiseHash(seed, ix + cx, iy + cy, iz + cz);
+							const uint32_t h2 = noiseMix(h);
+							const T dx = T(cx) + noiseJitter<T>(h) - fx;
+							const T dy = T(cy) + noiseJitter<T>(h2) - fy;
+							const T dz = T(cz) + noiseJitter<T>(noiseMix(h2)) - fz;
+							const T d = dx * dx + dy * dy + dz * dz;
+							best = d < best ? d : best;
+						}
+				return std::sqrt(best);
+			}
+
+			template<typename T>
+			T worleyNoise(T x, T y, T z, T w, uint32_t seed)
+			{
+				const int32_t ix = noiseFloor(x), iy = noiseFloor(y), iz = noiseFloor(z), iw = noiseFloor(w);
+				const T fx = x - T(ix), fy = y - T(iy), fz = z - T(iz), fw = w - T(iw);
+				T best = T(8);
+				for(int32_t cw = -1; cw <= 1; cw++)
+					for(int32_t cz = -1; cz <= 1; cz++)
+						for(int32_t cy = -1; cy <= 1; cy++)
+							for(int32_t cx = -1; cx <= 1; cx++)
+							{
+								const uint32_t h = noiseHash(seed, ix + cx, iy + cy, iz + cz, iw + cw);
+								const uint32_t h2 = noiseMix(h);
+								const uint32_t h3 = noiseMix(h2);
+								const T dx = T(cx) + noiseJitter<T>(h) - fx;
+								const T dy = T(cy) + noiseJitter<T>(h2) - fy;
+								const T dz = T(cz) + noiseJitter<T>(h3) - fz;
+								const T dw = T(cw) + noiseJitter<T>(noiseMix(h3)) - fw;
+								const T d = dx * dx + dy * dy + dz * dz + dw * dw;
+								best = d < best ? d : best;
+							}
+				return std::sqrt(best);
+			}
+
+			// Sums the octaves of one kernel. The octave seeds are spread
+			// with the golden ratio so neighbouring seeds stay unrelated.
+			template<typename T, typename K>
+			inline T noiseOctaves(K kernel, const T (&p)[4], uint32_t seed, const fractal<T>& settings)
+			{
+				if(settings.octaves <= 1)
+					return kernel(p, seed);
+
+				T sum = 0, amplitude = 1, total = 0, frequency = 1;
+				for(int o = 0; o < settings.octaves; o++)
+				{
+					const T q[4] = { p[0] * frequency, p[1] * frequency, p[2] * frequency, p[3] * frequency };
+					sum += amplitude * kernel(q, seed + uint32_t(o) * 0x9E3779B9u);
+					total += amplitude;
+					amplitude *= settings.gain;
+					frequency *= settings.lacunarity;
+				}
+				return sum / total;
+			}
+
+			template<int D, typename T, typename F>
+			void noiseDispatch(NoiseType type, F body)
+			{
+				switch(type)
+				{
+					case PerlinNoise:
+						body([](const T (&p)[4], uint32_t s) {
+							return D == 2 ? perlinNoise(p[0], p[1], s) : D == 3 ? perlinNoise(p[0], p[1], p[2], s)
+								: perlinNoise(p[0], p[1], p[2], p[3], s);
+						});
+						break;
+					case SimplexNoise:
+						body([](const T (&p)[4], uint32_t s) {
+							return D == 2 ? simplexNoise(p[0], p[1], s) : D == 3 ? simplexNoise(p[0], p[1], p[2], s)
+								: simplexNoise(p[0], p[1], p[2], p[3], s);
+						});
+						break;
+					case WorleyNoise:
+						body([](const T (&p)[4], uint32_t s) {
+							return D == 2 ? worleyNoise(p[0], p[1], s) : D == 3 ? worleyNoise(p[0], p[1], p[2], s)
+								: worleyNoise(p[0], p[1], p[2], p[3], s);
+						});
+						break;
+				}
+			}
+		}
+
+		// Inline definitions
+		template<typename T>
+		inline fractal<T>::fractal(int octaves, T lacunarity, T gain)
+			: octaves(octaves), lacunarity(lacunarity), gain(gain)
+		{}
+
+		template<typename T>
+		inline noise<T>::noise(uint32_t seed)
+			: m_seed(seed)
+		{}
+
+		template<typename T>
+		inline uint32_t noise<T>::seed() const
+		{
+			return m_seed;
+		}
+
+		template<typename T>
+		inline T noise<T>::perlin(const vec2<T>& p) const
+		{
+			return Internal::perlinNoise(p.x, p.y, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::perlin(const vec3<T>& p) const
+		{
+			return Internal::perlinNoise(p.x, p.y, p.z, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::perlin(const vec4<T>& p) const
+		{
+			return Internal::perlinNoise(p.x, p.y, p.z, p.w, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::simplex(const vec2<T>& p) const
+		{
+			return Internal::simplexNoise(p.x, p.y, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::simplex(const vec3<T>& p) const
+		{
+			return Internal::simplexNoise(p.x, p.y, p.z, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::simplex(const vec4<T>& p) const
+		{
+			return Internal::simplexNoise(p.x, p.y, p.z, p.w, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::worley(const vec2<T>& p) const
+		{
+			return Internal::worleyNoise(p.x, p.y, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::worley(const vec3<T>& p) const
+		{
+			return Internal::worleyNoise(p.x, p.y, p.z, m_seed);
+		}
+
+		template<typename T>
+		inline T noise<T>::worley(const vec4<T>& p) const
+		{
+			return Internal::worleyNoise(p.x, p.y, p.z, p.w, m_seed);
+		}
+
+		// Template implementation
+		template<typename T>
+		T noise<T>::fbm(NoiseType type, const vec2<T>& p, const fractal<T>& settings) const
+		{
+			T result = 0;
+			const T q[4] = { p.x, p.y, T(0), T(0) };
+			Internal::noiseDispatch<2, T>(type, [&](auto kernel) {
+				result = Internal::noiseOctaves(kernel, q, m_seed, settings);
+			});
+			return result;
+		}
+
+		template<typename T>
+		T noise<T>::fbm(NoiseType type, const vec3<T>& p, const fractal<T>& settings) const
+		{
+			T result = 0;
+			const T q[4] = { p.x, p.y, p.z, T(0) };
+			Internal::noiseDispatch<3, T>(type, [&](auto kernel) {
+				result = Internal::noiseOctaves(kernel, q, m_seed, settings);
+			});
+			return result;
+		}
+
+		template<typename T>
+		T noise<T>::fbm(NoiseType type, const vec4<T>& p, const fractal<T>& settings) const
+		{
+			T result = 0;
+			const T q[4] = { p.x, p.y, p.z, p.w };
+			Internal::noiseDispatch<4, T>(type, [&](auto kernel) {
+				result = Internal::noiseOctaves(kernel, q, m_seed, settings);
+			});
+			return result;
+		}
+
+		template<typename T>
+		void noise<T>::fill(NoiseType type, const vec2SoA<const T>& points, T* values, const fractal<T>& settings) const
+		{
+			const uint32_t seed = m_seed;
+			Internal::noiseDispatch<2, T>(type, [&](auto kernel) {
+				parallelFor(points.size, Internal::NoiseGrain, [&](size_t begin, size_t end, size_t) {
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+					{
+						const T p[4] = { points.x[i], points.y[i], T(0), T(0) };
+						values[i] = Internal::noiseOctaves(kernel, p, seed, settings);
+					}
+				});
+			});
+		}
+
+		template<typename T>
+		void noise<T>::fill(NoiseType type, const vec3SoA<const T>& points, T* values, const fractal<T>& settings) const
+		{
+			const uint32_t seed = m_seed;
+			Internal::noiseDispatch<3, T>(type, [&](auto kernel) {
+				parallelFor(points.size, Internal::NoiseGrain, [&](size_t begin, size_t end, size_t) {
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+					{
+						const T p[4] = { points.x[i], points.y[i], points.z[i], T(0) };
+						values[i] = Internal::noiseOctaves(kernel, p, seed, settings);
+					}
+				});
+			});
+		}
+
+		template<typename T>
+		void noise<T>::fill(NoiseType type, const vec4SoA<const T>& points, T* values, const fractal<T>& settings) const
+		{
+			const uint32_t seed = m_seed;
+			Internal::noiseDispatch<4, T>(type, [&](auto kernel) {
+				parallelFor(points.size, Internal::NoiseGrain, [&](size_t begin, size_t end, size_t) {
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+					{
+						const T p[4] = { points.x[i], points.y[i], points.z[i], points.w[i] };
+						values[i] = Internal::noiseOctaves(kernel, p, seed, settings);
+					}
+				});
+			});
+		}
+
+		template<typename T>
+		void noise<T>::fillGrid(NoiseType type, const vec2<T>& origin, const vec2<T>& spacing, size_t width, size_t height,
+			T* values, const fractal<T>& settings) const
+		{
+			if(width == 0)
+				return;
+			const uint32_t seed = m_seed;
+			const T ox = origin.x, oy = origin.y, sx = spacing.x, sy = spacing.y;
+			Internal::noiseDispatch<2, T>(type, [&](auto kernel) {
+				parallelFor(height, Internal::NoiseGrain / width + 1, [&](size_t begin, size_t end, size_t) {
+					for(size_t row = begin; row < end; row++)
+					{
+						const T y = oy + sy * T(row);
+						T* out = values + row * width;
+						AFW_MATH_SIMD_LOOP
+						for(size_t col = 0; col < width; col++)
+						{
+							const T p[4] = { ox + sx * T(col), y, T(0), T(0) };
+							out[col] = Internal::noiseOctaves(kernel, p, seed, settings);
+						}
+					}
+				});
+			});
+		}
+
+		template<typename T>
+		void noise<T>::fillGrid(NoiseType type, const vec3<T>& origin, const vec3<T>& spacing, size_t width, size_t height,
+			size_t depth, T* values, const fractal<T>& settings) const
+		{
+			if(width == 0)
+				return;
+			const uint32_t seed = m_seed;
+			const T ox = origin.x, oy = origin.y, oz = origin.z, sx = spacing.x, sy = spacing.y, sz = spacing.z;
+			Internal::noiseDispatch<3, T>(type, [&](auto kernel) {
+				parallelFor(height * depth, Internal::NoiseGrain / width + 1, [&](size_t begin, size_t end, size_t) {
+					for(size_t row = begin; row < end; row++)
+					{
+						const T y = oy + sy * T(row % height);
+						const T z = oz + sz * T(row / height);
+						T* out = values + row * width;
+						AFW_MATH_SIMD_LOOP
+						for(size_t col = 0; col < width; col++)
+						{
+							const T p[4] = { ox + sx * T(col), y, z, T(0) };
+							out[col] = Internal::noiseOctaves(kernel, p, seed, settings);
+						}
+					}
+				});
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_NOISE_H
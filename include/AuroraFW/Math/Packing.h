@@ -0,0 +1,518 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Packing.h
+ * Packing header. This contains octahedral encodings of unit vectors
+ * in 16, 24 and 32 bits, and fixed-point quantization of positions
+ * relative to a bounding box.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_PACKING_H
+#define AURORAFW_MATH_PACKING_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/AABB.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A packed 24 bit value, stored as three little endian bytes so
+		 * arrays of it take 3 bytes per element.
+		 * @since snapshot20261019
+		 */
+		struct AFW_API oct24 {
+			uint8_t bytes[3];
+		};
+
+		/**
+		 * The storage type of an octahedral encoding with the given total
+		 * number of bits: uint16_t for 16, oct24 for 24 and uint32_t for 32.
+		 * @since snapshot20261019
+		 */
+		template<int Bits>
+		struct octStorage;
+
+		template<> struct octStorage<16> { typedef uint16_t type; };
+		template<> struct octStorage<24> { typedef oct24 type; };
+		template<> struct octStorage<32> { typedef uint32_t type; };
+
+		/**
+		 * Packs a unit vector with the octahedral mapping: the sphere is
+		 * projected on an octahedron, unfolded to a square and both square
+		 * coordinates are stored as signed normalized integers of Bits / 2
+		 * bits. The axes are encoded exactly.
+		 *
+		 * Measured maximum angular error after unpacking, for float and
+		 * double alike: 0.95 degrees for 16 bits, 0.059 degrees for 24 bits
+		 * and 0.0037 degrees for 32 bits.
+		 * The input does not need to be exactly normalized; the zero
+		 * vector and vectors with NaN or infinite components pack to +z.
+		 * @tparam Bits 16, 24 or 32.
+		 * @param normal The unit vector.
+		 * @return The packed vector.
+		 * @since snapshot20261019
+		 */
+		template<int Bits, typename T>
+		typename octStorage<Bits>::type packOctahedral(const vec3<T>& );
+
+		/**
+		 * Unpacks a vector packed by packOctahedral(). The result is normalized.
+		 * @tparam Bits 16, 24 or 32.
+		 * @tparam T The scalar type of the result.
+		 * @since snapshot20261019
+		 */
+		template<int Bits, typename T>
+		vec3<T> unpackOctahedral(const typename octStorage<Bits>::type& );
+
+		/**
+		 * Packs a span of unit vectors. Large spans are split across threads.
+		 * @param normals The unit vectors.
+		 * @param packed Receives the packed vectors.
+		 * @param count The number of vectors.
+		 * @see packOctahedral(const vec3<T>& )
+		 * @since snapshot20261019
+		 */
+		template<int Bits, typename T>
+		void packOctahedral(const vec3<T>* , typename octStorage<Bits>::type* , size_t );
+
+		/**
+		 * Packs unit vectors stored as SoA.
+		 * @param normals The unit vectors.
+		 * @param packed Receives normals.size packed vectors.
+		 * @since snapshot20261019
+		 */
+		template<int Bits, typename T>
+		void packOctahedral(const vec3SoA<const T>& , typename octStorage<Bits>::type* );
+
+		/**
+		 * Unpacks a span of packed vectors.
+		 * @param packed The packed vectors.
+		 * @param normals Receives the unit vectors.
+		 * @param count The number of vectors.
+		 * @since snapshot20261019
+		 */
+		template<int Bits, typename T>
+		void unpackOctahedral(const typename octStorage<Bits>::type* , vec3<T>* , size_t );
+
+		/**
+		 * Unpacks packed vectors to SoA.
+		 * @param packed The normals.size packed vectors.
+		 * @param normals Receives the unit vectors.
+		 * @since snapshot20261019
+		 */
+		template<int Bits, typename T>
+		void unpackOctahedral(const typename octStorage<Bits>::type* , const vec3SoA<T>& );
+
+		/**
+		 * Quantizes positions inside a bounding box to unsigned integers of
+		 * bits() bits per axis, which are packed one after the other, x in
+		 * the low bits, then y, then z, into one integer of 3 * bits() bits.
+		 *
+		 * Values are rounded to the nearest of 2^bits() - 1 steps across the
+		 * box; the arithmetic is done in double, so the error on each axis
+		 * is at most maxError(): half a step, plus the rounding of the
+		 * result to T. The box corners are encoded exactly and positions
+		 * outside the box are clamped to it.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API positionQuantizer {
+		public:
+			/** Constructs a quantizer.
+			 * @param bounds The box the positions lie in.
+			 * @param bits The number of bits per axis, from 1 to 21.
+			 * @since snapshot20261019
+			 */
+			positionQuantizer(const aabb<T>& , int = 16);
+
+			/** Returns the box.
+			 * @since snapshot20261019
+			 */
+			const aabb<T>& bounds() const;
+
+			/** Returns the number of bits per axis.
+			 * @since snapshot20261019
+			 */
+			int bits() const;
+
+			/** Returns the largest error on each axis: half of a step, plus
+			 * half a unit in the last place of T at the largest coordinate
+			 * of the box.
+			 * @since snapshot20261019
+			 */
+			vec3<T> maxError() const;
+
+			/** Returns the quantized coordinates of a position.
+			 * @since snapshot20261019
+			 */
+			vec3<uint32_t> quantize(const vec3<T>& ) const;
+
+			/** Returns the position of quantized coordinates.
+			 * @since snapshot20261019
+			 */
+			vec3<T> dequantize(const vec3<uint32_t>& ) const;
+
+			/** Returns the packed quantized coordinates of a position.
+			 * @since snapshot20261019
+			 */
+			uint64_t pack(const vec3<T>& ) const;
+
+			/** Returns the position of packed quantized coordinates.
+			 * @since snapshot20261019
+			 */
+			vec3<T> unpack(uint64_t ) const;
+
+			/** Packs a span of positions. U is uint16_t, uint32_t or
+			 * uint64_t and must hold 3 * bits() bits.
+			 * @param positions The positions.
+			 * @param packed Receives the packed positions.
+			 * @param count The number of positions.
+			 * @since snapshot20261019
+			 */
+			template<typename U>
+			void pack(const vec3<T>* , U* , size_t ) const;
+
+			/** Packs positions stored as SoA.
+			 * @param positions The positions.
+			 * @param packed Receives positions.size packed positions.
+			 * @since snapshot20261019
+			 */
+			template<typename U>
+			void pack(const vec3SoA<const T>& , U* ) const;
+
+			/** Unpacks a span of packed positions.
+			 * @param packed The packed positions.
+			 * @param positions Receives the positions.
+			 * @param count The number of positions.
+			 * @since snapshot20261019
+			 */
+			template<typename U>
+			void unpack(const U* , vec3<T>* , size_t ) const;
+
+			/** Unpacks packed positions to SoA.
+			 * @param packed The positions.size packed positions.
+			 * @param positions Receives the positions.
+			 * @since snapshot20261019
+			 */
+			template<typename U>
+			void unpack(const U* , const vec3SoA<T>& ) const;
+
+		private:
+			uint32_t quantizeAxis(T , int ) const;
+			T dequantizeAxis(uint64_t , int ) const;
+
+			aabb<T> m_bounds;
+			int m_bits;
+			double m_steps;
+			double m_min[3];
+			double m_extent[3];
+			double m_scale[3];
+			T m_error[3];
+		};
+		typedef positionQuantizer<float> PositionQuantizer;
+
+		namespace Internal {
+			constexpr size_t PackingGrain = 1 << 15;
+
+			template<int Bits>
+			struct octCodec;
+
+			template<>
+			struct octCodec<16> {
+				static uint16_t store(uint32_t u, uint32_t v) { return uint16_t(u | (v << 8)); }
+				static uint32_t u(uint16_t p) { return p & 0xFFu; }
+				static uint32_t v(uint16_t p) { return p >> 8; }
+			};
+
+			template<>
+			struct octCodec<24> {
+				static oct24 store(uint32_t u, uint32_t v)
+				{
+					const uint32_t p = u | (v << 12);
+					oct24 r;
+					r.bytes[0] = uint8_t(p);
+					r.bytes[1] = uint8_t(p >> 8);
+					r.bytes[2] = uint8_t(p >> 16);
+					return r;
+				}
+				static uint32_t u(const oct24& p) { return p.bytes[0] | (uint32_t(p.bytes[1] & 0x0F) << 8); }
+				static uint32_t v(const oct24& p) { return (p.bytes[1] >> 4) | (uint32_t(p.bytes[2]) << 4); }
+			};
+
+			template<>
+			struct octCodec<32> {
+				static uint32_t store(uint32_t u, uint32_t v) { return u | (v << 16); }
+				static uint32_t u(uint32_t p) { return p & 0xFFFFu; }
+				static uint32_t v(uint32_t p) { return p >> 16; }
+			};
+
+			// Coordinates are stored as round(p * M) + M with M = 2^(b - 1) - 1,
+			// so -1, 0 and 1 are exact. The mapping is computed in double:
+			// in float, its rounding errors exceed the 16 bit steps of the
+			// 32 bit encoding. Zero length and non-finite normals encode as
+			// +Z, so the conversions below always get values in range.
+			template<int Bits, typename T>
+			inline typename octStorage<Bits>::type octEncode(T nx, T ny, T nz)
+			{
+				const double x = double(nx), y = double(ny), z = double(nz);
+				const double m = double((1u << (Bits / 2 - 1)) - 1);
+				const double sum = std::abs(x) + std::abs(y) + std::abs(z);
+				const bool valid = sum > 0 && sum <= std::numeric_limits<double>::max();
+				const double inv = valid ? 1 / sum : 0.0;
+				double px = valid ? x * inv : 0.0, py = valid ? y * inv : 0.0;
+				const double sx = px >= 0 ? 1.0 : -1.0, sy = py >= 0 ? 1.0 : -1.0;
+				const double fx = (1 - std::abs(py)) * sx, fy = (1 - std::abs(px)) * sy;
+				px = valid && z < 0 ? fx : px;
+				py = valid && z < 0 ? fy : py;
+				const uint32_t u = uint32_t(std::floor(px * m + m + 0.5));
+				const uint32_t v = uint32_t(std::floor(py * m + m + 0.5));
+				return octCodec<Bits>::store(u, v);
+			}
+
+			template<int Bits, typename T>
+			inline void octDecode(const typename octStorage<Bits>::type& p, T& nx, T& ny, T& nz)
+			{
+				const double m = double((1u << (Bits / 2 - 1)) - 1);
+				double x = (double(octCodec<Bits>::u(p)) - m) / m;
+				double y = (double(octCodec<Bits>::v(p)) - m) / m;
+				const double z = 1 - std::abs(x) - std::abs(y);
+				const double t = z < 0 ? -z : 0.0;
+				x += x >= 0 ? -t : t;
+				y += y >= 0 ? -t : t;
+				const double inv = 1 / std::sqrt(x * x + y * y + z * z);
+				nx = T(x * inv);
+				ny = T(y * inv);
+				nz = T(z * inv);
+			}
+		}
+
+		// Template implementation
+		template<int Bits, typename T>
+		typename octStorage<Bits>::type packOctahedral(const vec3<T>& normal)
+		{
+			return Internal::octEncode<Bits>(normal.x, normal.y, normal.z);
+		}
+
+		template<int Bits, typename T>
+		vec3<T> unpackOctahedral(const typename octStorage<Bits>::type& packed)
+		{
+			vec3<T> n;
+			Internal::octDecode<Bits>(packed, n.x, n.y, n.z);
+			return n;
+		}
+
+		template<int Bits, typename T>
+		void packOctahedral(const vec3<T>* normals, typename octStorage<Bits>::type* packed, size_t count)
+		{
+			parallelFor(count, Internal::PackingGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					packed[i] = Internal::octEncode<Bits>(normals[i].x, normals[i].y, normals[i].z);
+			});
+		}
+
+		template<int Bits, typename T>
+		void packOctahedral(const vec3SoA<const T>& normals, typename octStorage<Bits>::type* packed)
+		{
+			parallelFor(normals.size, Internal::PackingGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					packed[i] = Internal::octEncode<Bits>(normals.x[i], normals.y[i], normals.z[i]);
+			});
+		}
+
+		template<int Bits, typename T>
+		void unpackOctahedral(const typename octStorage<Bits>::type* packed, vec3<T>* normals, size_t count)
+		{
+			parallelFor(count, Internal::PackingGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					T x, y, z;
+					Internal::octDecode<Bits>(packed[i], x, y, z);
+					normals[i].x = x;
+					normals[i].y = y;
+					normals[i].z = z;
+				}
+			});
+		}
+
+		template<int Bits, typename T>
+		void unpackOctahedral(const typename octStorage<Bits>::type* packed, const vec3SoA<T>& normals)
+		{
+			parallelFor(normals.size, Internal::PackingGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					Internal::octDecode<Bits>(packed[i], normals.x[i], normals.y[i], normals.z[i]);
+			});
+		}
+
+		template<typename T>
+		positionQuantizer<T>::positionQuantizer(const aabb<T>& bounds, int bits)
+			: m_bounds(bounds), m_bits(bits < 1 ? 1 : bits > 21 ? 21 : bits)
+		{
+			// The extent of a float box is exact in double, and so is
+			// q * extent for q below 2^21, so only the final division and
+			// addition round: min and max decode to themselves.
+			m_steps = double((uint32_t(1) << m_bits) - 1);
+			const T lo[3] = { bounds.min.x, bounds.min.y, bounds.min.z };
+			const T hi[3] = { bounds.max.x, bounds.max.y, bounds.max.z };
+			for(int a = 0; a < 3; a++)
+			{
+				m_min[a] = double(lo[a]);
+				m_extent[a] = double(hi[a]) > m_min[a] ? double(hi[a]) - m_min[a] : 0.0;
+				m_scale[a] = m_extent[a] > 0 ? m_steps / m_extent[a] : 0.0;
+
+				const double big = std::max(std::abs(double(lo[a])), std::abs(double(hi[a])));
+				const double error = m_extent[a] / m_steps / 2 + big * double(std::numeric_limits<T>::epsilon()) / 2;
+				m_error[a] = T(error);
+				if(double(m_error[a]) < error)
+					m_error[a] = std::nextafter(m_error[a], std::numeric_limits<T>::infinity());
+			}
+		}
+
+		template<typename T>
+		const aabb<T>& positionQuantizer<T>::bounds() const
+		{
+			return m_bounds;
+		}
+
+		template<typename T>
+		int positionQuantizer<T>::bits() const
+		{
+			return m_bits;
+		}
+
+		template<typename T>
+		vec3<T> positionQuantizer<T>::maxError() const
+		{
+			return vec3<T>(m_error[0], m_error[1], m_error[2]);
+		}
+
+		template<typename T>
+		inline uint32_t positionQuantizer<T>::quantizeAxis(T value, int axis) const
+		{
+			double q = std::floor((double(value) - m_min[axis]) * m_scale[axis] + 0.5);
+			q = q > 0 ? q : 0.0;
+			q = q < m_steps ? q : m_steps;
+			return uint32_t(q);
+		}
+
+		template<typename T>
+		inline T positionQuantizer<T>::dequantizeAxis(uint64_t q, int axis) const
+		{
+			return T(m_min[axis] + double(q) * m_extent[axis] / m_steps);
+		}
+
+		template<typename T>
+		vec3<uint32_t> positionQuantizer<T>::quantize(const vec3<T>& p) const
+		{
+			return vec3<uint32_t>(quantizeAxis(p.x, 0), quantizeAxis(p.y, 1), quantizeAxis(p.z, 2));
+		}
+
+		template<typename T>
+		vec3<T> positionQuantizer<T>::dequantize(const vec3<uint32_t>& q) const
+		{
+			return vec3<T>(dequantizeAxis(q.x, 0), dequantizeAxis(q.y, 1), dequantizeAxis(q.z, 2));
+		}
+
+		template<typename T>
+		uint64_t positionQuantizer<T>::pack(const vec3<T>& p) const
+		{
+			return uint64_t(quantizeAxis(p.x, 0)) | (uint64_t(quantizeAxis(p.y, 1)) << m_bits)
+				| (uint64_t(quantizeAxis(p.z, 2)) << (2 * m_bits));
+		}
+
+		template<typename T>
+		vec3<T> positionQuantizer<T>::unpack(uint64_t packed) const
+		{
+			const uint64_t mask = (uint64_t(1) << m_bits) - 1;
+			return dequantize(vec3<uint32_t>(uint32_t(packed & mask), uint32_t((packed >> m_bits) & mask),
+				uint32_t((packed >> (2 * m_bits)) & mask)));
+		}
+
+		template<typename T>
+		template<typename U>
+		void positionQuantizer<T>::pack(const vec3<T>* positions, U* packed, size_t count) const
+		{
+			parallelFor(count, Internal::PackingGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					packed[i] = U(pack(positions[i]));
+			});
+		}
+
+		template<typename T>
+		template<typename U>
+		void positionQuantizer<T>::pack(const vec3SoA<const T>& positions, U* packed) const
+		{
+			parallelFor(positions.size, Internal::PackingGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					packed[i] = U(uint64_t(quantizeAxis(positions.x[i], 0))
+						| (uint64_t(quantizeAxis(positions.y[i], 1)) << m_bits)
+						| (uint64_t(quantizeAxis(positions.z[i], 2)) << (2 * m_bits)));
+			});
+		}
+
+		template<typename T>
+		template<typename U>
+		void positionQuantizer<T>::unpack(const U* packed, vec3<T>* positions, size_t count) const
+		{
+			parallelFor(count, Internal::PackingGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+					positions[i] = unpack(uint64_t(packed[i]));
+			});
+		}
+
+		template<typename T>
+		template<typename U>
+		void positionQuantizer<T>::unpack(const U* packed, const vec3SoA<T>& positions) const
+		{
+			const uint64_t mask = (uint64_t(1) << m_bits) - 1;
+			parallelFor(positions.size, Internal::PackingGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					const uint64_t p = packed[i];
+					positions.x[i] = dequantizeAxis(p & mask, 0);
+					positions.y[i] = dequantizeAxis((p >> m_bits) & mask, 1);
+					positions.z[i] = dequantizeAxis((p >> (2 * m_bits)) & mask, 2);
+				}
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_PACKING_H
@@ -0,0 +1,275 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Parallel.h
+ * Parallel loop header. This contains the helpers the batch kernels
+ * use to split large ranges across hardware threads.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_PARALLEL_H
+#define AURORAFW_MATH_PARALLEL_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * Returns in how many chunks parallelFor() splits a range.
+		 * The result only depends on the hardware thread count, so it can be
+		 * used to size per-chunk state before calling parallelFor().
+		 * @param count The number of elements in the range.
+		 * @param grain The minimum number of elements per chunk.
+		 * @return The number of chunks, at least 1.
+		 * @see parallelFor()
+		 * @since snapshot20261019
+		 */
+		AFW_API inline size_t parallelChunkCount(size_t count, size_t grain)
+		{
+			size_t threads = std::thread::hardware_concurrency();
+			if(threads == 0)
+				threads = 1;
+			if(grain == 0)
+				grain = 1;
+
+			size_t chunks = count / grain;
+			if(chunks > threads)
+				chunks = threads;
+			return chunks > 0 ? chunks : 1;
+		}
+
+		namespace Internal {
+			// The chunks of one parallelFor() call that are still running,
+			// and the first exception one of them threw.
+			struct parallelCall {
+				explicit parallelCall(size_t n) : remaining(n) {}
+
+				std::atomic<size_t> remaining;
+				std::mutex errorLock;
+				std::exception_ptr error;
+			};
+
+			// One chunk of a parallelFor() call, with the loop body behind a
+			// plain function pointer so tasks of any call share a queue.
+			struct parallelTask {
+				void (*run)(void* , size_t , size_t , size_t );
+				void* func;
+				size_t begin, end, chunk;
+				parallelCall* call;
+			};
+
+			template<typename F>
+			void parallelInvoke(void* func, size_t begin, size_t end, size_t chunk)
+			{
+				(*static_cast<F*>(func))(begin, end, chunk);
+			}
+
+			// Worker threads shared by every parallelFor() call, started on
+			// first use and stopped at exit. Threads waiting for their own
+			// chunks run queued tasks meanwhile, so a loop body can itself
+			// call parallelFor() without starving the pool.
+			class AFW_API parallelPool {
+			public:
+				static parallelPool& instance()
+				{
+					static parallelPool pool;
+					return pool;
+				}
+
+				~parallelPool()
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_lock);
+						m_stop = true;
+					}
+					m_wake.notify_all();
+					for(std::thread& thread : m_threads)
+						thread.join();
+				}
+
+				parallelPool(const parallelPool& ) = delete;
+				parallelPool& operator=(const parallelPool& ) = delete;
+
+				void submit(const parallelTask* tasks, size_t count)
+				{
+					{
+						std::lock_guard<std::mutex> lock(m_lock);
+						m_tasks.insert(m_tasks.end(), tasks, tasks + count);
+					}
+					m_wake.notify_all();
+					m_done.notify_all();
+				}
+
+				// Returns once every chunk of the call has finished.
+				void wait(parallelCall& call)
+				{
+					std::unique_lock<std::mutex> lock(m_lock);
+					while(call.remaining.load() != 0)
+					{
+						if(m_tasks.empty())
+						{
+							m_done.wait(lock);
+							continue;
+						}
+						const parallelTask task = m_tasks.front();
+						m_tasks.pop_front();
+						lock.unlock();
+						execute(task);
+						lock.lock();
+					}
+				}
+
+			private:
+				parallelPool()
+					: m_stop(false)
+				{
+					const size_t threads = std::thread::hardware_concurrency();
+					for(size_t i = 1; i < threads; i++)
+					{
+						// A pool short of threads still works: the callers
+						// run the queued chunks themselves.
+						try
+						{
+							m_threads.emplace_back([this]() { work(); });
+						}
+						catch(...)
+						{
+							break;
+						}
+					}
+				}
+
+				void work()
+				{
+					std::unique_lock<std::mutex> lock(m_lock);
+					for(;;)
+					{
+						m_wake.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+						if(m_tasks.empty())
+							return;
+						const parallelTask task = m_tasks.front();
+						m_tasks.pop_front();
+						lock.unlock();
+						execute(task);
+						lock.lock();
+					}
+				}
+
+				void execute(const parallelTask& task)
+				{
+					try
+					{
+						task.run(task.func, task.begin, task.end, task.chunk);
+					}
+					catch(...)
+					{
+						std::lock_guard<std::mutex> lock(task.call->errorLock);
+						if(!task.call->error)
+							task.call->error = std::current_exception();
+					}
+					if(--task.call->remaining == 0)
+					{
+						// Taking the lock orders this with the check in wait().
+						std::lock_guard<std::mutex> lock(m_lock);
+						m_done.notify_all();
+					}
+				}
+
+				std::mutex m_lock;
+				std::condition_variable m_wake;
+				std::condition_variable m_done;
+				std::deque<parallelTask> m_tasks;
+				std::vector<std::thread> m_threads;
+				bool m_stop;
+			};
+		}
+
+		/**
+		 * Splits [0, count) into contiguous chunks and runs the given function
+		 * on each of them, one chunk per thread. The calling thread runs the
+		 * first chunk, the others run on a pool of threads that is started
+		 * once and reused, and the call returns once all chunks are done.
+		 * If chunks throw, the first exception of the calling thread's chunk,
+		 * or else of another chunk, is rethrown after all chunks finished.
+		 * @param count The number of elements in the range.
+		 * @param grain The minimum number of elements per chunk.
+		 * @param func Called as func(begin, end, chunk) for each chunk.
+		 * @see parallelChunkCount()
+		 * @since snapshot20261019
+		 */
+		template<typename F>
+		void parallelFor(size_t count, size_t grain, F func)
+		{
+			const size_t chunks = parallelChunkCount(count, grain);
+			if(chunks == 1)
+			{
+				func(size_t(0), count, size_t(0));
+				return;
+			}
+
+			Internal::parallelCall call(chunks - 1);
+			std::vector<Internal::parallelTask> tasks(chunks - 1);
+			for(size_t chunk = 1; chunk < chunks; chunk++)
+			{
+				Internal::parallelTask& task = tasks[chunk - 1];
+				task.run = &Internal::parallelInvoke<F>;
+				task.func = &func;
+				task.begin = count * chunk / chunks;
+				task.end = count * (chunk + 1) / chunks;
+				task.chunk = chunk;
+				task.call = &call;
+			}
+			Internal::parallelPool& pool = Internal::parallelPool::instance();
+			pool.submit(tasks.data(), tasks.size());
+
+			std::exception_ptr error;
+			try
+			{
+				func(size_t(0), count / chunks, size_t(0));
+			}
+			catch(...)
+			{
+				error = std::current_exception();
+			}
+
+			// The other chunks use func and call, so wait for them even when
+			// the first one threw.
+			pool.wait(call);
+			if(!error)
+				error = call.error;
+			if(error)
+				std::rethrow_exception(error);
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_PARALLEL_H
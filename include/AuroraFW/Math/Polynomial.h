@@ -0,0 +1,623 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Polynomial.h
+ * Polynomial header. This contains polynomials and rational functions
+ * of fixed degree, with Horner and Estrin evaluation, span kernels,
+ * derivatives and closed form real roots up to degree 4.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_POLYNOMIAL_H
+#define AURORAFW_MATH_POLYNOMIAL_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector.h>
+#include <AuroraFW/Math/Interval.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A polynomial of degree D, stored in power basis as
+		 * c[0] + c[1]*x + ... + c[D]*x^D. It is an aggregate, so
+		 * coefficients known at compile time can make a constexpr
+		 * polynomial: <code>constexpr polynomial<float, 2> p = {{ 1, 2, 3 }};</code>
+		 *
+		 * evaluate() uses Horner's scheme, the fewest operations but one
+		 * long dependency chain; evaluateEstrin() pairs terms up in a tree
+		 * of depth log2(D), so a single evaluation gets instruction level
+		 * parallelism. The span kernels run Horner's scheme on many
+		 * arguments at once, which the compiler vectorizes.
+		 * @tparam T The scalar type.
+		 * @tparam D The degree.
+		 * @since snapshot20261019
+		 */
+		template<typename T, int D>
+		struct AFW_API polynomial {
+			static_assert(D >= 0, "the degree cannot be negative");
+
+			/** The power basis coefficients, lowest degree first. */
+			T c[D + 1];
+
+			/** Returns the value at x, with Horner's scheme.
+			 * @since snapshot20261019
+			 */
+			T evaluate(T ) const;
+
+			/** Returns the value at x, with Estrin's scheme.
+			 * @since snapshot20261019
+			 */
+			T evaluateEstrin(T ) const;
+
+			/** Returns the first derivative at x.
+			 * @since snapshot20261019
+			 */
+			T derivative(T ) const;
+
+			/** Returns the value at x, and its first derivative, in one pass.
+			 * @since snapshot20261019
+			 */
+			T evaluate(T , T& ) const;
+
+			/** Evaluates the polynomial at many arguments, in parallel.
+			 * @param x The arguments.
+			 * @param count The number of arguments.
+			 * @param values Receives one value per argument. May be x.
+			 * @param derivatives Receives one first derivative per argument.
+			 * May be <code>nullptr</code>.
+			 * @since snapshot20261019
+			 */
+			void evaluate(const T* , size_t , T* , T* = nullptr) const;
+
+			/** Returns the derivative polynomial. A constant gives zero.
+			 * @since snapshot20261019
+			 */
+			polynomial<T, (D > 0 ? D - 1 : 0)> differentiate() const;
+
+			/** Finds the real roots in closed form, for degrees up to 4. The
+			 * roots are polished with Newton steps, sorted, and a multiple
+			 * root is reported once; two roots are only merged if the
+			 * rounding of the coefficients can account for their
+			 * separation. Leading zero coefficients lower the
+			 * degree; the zero polynomial has no reported roots.
+			 * @param roots Receives up to D roots.
+			 * @return The number of roots.
+			 * @since snapshot20261019
+			 */
+			int roots(T* ) const;
+		};
+
+		/**
+		 * A rational function p(x) / q(x), for approximations that a
+		 * polynomial alone fits poorly.
+		 * @tparam T The scalar type.
+		 * @tparam P The degree of the numerator.
+		 * @tparam Q The degree of the denominator.
+		 * @since snapshot20261019
+		 */
+		template<typename T, int P, int Q>
+		struct AFW_API rational {
+			/** The numerator. */
+			polynomial<T, P> p;
+			/** The denominator. */
+			polynomial<T, Q> q;
+
+			/** Returns the value at x.
+			 * @since snapshot20261019
+			 */
+			T evaluate(T ) const;
+
+			/** Returns the first derivative at x.
+			 * @since snapshot20261019
+			 */
+			T derivative(T ) const;
+
+			/** Evaluates the function at many arguments, in parallel.
+			 * @param x The arguments.
+			 * @param count The number of arguments.
+			 * @param values Receives one value per argument. May be x.
+			 * @since snapshot20261019
+			 */
+			void evaluate(const T* , size_t , T* ) const;
+		};
+
+		namespace Internal {
+			constexpr size_t PolynomialGrain = 1 << 14;
+
+			// Horner's scheme, unrolled at compile time: r * x + c[I - 1],
+			// down to c[0].
+			template<typename T, int I>
+			struct hornerStep {
+				template<typename X>
+				static X apply(const T* c, const X& x, const X& r)
+				{
+					return hornerStep<T, I - 1>::apply(c, x, r * x + X(c[I - 1]));
+				}
+			};
+
+			template<typename T>
+			struct hornerStep<T, 0> {
+				template<typename X>
+				static X apply(const T* , const X& , const X& r) { return r; }
+			};
+
+			template<typename T, int D>
+			inline T horner(const T* c, T x)
+			{
+				return hornerStep<T, D>::apply(c, x, c[D]);
+			}
+
+			// The widest SIMD register the vec kernels have for the scalar
+			// type, or void.
+			template<typename T>
+			struct polynomialRegister {
+				typedef void type;
+			};
+
+			template<>
+			struct polynomialRegister<float> {
+#if defined(__AVX512F__)
+				typedef vecRegister16f type;
+#elif defined(__AVX__)
+				typedef vecRegister8f type;
+#elif defined(__SSE__)
+				typedef vecRegister4f type;
+#else
+				typedef void type;
+#endif
+			};
+
+			template<>
+			struct polynomialRegister<double> {
+#if defined(__AVX__)
+				typedef vecRegister4d type;
+#elif defined(__SSE2__)
+				typedef vecRegister2d type;
+#else
+				typedef void type;
+#endif
+			};
+
+			// Horner's scheme on four registers of arguments at a time, so
+			// four dependency chains hide each other's latency. Returns where
+			// it stopped.
+			template<typename T, int D, typename R>
+			struct polynomialSimd {
+				static size_t apply(const T* c, const T* x, T* values, size_t begin, size_t end)
+				{
+					typedef typename R::type V;
+					const size_t width = R::Width;
+					V k[D + 1];
+					for(int j = 0; j <= D; j++)
+						k[j] = R::broadcast(c[j]);
+
+					size_t i = begin;
+					for(; i + 4 * width <= end; i += 4 * width)
+					{
+						const V x0 = R::load(x + i), x1 = R::load(x + i + width);
+						const V x2 = R::load(x + i + 2 * width), x3 = R::load(x + i + 3 * width);
+						V r0 = k[D], r1 = k[D], r2 = k[D], r3 = k[D];
+						for(int j = D - 1; j >= 0; j--)
+						{
+							r0 = R::add(R::multiply(r0, x0), k[j]);
+							r1 = R::add(R::multiply(r1, x1), k[j]);
+							r2 = R::add(R::multiply(r2, x2), k[j]);
+							r3 = R::add(R::multiply(r3, x3), k[j]);
+						}
+						R::store(values + i, r0);
+						R::store(values + i + width, r1);
+						R::store(values + i + 2 * width, r2);
+						R::store(values + i + 3 * width, r3);
+					}
+					for(; i + width <= end; i += width)
+					{
+						const V v = R::load(x + i);
+						V r = k[D];
+						for(int j = D - 1; j >= 0; j--)
+							r = R::add(R::multiply(r, v), k[j]);
+						R::store(values + i, r);
+					}
+					return i;
+				}
+			};
+
+			template<typename T, int D>
+			struct polynomialSimd<T, D, void> {
+				static size_t apply(const T* , const T* , T* , size_t begin, size_t ) { return begin; }
+			};
+
+			// Evaluates c over x[begin, end).
+			template<typename T, int D>
+			inline void polynomialSpan(const T* c, const T* x, T* values, size_t begin, size_t end)
+			{
+				size_t i = polynomialSimd<T, D, typename polynomialRegister<T>::type>::apply(c, x, values, begin, end);
+				for(; i < end; i++)
+					values[i] = horner<T, D>(c, x[i]);
+			}
+
+			// The largest power of two below n (1 for n <= 2), and its log.
+			constexpr int estrinSplit(int n)
+			{
+				int h = 1;
+				while(2 * h < n)
+					h *= 2;
+				return h;
+			}
+
+			constexpr int estrinLog(int h)
+			{
+				int k = 0;
+				while((1 << k) < h)
+					k++;
+				return k;
+			}
+
+			// Estrin's scheme over c[First .. First + Count), unrolled at
+			// compile time: the low half plus x^Half times the high half,
+			// where powers[k] is x^(2^k).
+			template<typename T, int First, int Count>
+			struct estrin {
+				enum { Half = estrinSplit(Count) };
+
+				static T apply(const T* c, const T* powers)
+				{
+					return estrin<T, First, Half>::apply(c, powers)
+						+ powers[estrinLog(Half)] * estrin<T, First + Half, Count - Half>::apply(c, powers);
+				}
+			};
+
+			template<typename T, int First>
+			struct estrin<T, First, 1> {
+				static T apply(const T* c, const T* ) { return c[First]; }
+			};
+
+			// The roots of c[0] + c[1] x + ... + c[n] x^n for n <= 4, in any
+			// order, unpolished. c[n] is not zero.
+			template<typename T>
+			inline int polynomialRoots(const T* c, int n, T* roots);
+
+			// Compensated Horner (Graillat, Langlois and Louvet): the value
+			// of c[0] + ... + c[n] x^n as if computed in twice the precision
+			// of T.
+			template<typename T>
+			inline T compensatedHorner(const T* c, int n, T x)
+			{
+				T r = c[n], error = 0;
+				for(int j = n - 1; j >= 0; j--)
+				{
+					T p, pe, se;
+					twoProduct(r, x, p, pe);
+					twoSum(p, c[j], r, se);
+					error = error * x + (pe + se);
+				}
+				return r + error;
+			}
+
+			template<typename T>
+			inline int quadraticRoots(T a, T b, T c, T* roots)
+			{
+				// The stable form: no cancellation between -b and the root.
+				const T disc = b * b - 4 * a * c;
+				if(disc < 0)
+					return 0;
+				if(disc == 0)
+				{
+					roots[0] = -b / (2 * a);
+					return 1;
+				}
+				using std::sqrt;
+				const T q = -(b + std::copysign(sqrt(disc), b)) / 2;
+				roots[0] = q / a;
+				roots[1] = q != 0 ? c / q : T(0);
+				return 2;
+			}
+
+			// x^3 + a x^2 + b x + c, by Viete's trigonometric form when
+			// there are three real roots and Cardano's otherwise.
+			template<typename T>
+			inline int cubicRoots(T a, T b, T c, T* roots)
+			{
+				using std::sqrt;
+				const T q = (a * a - 3 * b) / 9;
+				const T r = (2 * a * a * a - 9 * a * b + 27 * c) / 54;
+				const T shift = a / 3;
+				if(r * r < q * q * q)
+				{
+					const T pi = T(3.14159265358979323846);
+					const T theta = std::acos(std::max(T(-1), std::min(T(1), r / sqrt(q * q * q))));
+					const T m = -2 * sqrt(q);
+					roots[0] = m * std::cos(theta / 3) - shift;
+					roots[1] = m * std::cos((theta + 2 * pi) / 3) - shift;
+					roots[2] = m * std::cos((theta - 2 * pi) / 3) - shift;
+					return 3;
+				}
+				const T u = -std::copysign(std::cbrt(std::fabs(r) + sqrt(r * r - q * q * q)), r);
+				const T v = u != 0 ? q / u : T(0);
+				roots[0] = u + v - shift;
+				if(u == v && u != 0)
+				{
+					roots[1] = -u - shift;
+					return 2;
+				}
+				return 1;
+			}
+
+			// x^4 + a x^3 + b x^2 + c x + d, by Ferrari's method: the
+			// depressed quartic splits into two quadratics through a root of
+			// its resolvent cubic.
+			template<typename T>
+			inline int quarticRoots(T a, T b, T c, T d, T* roots)
+			{
+				using std::sqrt;
+				const T a2 = a * a;
+				const T p = b - T(3) / 8 * a2;
+				const T q = c - a * b / 2 + a2 * a / 8;
+				const T r = d - a * c / 4 + a2 * b / 16 - T(3) / 256 * a2 * a2;
+				const T shift = a / 4;
+
+				int count = 0;
+				T y[4];
+				const T scale = std::max(std::max(std::fabs(p), std::fabs(r)), T(1));
+				if(std::fabs(q) <= std::numeric_limits<T>::epsilon() * scale)
+				{
+					// Biquadratic: y^4 + p y^2 + r.
+					T z[2];
+					const int n = quadraticRoots(T(1), p, r, z);
+					for(int i = 0; i < n; i++)
+						if(z[i] >= 0)
+						{
+							y[count++] = sqrt(z[i]);
+							y[count++] = -sqrt(z[i]);
+						}
+				}
+				else
+				{
+					// m^3 + p m^2 + (p^2/4 - r) m - q^2/8 has a positive root.
+					T m[3];
+					const int n = cubicRoots(p, p * p / 4 - r, -q * q / 8, m);
+					T best = m[0];
+					for(int i = 1; i < n; i++)
+						best = std::max(best, m[i]);
+					if(best <= 0)
+						return 0;
+					const T s = sqrt(2 * best);
+					count += quadraticRoots(T(1), s, p / 2 + best - q / (2 * s), y);
+					count += quadraticRoots(T(1), -s, p / 2 + best + q / (2 * s), y + count);
+				}
+				for(int i = 0; i < count; i++)
+					roots[i] = y[i] - shift;
+				return count;
+			}
+
+			template<typename T>
+			inline int polynomialRoots(const T* c, int n, T* roots)
+			{
+				switch(n)
+				{
+					case 1:
+						roots[0] = -c[0] / c[1];
+						return 1;
+					case 2:
+						return quadraticRoots(c[2], c[1], c[0], roots);
+					case 3:
+						return cubicRoots(c[2] / c[3], c[1] / c[3], c[0] / c[3], roots);
+					case 4:
+						return quarticRoots(c[3] / c[4], c[2] / c[4], c[1] / c[4], c[0] / c[4], roots);
+					default:
+						return 0;
+				}
+			}
+		}
+
+		// Inline definitions
+		template<typename T, int D>
+		inline T polynomial<T, D>::evaluate(T x) const
+		{
+			return Internal::horner<T, D>(c, x);
+		}
+
+		template<typename T, int D>
+		inline T polynomial<T, D>::evaluateEstrin(T x) const
+		{
+			T powers[Internal::estrinLog(Internal::estrinSplit(D + 1)) + 1];
+			powers[0] = x;
+			for(int k = 1; k < int(sizeof(powers) / sizeof(T)); k++)
+				powers[k] = powers[k - 1] * powers[k - 1];
+			return Internal::estrin<T, 0, D + 1>::apply(c, powers);
+		}
+
+		template<typename T, int D>
+		inline T polynomial<T, D>::derivative(T x) const
+		{
+			T d;
+			evaluate(x, d);
+			return d;
+		}
+
+		template<typename T, int D>
+		inline T polynomial<T, D>::evaluate(T x, T& d) const
+		{
+			T r = c[D];
+			d = T(0);
+			for(int i = D - 1; i >= 0; i--)
+			{
+				d = d * x + r;
+				r = r * x + c[i];
+			}
+			return r;
+		}
+
+		template<typename T, int D>
+		inline polynomial<T, (D > 0 ? D - 1 : 0)> polynomial<T, D>::differentiate() const
+		{
+			polynomial<T, (D > 0 ? D - 1 : 0)> r;
+			r.c[0] = T(0);
+			for(int i = 1; i <= D; i++)
+				r.c[i - 1] = c[i] * T(i);
+			return r;
+		}
+
+		template<typename T, int P, int Q>
+		inline T rational<T, P, Q>::evaluate(T x) const
+		{
+			return p.evaluate(x) / q.evaluate(x);
+		}
+
+		template<typename T, int P, int Q>
+		inline T rational<T, P, Q>::derivative(T x) const
+		{
+			T dp, dq;
+			const T vp = p.evaluate(x, dp);
+			const T vq = q.evaluate(x, dq);
+			return (dp * vq - vp * dq) / (vq * vq);
+		}
+
+		// Template implementation
+		template<typename T, int D>
+		void polynomial<T, D>::evaluate(const T* x, size_t count, T* values, T* derivatives) const
+		{
+			// A copy of the coefficients, so the loops cannot alias them.
+			const polynomial<T, D> self = *this;
+			parallelFor(count, Internal::PolynomialGrain, [=](size_t begin, size_t end, size_t) {
+				if(derivatives != nullptr)
+				{
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+					{
+						const T v = x[i];
+						T d;
+						values[i] = self.evaluate(v, d);
+						derivatives[i] = d;
+					}
+					return;
+				}
+				Internal::polynomialSpan<T, D>(self.c, x, values, begin, end);
+			});
+		}
+
+		template<typename T, int D>
+		int polynomial<T, D>::roots(T* out) const
+		{
+			static_assert(D <= 4, "closed form roots need a degree up to 4");
+			static_assert(std::is_floating_point<T>::value, "closed form roots need a floating point type");
+
+			int n = D;
+			while(n > 0 && c[n] == 0)
+				n--;
+			if(n == 0)
+				return 0;
+
+			T found[4];
+			const int count = Internal::polynomialRoots(c, n, found);
+
+			// Newton steps on the original coefficients win back what the
+			// reductions lost, as long as they do not make things worse.
+			for(int i = 0; i < count; i++)
+			{
+				T x = found[i];
+				T d;
+				T fx = std::fabs(evaluate(x, d));
+				for(int step = 0; step < 4 && fx != 0 && d != 0; step++)
+				{
+					const T next = x - evaluate(x) / d;
+					T nd;
+					const T fn = std::fabs(evaluate(next, nd));
+					if(!(fn < fx))
+						break;
+					x = next;
+					fx = fn;
+					d = nd;
+				}
+				found[i] = x;
+			}
+
+			// Neighbours are one multiple root when the polynomial cannot be
+			// told from zero at its extremum between them, which is where
+			// the two roots of a split multiple root meet and where two
+			// distinct roots are furthest from it. The extremum is found
+			// with Newton steps on the derivative and the value there is
+			// computed in twice the precision, so the test is against the
+			// rounding of the coefficients alone.
+			for(int i = 1; i < count; i++)
+				for(int j = i; j > 0 && found[j] < found[j - 1]; j--)
+					std::swap(found[j], found[j - 1]);
+			const polynomial<T, (D > 0 ? D - 1 : 0)> slope = differentiate();
+			int k = 0;
+			for(int i = 0; i < count; i++)
+			{
+				if(k > 0)
+				{
+					const T a = out[k - 1], b = found[i];
+					T m = (a + b) / 2;
+					for(int step = 0; step < 8; step++)
+					{
+						T curvature;
+						const T d = slope.evaluate(m, curvature);
+						if(d == 0 || curvature == 0)
+							break;
+						const T next = m - d / curvature;
+						if(!(next >= a && next <= b) || next == m)
+							break;
+						m = next;
+					}
+
+					T bound = std::fabs(c[n]);
+					for(int j = n - 1; j >= 0; j--)
+						bound = bound * std::fabs(m) + std::fabs(c[j]);
+					if(std::fabs(Internal::compensatedHorner(c, n, m)) <= std::numeric_limits<T>::epsilon() * bound)
+					{
+						out[k - 1] = m;
+						continue;
+					}
+				}
+				out[k++] = found[i];
+			}
+			return k;
+		}
+
+		template<typename T, int P, int Q>
+		void rational<T, P, Q>::evaluate(const T* x, size_t count, T* values) const
+		{
+			const polynomial<T, P> np = p;
+			const polynomial<T, Q> nq = q;
+			parallelFor(count, Internal::PolynomialGrain, [=](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = begin; i < end; i++)
+				{
+					const T v = x[i];
+					values[i] = Internal::horner<T, P>(np.c, v) / Internal::horner<T, Q>(nq.c, v);
+				}
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_POLYNOMIAL_H
@@ -0,0 +1,486 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Random.h
+ * Random number header. This contains the Philox counter-based and
+ * xoshiro256** generators, and bulk samplers for uniform and normal
+ * numbers and for points in disks, balls and on spheres.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_RANDOM_H
+#define AURORAFW_MATH_RANDOM_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * The Philox4x32-10 counter-based generator. Every 128 bit counter
+		 * is encrypted into four random 32 bit words by ten cheap rounds
+		 * keyed by the seed, so any position of the sequence can be computed
+		 * directly. The bulk samplers use this to give every sample its own
+		 * counter, which makes their output independent of how the work is
+		 * split across threads.
+		 *
+		 * It also works as a sequential C++ random bit generator, so it can
+		 * drive the std distributions.
+		 * @since snapshot20261019
+		 */
+		class AFW_API philox {
+		public:
+			typedef uint32_t result_type;
+
+			/** Constructs a generator.
+			 * @param seed The seed, used as the key.
+			 * @param stream Selects one of 2^32 independent sequences for the same seed.
+			 * @since snapshot20261019
+			 */
+			explicit philox(uint64_t = 0, uint32_t = 0);
+
+			/** Computes the four words of a block. Blocks are numbered by a
+			 * 64 bit index and a 32 bit sub index.
+			 * @param index The block index.
+			 * @param sub The sub index.
+			 * @param words Receives the four random words.
+			 * @since snapshot20261019
+			 */
+			void block(uint64_t , uint32_t , uint32_t (&)[4]) const;
+
+			/** Returns the next word of the sequential stream, which walks
+			 * the words of blocks 0, 1, ... with sub index 0.
+			 * @since snapshot20261019
+			 */
+			result_type operator()();
+
+			/** Skips the given number of words of the sequential stream.
+			 * @since snapshot20261019
+			 */
+			void discard(uint64_t );
+
+			/** Returns the seed.
+			 * @since snapshot20261019
+			 */
+			uint64_t seed() const;
+
+			/** Returns the stream.
+			 * @since snapshot20261019
+			 */
+			uint32_t stream() const;
+
+			static constexpr result_type min() { return 0; }
+			static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+		private:
+			uint32_t m_key[2];
+			uint32_t m_stream;
+			uint64_t m_position;
+		};
+
+		/**
+		 * The xoshiro256** generator: 256 bits of state, a period of
+		 * 2^256 - 1 and very fast sequential output. Independent per-thread
+		 * streams are made by copying a generator and calling jump() once
+		 * more for every thread, each jump skipping 2^128 outputs.
+		 * @since snapshot20261019
+		 */
+		class AFW_API xoshiro256 {
+		public:
+			typedef uint64_t result_type;
+
+			/** Constructs a generator, expanding the seed with splitmix64.
+			 * @since snapshot20261019
+			 */
+			explicit xoshiro256(uint64_t = 0);
+
+			/** Returns the next 64 random bits.
+			 * @since snapshot20261019
+			 */
+			result_type operator()();
+
+			/** Advances the generator by 2^128 outputs.
+			 * @since snapshot20261019
+			 */
+			void jump();
+
+			/** Advances the generator by 2^192 outputs.
+			 * @since snapshot20261019
+			 */
+			void longJump();
+
+			static constexpr result_type min() { return 0; }
+			static constexpr result_type max() { return 0xFFFFFFFFFFFFFFFFull; }
+
+		private:
+			void jump(const uint64_t (&)[4]);
+
+			uint64_t m_state[4];
+		};
+
+		/**
+		 * Fills a span with uniform numbers in [lo, hi). Sample i of the
+		 * span is sample offset + i of the generator, so a span can be
+		 * generated in pieces, on any number of threads, with the same result.
+		 * @param rng The generator.
+		 * @param offset The index of the first sample.
+		 * @param values Receives the samples.
+		 * @param count The number of samples.
+		 * @param lo The lower bound.
+		 * @param hi The upper bound.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void randomUniform(const philox& , uint64_t , T* , size_t , T = T(0), T = T(1));
+
+		/**
+		 * Fills a span with normally distributed numbers, using the
+		 * Box-Muller transform. Reproducible as randomUniform() is.
+		 * @param rng The generator.
+		 * @param offset The index of the first sample.
+		 * @param values Receives the samples.
+		 * @param count The number of samples.
+		 * @param mean The mean.
+		 * @param deviation The standard deviation.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void randomNormal(const philox& , uint64_t , T* , size_t , T = T(0), T = T(1));
+
+		/**
+		 * Fills a span with points uniformly distributed in the unit disk.
+		 * Reproducible as randomUniform() is.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void randomInDisk(const philox& , uint64_t , vec2<T>* , size_t );
+
+		/**
+		 * Fills a span with points uniformly distributed on the unit sphere.
+		 * Reproducible as randomUniform() is.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void randomOnSphere(const philox& , uint64_t , vec3<T>* , size_t );
+
+		/**
+		 * Fills a span with points uniformly distributed in the unit ball.
+		 * Reproducible as randomUniform() is.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void randomInBall(const philox& , uint64_t , vec3<T>* , size_t );
+
+		/**
+		 * Fills a span with points uniformly distributed on the unit
+		 * hemisphere around the given normal. Reproducible as
+		 * randomUniform() is.
+		 * @param rng The generator.
+		 * @param offset The index of the first sample.
+		 * @param normal The unit normal the hemisphere is centered on.
+		 * @param points Receives the samples.
+		 * @param count The number of samples.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void randomOnHemisphere(const philox& , uint64_t , const vec3<T>& , vec3<T>* , size_t );
+
+		namespace Internal {
+			constexpr size_t RandomGrain = 1 << 14;
+
+			inline void philoxRounds(uint32_t (&c)[4], uint32_t k0, uint32_t k1)
+			{
+				for(int round = 0; round < 10; round++)
+				{
+					const uint64_t p0 = uint64_t(0xD2511F53u) * c[0];
+					const uint64_t p1 = uint64_t(0xCD9E8D57u) * c[2];
+					const uint32_t c0 = uint32_t(p1 >> 32) ^ c[1] ^ k0;
+					const uint32_t c2 = uint32_t(p0 >> 32) ^ c[3] ^ k1;
+					c[1] = uint32_t(p1);
+					c[3] = uint32_t(p0);
+					c[0] = c0;
+					c[2] = c2;
+					k0 += 0x9E3779B9u;
+					k1 += 0xBB67AE85u;
+				}
+			}
+
+			// Maps random words to [0, 1): 24 bits for float, 53 for double.
+			template<typename T>
+			struct randomUnit;
+
+			template<>
+			struct randomUnit<float> {
+				enum { Words = 1 };
+				static float get(const uint32_t* w) { return float(w[0] >> 8) * (1.0f / 16777216.0f); }
+			};
+
+			template<>
+			struct randomUnit<double> {
+				enum { Words = 2 };
+				static double get(const uint32_t* w)
+				{
+					return double((uint64_t(w[0]) << 21) ^ (w[1] >> 11)) * (1.0 / 9007199254740992.0);
+				}
+			};
+
+			// Calls f(i, words) for the samples [first, last) of a
+			// sampler using perBlock samples of each block, where words
+			// points at the words of sample i.
+			template<typename F>
+			inline void randomBlocks(const philox& rng, uint64_t first, uint64_t last, uint32_t perBlock, uint32_t words, F f)
+			{
+				uint32_t w[4];
+				uint64_t i = first;
+				while(i < last)
+				{
+					rng.block(i / perBlock, 0, w);
+					for(uint32_t k = uint32_t(i % perBlock); k < perBlock && i < last; k++, i++)
+						f(i, w + k * words);
+				}
+			}
+
+			// An orthonormal basis around a unit vector, without branches
+			// on the sign (Duff et al. 2017).
+			template<typename T>
+			inline void randomBasis(const vec3<T>& n, vec3<T>& b1, vec3<T>& b2)
+			{
+				const T sign = std::copysign(T(1), n.z);
+				const T a = T(-1) / (sign + n.z);
+				const T b = n.x * n.y * a;
+				b1 = vec3<T>(1 + sign * n.x * n.x * a, sign * b, -sign * n.x);
+				b2 = vec3<T>(b, sign + n.y * n.y * a, -n.y);
+			}
+		}
+
+		// Inline definitions
+		inline philox::philox(uint64_t seed, uint32_t stream)
+			: m_stream(stream), m_position(0)
+		{
+			m_key[0] = uint32_t(seed);
+			m_key[1] = uint32_t(seed >> 32);
+		}
+
+		inline void philox::block(uint64_t index, uint32_t sub, uint32_t (&words)[4]) const
+		{
+			words[0] = uint32_t(index);
+			words[1] = uint32_t(index >> 32);
+			words[2] = sub;
+			words[3] = m_stream;
+			Internal::philoxRounds(words, m_key[0], m_key[1]);
+		}
+
+		inline philox::result_type philox::operator()()
+		{
+			uint32_t w[4];
+			block(m_position / 4, 0, w);
+			return w[m_position++ % 4];
+		}
+
+		inline void philox::discard(uint64_t n)
+		{
+			m_position += n;
+		}
+
+		inline uint64_t philox::seed() const
+		{
+			return uint64_t(m_key[0]) | (uint64_t(m_key[1]) << 32);
+		}
+
+		inline uint32_t philox::stream() const
+		{
+			return m_stream;
+		}
+
+		inline xoshiro256::xoshiro256(uint64_t seed)
+		{
+			for(int i = 0; i < 4; i++)
+			{
+				uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+				m_state[i] = z ^ (z >> 31);
+			}
+		}
+
+		inline xoshiro256::result_type xoshiro256::operator()()
+		{
+			const uint64_t s1 = m_state[1] * 5;
+			const uint64_t result = ((s1 << 7) | (s1 >> 57)) * 9;
+			const uint64_t t = m_state[1] << 17;
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3] = (m_state[3] << 45) | (m_state[3] >> 19);
+			return result;
+		}
+
+		inline void xoshiro256::jump(const uint64_t (&polynomial)[4])
+		{
+			uint64_t s[4] = { 0, 0, 0, 0 };
+			for(int i = 0; i < 4; i++)
+				for(int b = 0; b < 64; b++)
+				{
+					if(polynomial[i] & (uint64_t(1) << b))
+						for(int j = 0; j < 4; j++)
+							s[j] ^= m_state[j];
+					(*this)();
+				}
+			for(int j = 0; j < 4; j++)
+				m_state[j] = s[j];
+		}
+
+		inline void xoshiro256::jump()
+		{
+			static const uint64_t polynomial[4] = {
+				0x180EC6D33CFD0ABAull, 0xD5A61266F0C9392Cull, 0xA9582618E03FC9AAull, 0x39ABDC4529B1661Cull
+			};
+			jump(polynomial);
+		}
+
+		inline void xoshiro256::longJump()
+		{
+			static const uint64_t polynomial[4] = {
+				0x76E15D3EFEFDCBBFull, 0xC5004E441C522FB3ull, 0x77710069854EE241ull, 0x39109BB02ACBE635ull
+			};
+			jump(polynomial);
+		}
+
+		// Template implementation
+		template<typename T>
+		void randomUniform(const philox& rng, uint64_t offset, T* values, size_t count, T lo, T hi)
+		{
+			typedef Internal::randomUnit<T> unit;
+			const T scale = hi - lo;
+			parallelFor(count, Internal::RandomGrain, [&](size_t begin, size_t end, size_t) {
+				Internal::randomBlocks(rng, offset + begin, offset + end, 4 / unit::Words, unit::Words,
+					[&](uint64_t i, const uint32_t* w) {
+						values[i - offset] = lo + scale * unit::get(w);
+					});
+			});
+		}
+
+		template<typename T>
+		void randomNormal(const philox& rng, uint64_t offset, T* values, size_t count, T mean, T deviation)
+		{
+			// Samples 2k and 2k + 1 are the two outputs of one Box-Muller
+			// pair, so a pair is computed once even when split.
+			typedef Internal::randomUnit<T> unit;
+			const uint64_t first = offset, last = offset + count;
+			parallelFor(count, Internal::RandomGrain, [&](size_t begin, size_t end, size_t) {
+				const uint64_t from = offset + begin, to = offset + end;
+				Internal::randomBlocks(rng, from / 2, (to + 1) / 2, 2 / unit::Words, 2 * unit::Words,
+					[&](uint64_t pair, const uint32_t* w) {
+						const T r = deviation * std::sqrt(-2 * std::log(1 - unit::get(w)));
+						const T angle = T(6.28318530717958647692) * unit::get(w + unit::Words);
+						const uint64_t i = 2 * pair;
+						if(i >= from && i >= first)
+							values[i - offset] = mean + r * std::cos(angle);
+						if(i + 1 < to && i + 1 < last)
+							values[i + 1 - offset] = mean + r * std::sin(angle);
+					});
+			});
+		}
+
+		template<typename T>
+		void randomInDisk(const philox& rng, uint64_t offset, vec2<T>* points, size_t count)
+		{
+			typedef Internal::randomUnit<T> unit;
+			parallelFor(count, Internal::RandomGrain, [&](size_t begin, size_t end, size_t) {
+				Internal::randomBlocks(rng, offset + begin, offset + end, 2 / unit::Words, 2 * unit::Words,
+					[&](uint64_t i, const uint32_t* w) {
+						const T r = std::sqrt(unit::get(w));
+						const T angle = T(6.28318530717958647692) * unit::get(w + unit::Words);
+						points[i - offset] = vec2<T>(r * std::cos(angle), r * std::sin(angle));
+					});
+			});
+		}
+
+		template<typename T>
+		void randomOnSphere(const philox& rng, uint64_t offset, vec3<T>* points, size_t count)
+		{
+			typedef Internal::randomUnit<T> unit;
+			parallelFor(count, Internal::RandomGrain, [&](size_t begin, size_t end, size_t) {
+				Internal::randomBlocks(rng, offset + begin, offset + end, 2 / unit::Words, 2 * unit::Words,
+					[&](uint64_t i, const uint32_t* w) {
+						const T z = 1 - 2 * unit::get(w);
+						const T r = std::sqrt(std::max(T(0), 1 - z * z));
+						const T angle = T(6.28318530717958647692) * unit::get(w + unit::Words);
+						points[i - offset] = vec3<T>(r * std::cos(angle), r * std::sin(angle), z);
+					});
+			});
+		}
+
+		template<typename T>
+		void randomInBall(const philox& rng, uint64_t offset, vec3<T>* points, size_t count)
+		{
+			// Three units do not fit a block in double precision, so every
+			// sample takes the first words of its own block and, for the
+			// radius, the same block index with sub index 1.
+			typedef Internal::randomUnit<T> unit;
+			parallelFor(count, Internal::RandomGrain, [&](size_t begin, size_t end, size_t) {
+				uint32_t radius[4];
+				Internal::randomBlocks(rng, offset + begin, offset + end, 1, 4,
+					[&](uint64_t i, const uint32_t* w) {
+						rng.block(i, 1, radius);
+						const T z = 1 - 2 * unit::get(w);
+						const T r = std::sqrt(std::max(T(0), 1 - z * z));
+						const T angle = T(6.28318530717958647692) * unit::get(w + unit::Words);
+						const T scale = std::cbrt(unit::get(radius));
+						points[i - offset] = vec3<T>(scale * r * std::cos(angle), scale * r * std::sin(angle), scale * z);
+					});
+			});
+		}
+
+		template<typename T>
+		void randomOnHemisphere(const philox& rng, uint64_t offset, const vec3<T>& normal, vec3<T>* points, size_t count)
+		{
+			typedef Internal::randomUnit<T> unit;
+			vec3<T> b1, b2;
+			Internal::randomBasis(normal, b1, b2);
+			parallelFor(count, Internal::RandomGrain, [&](size_t begin, size_t end, size_t) {
+				Internal::randomBlocks(rng, offset + begin, offset + end, 2 / unit::Words, 2 * unit::Words,
+					[&](uint64_t i, const uint32_t* w) {
+						const T z = unit::get(w);
+						const T r = std::sqrt(std::max(T(0), 1 - z * z));
+						const T angle = T(6.28318530717958647692) * unit::get(w + unit::Words);
+						const T x = r * std::cos(angle), y = r * std::sin(angle);
+						points[i - offset] = vec3<T>(x * b1.x + y * b2.x + z * normal.x,
+							x * b1.y + y * b2.y + z * normal.y, x * b1.z + y * b2.z + z * normal.z);
+					});
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_RANDOM_H
@@ -0,0 +1,574 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Ray.h
+ * Ray header. This contains a ray struct, the hit record returned by
+ * ray queries and the ray/primitive intersection routines, for single
+ * rays, ray packets and batches of primitives.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_RAY_H
+#define AURORAFW_MATH_RAY_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/SoA.h>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * The primitive index of a hit record that hit nothing.
+		 * @since snapshot20261019
+		 */
+		constexpr uint32_t InvalidPrimitive = 0xFFFFFFFFu;
+
+		/**
+		 * A struct that represents a ray as an origin and a direction,
+		 * restricted to the distances between tMin and tMax.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API ray {
+			/** Constructs a ray at the origin with no direction.
+			 * @since snapshot20261019
+			 */
+			ray();
+
+			/** Constructs a ray from the given origin and direction.
+			 * @param origin The ray origin.
+			 * @param direction The ray direction. It does not need to be normalized,
+			 * distances are then measured in multiples of its length.
+			 * @param tMin The start of the ray interval.
+			 * @param tMax The end of the ray interval.
+			 * @since snapshot20261019
+			 */
+			ray(const vec3<T>& , const vec3<T>& , T = 0, T = std::numeric_limits<T>::max());
+
+			/** Returns the point at the given distance along the ray.
+			 * @since snapshot20261019
+			 */
+			vec3<T> at(T ) const;
+
+			/** Returns the component-wise inverse of the direction, as used
+			 * by the slab tests.
+			 * @since snapshot20261019
+			 */
+			vec3<T> inverseDirection() const;
+
+			vec3<T> origin;
+			vec3<T> direction;
+			T tMin;
+			T tMax;
+		};
+
+		typedef ray<float> Ray;
+
+		/**
+		 * A packet of N rays stored as a structure of arrays, so one
+		 * primitive is tested against all of them at once.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		struct AFW_API rayPacket {
+			/** Sets the ray at the given lane.
+			 * @since snapshot20261019
+			 */
+			void set(size_t , const ray<T>& );
+
+			/** Returns the ray at the given lane.
+			 * @since snapshot20261019
+			 */
+			ray<T> get(size_t ) const;
+
+			T ox[N], oy[N], oz[N];
+			T dx[N], dy[N], dz[N];
+			T tMin[N], tMax[N];
+		};
+
+		typedef rayPacket<float, 4> RayPacket4;
+		typedef rayPacket<float, 8> RayPacket8;
+		typedef rayPacket<float, 16> RayPacket16;
+
+		/**
+		 * A struct that stores where a ray hit a primitive.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API rayHit {
+			/** Constructs a record that hit nothing.
+			 * @since snapshot20261019
+			 */
+			rayHit();
+
+			/** Returns <code>true</code> if the record holds a hit.
+			 * @since snapshot20261019
+			 */
+			bool valid() const;
+
+			/** The distance along the ray. */
+			T t;
+			/** The barycentric coordinate of the second triangle vertex. */
+			T u;
+			/** The barycentric coordinate of the third triangle vertex. */
+			T v;
+			/** The index of the primitive hit, or InvalidPrimitive. */
+			uint32_t primitive;
+		};
+
+		/**
+		 * The hit records of a ray packet, stored as a structure of arrays.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		struct AFW_API hitPacket {
+			/** Constructs records that hit nothing.
+			 * @since snapshot20261019
+			 */
+			hitPacket();
+
+			/** Returns the hit record at the given lane.
+			 * @since snapshot20261019
+			 */
+			rayHit<T> get(size_t ) const;
+
+			T t[N], u[N], v[N];
+			uint32_t primitive[N];
+		};
+
+		/**
+		 * A view over many triangles stored as a structure of arrays, one
+		 * view per vertex.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API triangleSoA {
+			vec3SoA<T> a;
+			vec3SoA<T> b;
+			vec3SoA<T> c;
+		};
+
+		// Inline definitions
+		template<typename T>
+		inline vec3<T> ray<T>::at(T t) const
+		{
+			return vec3<T>(origin.x + direction.x * t, origin.y + direction.y * t, origin.z + direction.z * t);
+		}
+
+		template<typename T>
+		inline vec3<T> ray<T>::inverseDirection() const
+		{
+			return vec3<T>(1 / direction.x, 1 / direction.y, 1 / direction.z);
+		}
+
+		template<typename T>
+		inline bool rayHit<T>::valid() const
+		{
+			return primitive != InvalidPrimitive;
+		}
+
+		// Template implementation
+		template<typename T>
+		ray<T>::ray()
+			: tMin(0), tMax(std::numeric_limits<T>::max())
+		{}
+
+		template<typename T>
+		ray<T>::ray(const vec3<T>& origin, const vec3<T>& direction, T tMin, T tMax)
+			: origin(origin), direction(direction), tMin(tMin), tMax(tMax)
+		{}
+
+		template<typename T>
+		rayHit<T>::rayHit()
+			: t(std::numeric_limits<T>::max()), u(0), v(0), primitive(InvalidPrimitive)
+		{}
+
+		template<typename T, size_t N>
+		void rayPacket<T, N>::set(size_t i, const ray<T>& r)
+		{
+			ox[i] = r.origin.x;
+			oy[i] = r.origin.y;
+			oz[i] = r.origin.z;
+			dx[i] = r.direction.x;
+			dy[i] = r.direction.y;
+			dz[i] = r.direction.z;
+			tMin[i] = r.tMin;
+			tMax[i] = r.tMax;
+		}
+
+		template<typename T, size_t N>
+		ray<T> rayPacket<T, N>::get(size_t i) const
+		{
+			return ray<T>(vec3<T>(ox[i], oy[i], oz[i]), vec3<T>(dx[i], dy[i], dz[i]), tMin[i], tMax[i]);
+		}
+
+		template<typename T, size_t N>
+		hitPacket<T, N>::hitPacket()
+		{
+			for(size_t i = 0; i < N; i++)
+			{
+				t[i] = std::numeric_limits<T>::max();
+				u[i] = v[i] = 0;
+				primitive[i] = InvalidPrimitive;
+			}
+		}
+
+		template<typename T, size_t N>
+		rayHit<T> hitPacket<T, N>::get(size_t i) const
+		{
+			rayHit<T> hit;
+			hit.t = t[i];
+			hit.u = u[i];
+			hit.v = v[i];
+			hit.primitive = primitive[i];
+			return hit;
+		}
+
+		/**
+		 * Intersects a ray with a triangle using the Möller-Trumbore
+		 * algorithm. Both faces of the triangle are hit.
+		 * @param r The ray.
+		 * @param a The first triangle vertex.
+		 * @param b The second triangle vertex.
+		 * @param c The third triangle vertex.
+		 * @param t Receives the distance along the ray on a hit.
+		 * @param u Receives the barycentric coordinate of b on a hit.
+		 * @param v Receives the barycentric coordinate of c on a hit.
+		 * @return <code>true</code> if the ray hits the triangle within [tMin, tMax].
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		bool intersectTriangle(const ray<T>& r, const vec3<T>& a, const vec3<T>& b, const vec3<T>& c,
+			T& t, T& u, T& v)
+		{
+			const vec3<T> e1(b.x - a.x, b.y - a.y, b.z - a.z);
+			const vec3<T> e2(c.x - a.x, c.y - a.y, c.z - a.z);
+			const vec3<T> p = r.direction.cross(e2);
+			const T det = e1.dot(p);
+			if(det == 0)
+				return false;
+
+			const T invDet = 1 / det;
+			const vec3<T> s(r.origin.x - a.x, r.origin.y - a.y, r.origin.z - a.z);
+			const T hu = s.dot(p) * invDet;
+			if(hu < 0 || hu > 1)
+				return false;
+
+			const vec3<T> q = s.cross(e1);
+			const T hv = r.direction.dot(q) * invDet;
+			if(hv < 0 || hu + hv > 1)
+				return false;
+
+			const T ht = e2.dot(q) * invDet;
+			if(ht < r.tMin || ht > r.tMax)
+				return false;
+
+			t = ht;
+			u = hu;
+			v = hv;
+			return true;
+		}
+
+		/**
+		 * Intersects a ray with a sphere. A ray starting inside the sphere
+		 * hits it on the way out.
+		 * @param r The ray.
+		 * @param center The sphere center.
+		 * @param radius The sphere radius.
+		 * @param t Receives the distance along the ray on a hit.
+		 * @return <code>true</code> if the ray hits the sphere within [tMin, tMax].
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		bool intersectSphere(const ray<T>& r, const vec3<T>& center, T radius, T& t)
+		{
+			const vec3<T> oc(r.origin.x - center.x, r.origin.y - center.y, r.origin.z - center.z);
+			const T a = r.direction.dot(r.direction);
+			const T b = oc.dot(r.direction);
+			const T c = oc.dot(oc) - radius * radius;
+			const T disc = b * b - a * c;
+			if(disc < 0)
+				return false;
+
+			const T sq = std::sqrt(disc);
+			T ht = (-b - sq) / a;
+			if(ht < r.tMin)
+				ht = (-b + sq) / a;
+			if(ht < r.tMin || ht > r.tMax)
+				return false;
+
+			t = ht;
+			return true;
+		}
+
+		/**
+		 * Intersects a packet of rays with one triangle, keeping the closest
+		 * hit of every ray. Rays only hit if closer than their current hit.
+		 * @param packet The rays.
+		 * @param a The first triangle vertex.
+		 * @param b The second triangle vertex.
+		 * @param c The third triangle vertex.
+		 * @param primitive The index stored in the hits.
+		 * @param hits The hit records to update.
+		 * @return A mask with bit i set if ray i hit the triangle.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		uint32_t intersectTriangle(const rayPacket<T, N>& packet, const vec3<T>& a, const vec3<T>& b,
+			const vec3<T>& c, uint32_t primitive, hitPacket<T, N>& hits)
+		{
+			static_assert(N <= 32, "packets are limited to 32 rays");
+
+			const T e1x = b.x - a.x, e1y = b.y - a.y, e1z = b.z - a.z;
+			const T e2x = c.x - a.x, e2y = c.y - a.y, e2z = c.z - a.z;
+			uint32_t mask = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < N; i++)
+			{
+				const T px = packet.dy[i] * e2z - packet.dz[i] * e2y;
+				const T py = packet.dz[i] * e2x - packet.dx[i] * e2z;
+				const T pz = packet.dx[i] * e2y - packet.dy[i] * e2x;
+				const T det = e1x * px + e1y * py + e1z * pz;
+				const T invDet = 1 / det;
+
+				const T sx = packet.ox[i] - a.x, sy = packet.oy[i] - a.y, sz = packet.oz[i] - a.z;
+				const T u = (sx * px + sy * py + sz * pz) * invDet;
+
+				const T qx = sy * e1z - sz * e1y;
+				const T qy = sz * e1x - sx * e1z;
+				const T qz = sx * e1y - sy * e1x;
+				const T v = (packet.dx[i] * qx + packet.dy[i] * qy + packet.dz[i] * qz) * invDet;
+				const T t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+				const T tMax = hits.t[i] < packet.tMax[i] ? hits.t[i] : packet.tMax[i];
+				const bool hit = det != 0 && u >= 0 && v >= 0 && u + v <= 1 && t >= packet.tMin[i] && t <= tMax;
+
+				hits.t[i] = hit ? t : hits.t[i];
+				hits.u[i] = hit ? u : hits.u[i];
+				hits.v[i] = hit ? v : hits.v[i];
+				hits.primitive[i] = hit ? primitive : hits.primitive[i];
+				mask |= uint32_t(hit) << i;
+			}
+
+			return mask;
+		}
+
+		/**
+		 * Intersects a packet of rays with one sphere, keeping the closest
+		 * hit of every ray. The barycentric coordinates of sphere hits are 0.
+		 * @param packet The rays.
+		 * @param center The sphere center.
+		 * @param radius The sphere radius.
+		 * @param primitive The index stored in the hits.
+		 * @param hits The hit records to update.
+		 * @return A mask with bit i set if ray i hit the sphere.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		uint32_t intersectSphere(const rayPacket<T, N>& packet, const vec3<T>& center, T radius,
+			uint32_t primitive, hitPacket<T, N>& hits)
+		{
+			static_assert(N <= 32, "packets are limited to 32 rays");
+
+			const T r2 = radius * radius;
+			uint32_t mask = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < N; i++)
+			{
+				const T ocx = packet.ox[i] - center.x, ocy = packet.oy[i] - center.y, ocz = packet.oz[i] - center.z;
+				const T a = packet.dx[i] * packet.dx[i] + packet.dy[i] * packet.dy[i] + packet.dz[i] * packet.dz[i];
+				const T b = ocx * packet.dx[i] + ocy * packet.dy[i] + ocz * packet.dz[i];
+				const T c = ocx * ocx + ocy * ocy + ocz * ocz - r2;
+				const T disc = b * b - a * c;
+				const T sq = std::sqrt(disc > 0 ? disc : T(0));
+				const T t0 = (-b - sq) / a;
+				const T t = t0 >= packet.tMin[i] ? t0 : (-b + sq) / a;
+
+				const T tMax = hits.t[i] < packet.tMax[i] ? hits.t[i] : packet.tMax[i];
+				const bool hit = disc >= 0 && t >= packet.tMin[i] && t <= tMax;
+
+				hits.t[i] = hit ? t : hits.t[i];
+				hits.u[i] = hit ? T(0) : hits.u[i];
+				hits.v[i] = hit ? T(0) : hits.v[i];
+				hits.primitive[i] = hit ? primitive : hits.primitive[i];
+				mask |= uint32_t(hit) << i;
+			}
+
+			return mask;
+		}
+
+		/**
+		 * Intersects one ray with many triangles, writing one result per
+		 * triangle.
+		 * @param r The ray.
+		 * @param triangles The triangles, as a structure of arrays.
+		 * @param t Receives the hit distance per triangle, or the biggest T on a miss.
+		 * @param u Receives the barycentric coordinate of b per triangle.
+		 * @param v Receives the barycentric coordinate of c per triangle.
+		 * @return The number of triangles hit.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t intersectTriangles(const ray<T>& r, const triangleSoA<const T>& triangles, T* t, T* u, T* v)
+		{
+			const T ox = r.origin.x, oy = r.origin.y, oz = r.origin.z;
+			const T dx = r.direction.x, dy = r.direction.y, dz = r.direction.z;
+			const T tMin = r.tMin, tMax = r.tMax;
+			const T miss = std::numeric_limits<T>::max();
+			const vec3SoA<const T>& A = triangles.a;
+			const vec3SoA<const T>& B = triangles.b;
+			const vec3SoA<const T>& C = triangles.c;
+			size_t count = 0;
+
+			AFW_MATH_SIMD_LOOP
+			for(size_t i = 0; i < A.size; i++)
+			{
+				const T e1x = B.x[i] - A.x[i], e1y = B.y[i] - A.y[i], e1z = B.z[i] - A.z[i];
+				const T e2x = C.x[i] - A.x[i], e2y = C.y[i] - A.y[i], e2z = C.z[i] - A.z[i];
+				const T px = dy * e2z - dz * e2y;
+				const T py = dz * e2x - dx * e2z;
+				const T pz = dx * e2y - dy * e2x;
+				const T det = e1x * px + e1y * py + e1z * pz;
+				const T invDet = 1 / det;
+
+				const T sx = ox - A.x[i], sy = oy - A.y[i], sz = oz - A.z[i];
+				const T hu = (sx * px + sy * py + sz * pz) * invDet;
+
+				const T qx = sy * e1z - sz * e1y;
+				const T qy = sz * e1x - sx * e1z;
+				const T qz = sx * e1y - sy * e1x;
+				const T hv = (dx * qx + dy * qy + dz * qz) * invDet;
+				const T ht = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+
+				const bool hit = det != 0 && hu >= 0 && hv >= 0 && hu + hv <= 1 && ht >= tMin && ht <= tMax;
+				t[i] = hit ? ht : miss;
+				u[i] = hu;
+				v[i] = hv;
+				count += hit;
+			}
+
+			return count;
+		}
+
+		/**
+		 * Finds the closest of many triangles hit by one ray.
+		 * @param r The ray.
+		 * @param triangles The triangles, as a structure of arrays.
+		 * @param hit Receives the closest hit; its primitive is the triangle index.
+		 * @return <code>true</code> if any triangle was hit.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		bool intersectTriangles(const ray<T>& r, const triangleSoA<const T>& triangles, rayHit<T>& hit)
+		{
+			const size_t Block = 64;
+			T t[Block], u[Block], v[Block];
+			hit = rayHit<T>();
+
+			for(size_t first = 0; first < triangles.a.size; first += Block)
+			{
+				const size_t n = triangles.a.size - first < Block ? triangles.a.size - first : Block;
+				triangleSoA<const T> block = triangles;
+				block.a = { triangles.a.x + first, triangles.a.y + first, triangles.a.z + first, n };
+				block.b = { triangles.b.x + first, triangles.b.y + first, triangles.b.z + first, n };
+				block.c = { triangles.c.x + first, triangles.c.y + first, triangles.c.z + first, n };
+				if(intersectTriangles(r, block, t, u, v) == 0)
+					continue;
+
+				for(size_t i = 0; i < n; i++)
+				{
+					if(t[i] < hit.t)
+					{
+						hit.t = t[i];
+						hit.u = u[i];
+						hit.v = v[i];
+						hit.primitive = static_cast<uint32_t>(first + i);
+					}
+				}
+			}
+
+			return hit.valid();
+		}
+
+		/**
+		 * Finds the closest of many spheres hit by one ray.
+		 * @param r The ray.
+		 * @param centers The sphere centers, as a structure of arrays.
+		 * @param radii The sphere radii, one per center.
+		 * @param hit Receives the closest hit; its primitive is the sphere index.
+		 * @return <code>true</code> if any sphere was hit.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		bool intersectSpheres(const ray<T>& r, const vec3SoA<const T>& centers, const T* radii, rayHit<T>& hit)
+		{
+			const T ox = r.origin.x, oy = r.origin.y, oz = r.origin.z;
+			const T dx = r.direction.x, dy = r.direction.y, dz = r.direction.z;
+			const T a = dx * dx + dy * dy + dz * dz;
+			const T invA = 1 / a;
+			const size_t Block = 64;
+			T t[Block];
+			hit = rayHit<T>();
+
+			for(size_t first = 0; first < centers.size; first += Block)
+			{
+				const size_t n = centers.size - first < Block ? centers.size - first : Block;
+
+				AFW_MATH_SIMD_LOOP
+				for(size_t i = 0; i < n; i++)
+				{
+					const size_t j = first + i;
+					const T ocx = ox - centers.x[j], ocy = oy - centers.y[j], ocz = oz - centers.z[j];
+					const T b = ocx * dx + ocy * dy + ocz * dz;
+					const T c = ocx * ocx + ocy * ocy + ocz * ocz - radii[j] * radii[j];
+					const T disc = b * b - a * c;
+					const T sq = std::sqrt(disc > 0 ? disc : T(0));
+					const T t0 = (-b - sq) * invA;
+					const T ht = t0 >= r.tMin ? t0 : (-b + sq) * invA;
+					const bool hitSphere = disc >= 0 && ht >= r.tMin && ht <= r.tMax;
+					t[i] = hitSphere ? ht : std::numeric_limits<T>::max();
+				}
+
+				for(size_t i = 0; i < n; i++)
+				{
+					if(t[i] < hit.t)
+					{
+						hit.t = t[i];
+						hit.primitive = static_cast<uint32_t>(first + i);
+					}
+				}
+			}
+
+			return hit.valid();
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_RAY_H
@@ -0,0 +1,792 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Reduction.h
+ * Reduction header. This contains parallel sums, minimums, maximums,
+ * mean and variance, centroids and covariance over spans of scalars
+ * and vectors.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_REDUCTION_H
+#define AURORAFW_MATH_REDUCTION_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Matrix.h>
+#include <AuroraFW/Math/VectorTraits.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * How sum() adds up a span. All of them make a single pass over
+		 * memory; the accurate ones only cost extra arithmetic.
+		 * @since snapshot20261019
+		 */
+		enum SumMethod {
+			NaiveSum,    /**< Plain accumulation, error grows linearly with the count. */
+			PairwiseSum, /**< Pairwise over blocks, error grows with the log of the count. */
+			KahanSum     /**< Compensated, error independent of the count. */
+		};
+
+		/**
+		 * Mean and variance of a sequence, per component for vectors,
+		 * kept with Welford's update so it stays accurate for large
+		 * offsets. Two statistics can be merged, which is how the
+		 * parallel computeStatistics() combines its threads.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		struct AFW_API statistics {
+			/** Constructs empty statistics.
+			 * @since snapshot20261019
+			 */
+			statistics();
+
+			/** Constructs statistics from precomputed moments.
+			 * @param count The number of values.
+			 * @param mean The mean.
+			 * @param m2 The sum of squared differences from the mean.
+			 * @since snapshot20261019
+			 */
+			statistics(size_t , const V& , const V& );
+
+			/** Adds a value.
+			 * @since snapshot20261019
+			 */
+			void add(const V& );
+
+			/** Adds all the values described by other statistics.
+			 * @since snapshot20261019
+			 */
+			void merge(const statistics<V>& );
+
+			/** Returns the number of values.
+			 * @since snapshot20261019
+			 */
+			size_t count() const;
+
+			/** Returns the mean, or zero without values.
+			 * @since snapshot20261019
+			 */
+			V mean() const;
+
+			/** Returns the population variance, or zero without values.
+			 * @since snapshot20261019
+			 */
+			V variance() const;
+
+			/** Returns the sample variance, or zero with less than two values.
+			 * @since snapshot20261019
+			 */
+			V sampleVariance() const;
+
+			/** Returns the population standard deviation.
+			 * @since snapshot20261019
+			 */
+			V deviation() const;
+
+			/** Returns the sum of squared differences from the mean.
+			 * @since snapshot20261019
+			 */
+			V m2() const;
+
+		private:
+			size_t m_count;
+			V m_mean;
+			V m_m2;
+		};
+		typedef statistics<float> Statistics;
+
+		/**
+		 * Returns the sum of a span of scalars or vectors.
+		 * @param values The values.
+		 * @param count The number of values.
+		 * @param method How to add them up.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		V sum(const V* , size_t , SumMethod = PairwiseSum);
+
+		/**
+		 * Returns the minimum of a span, per component for vectors. NaNs
+		 * are ignored. An empty span gives +infinity for types that have it,
+		 * such as float and double, and the largest value otherwise.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		V minimum(const V* , size_t );
+
+		/**
+		 * Returns the maximum of a span, per component for vectors. NaNs
+		 * are ignored. An empty span gives -infinity for types that have it,
+		 * such as float and double, and the lowest value otherwise.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		V maximum(const V* , size_t );
+
+		/**
+		 * Computes the minimum and the maximum of a span in one pass.
+		 * @see minimum()
+		 * @see maximum()
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		void minMax(const V* , size_t , V& , V& );
+
+		/**
+		 * Returns the index of the smallest value of a span of scalars, the
+		 * first one on ties. NaNs are ignored.
+		 * @return The index, or count if there is no such value.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t argmin(const T* , size_t );
+
+		/**
+		 * Returns the index of the largest value of a span of scalars, the
+		 * first one on ties. NaNs are ignored.
+		 * @return The index, or count if there is no such value.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		size_t argmax(const T* , size_t );
+
+		/**
+		 * Computes the mean and variance of a span of scalars or vectors.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		statistics<V> computeStatistics(const V* , size_t );
+
+		/**
+		 * Returns the centroid of a set of points, or the zero vector for
+		 * an empty set.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		V centroid(const V* , size_t );
+
+		/**
+		 * Returns the centroid of a set of points stored as SoA.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		vec3<T> centroid(const vec3SoA<const T>& );
+
+		/**
+		 * Returns the population covariance matrix of a set of points.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		mat<typename vecTraits<V>::scalar, vecTraits<V>::Dimension, vecTraits<V>::Dimension> covariance(const V* , size_t );
+
+		namespace Internal {
+			constexpr size_t ReduceGrain = 1 << 15;
+			constexpr size_t ReduceBlock = 256;
+			constexpr int ReduceLanes = 8;
+
+			template<typename V, typename T>
+			inline V reduceMake(const T* c)
+			{
+				typedef elementTraits<V> traits;
+				V v = V();
+				for(int d = 0; d < traits::Dimension; d++)
+					traits::set(v, d, c[d]);
+				return v;
+			}
+
+			// The loops below keep ReduceLanes independent accumulators per
+			// component. They vectorize without reassociating floating point,
+			// so results do not depend on compiler flags.
+			template<typename V>
+			inline void reduceLaneSum(const V* v, size_t n, typename elementTraits<V>::scalar* out)
+			{
+				typedef elementTraits<V> traits;
+				typedef typename traits::scalar T;
+				const int D = traits::Dimension;
+
+				T acc[ReduceLanes][D] = {};
+				size_t i = 0;
+				for(; i + ReduceLanes <= n; i += ReduceLanes)
+					for(int l = 0; l < ReduceLanes; l++)
+						for(int d = 0; d < D; d++)
+							acc[l][d] += traits::get(v[i + l], d);
+				for(; i < n; i++)
+					for(int d = 0; d < D; d++)
+						acc[0][d] += traits::get(v[i], d);
+
+				for(int d = 0; d < D; d++)
+					out[d] = ((acc[0][d] + acc[1][d]) + (acc[2][d] + acc[3][d]))
+						+ ((acc[4][d] + acc[5][d]) + (acc[6][d] + acc[7][d]));
+			}
+
+			template<typename V>
+			void reducePairwiseSum(const V* v, size_t n, typename elementTraits<V>::scalar* out)
+			{
+				typedef elementTraits<V> traits;
+				typedef typename traits::scalar T;
+
+				if(n <= ReduceBlock)
+				{
+					reduceLaneSum(v, n, out);
+					return;
+				}
+
+				const size_t half = (n / ReduceBlock + 1) / 2 * ReduceBlock;
+				T right[traits::Dimension];
+				reducePairwiseSum(v, half, out);
+				reducePairwiseSum(v + half, n - half, right);
+				for(int d = 0; d < traits::Dimension; d++)
+					out[d] += right[d];
+			}
+
+			// Kahan summation per lane. The true sum is sum - compensation.
+			template<typename V>
+			inline void reduceKahanSum(const V* v, size_t n, typename elementTraits<V>::scalar* sum,
+				typename elementTraits<V>::scalar* compensation)
+			{
+				typedef elementTraits<V> traits;
+				typedef typename traits::scalar T;
+				const int D = traits::Dimension;
+
+				T s[ReduceLanes][D] = {};
+				T c[ReduceLanes][D] = {};
+				size_t i = 0;
+				for(; i + ReduceLanes <= n; i += ReduceLanes)
+					for(int l = 0; l < ReduceLanes; l++)
+						for(int d = 0; d < D; d++)
+						{
+							const T y = traits::get(v[i + l], d) - c[l][d];
+							const T t = s[l][d] + y;
+							c[l][d] = (t - s[l][d]) - y;
+							s[l][d] = t;
+						}
+				for(; i < n; i++)
+					for(int d = 0; d < D; d++)
+					{
+						const T y = traits::get(v[i], d) - c[0][d];
+						const T t = s[0][d] + y;
+						c[0][d] = (t - s[0][d]) - y;
+						s[0][d] = t;
+					}
+
+				for(int d = 0; d < D; d++)
+				{
+					sum[d] = 0;
+					compensation[d] = 0;
+					for(int l = 0; l < ReduceLanes; l++)
+					{
+						// Neumaier's variant, since lane sums may be of any magnitude.
+						const T t = sum[d] + s[l][d];
+						if(std::abs(sum[d]) >= std::abs(s[l][d]))
+							compensation[d] -= (sum[d] - t) + s[l][d];
+						else
+							compensation[d] -= (s[l][d] - t) + sum[d];
+						compensation[d] += c[l][d];
+						sum[d] = t;
+					}
+				}
+			}
+
+			template<typename T>
+			struct reduceBounds {
+				static T lowest() { return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest(); }
+				static T highest() { return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max(); }
+			};
+
+			template<typename V>
+			inline void reduceMinMax(const V* v, size_t n, typename elementTraits<V>::scalar* lo, typename elementTraits<V>::scalar* hi)
+			{
+				typedef elementTraits<V> traits;
+				typedef typename traits::scalar T;
+				const int D = traits::Dimension;
+
+				T mn[ReduceLanes][D], mx[ReduceLanes][D];
+				for(int l = 0; l < ReduceLanes; l++)
+					for(int d = 0; d < D; d++)
+					{
+						mn[l][d] = reduceBounds<T>::highest();
+						mx[l][d] = reduceBounds<T>::lowest();
+					}
+
+				size_t i = 0;
+				for(; i + ReduceLanes <= n; i += ReduceLanes)
+					for(int l = 0; l < ReduceLanes; l++)
+						for(int d = 0; d < D; d++)
+						{
+							const T x = traits::get(v[i + l], d);
+							mn[l][d] = x < mn[l][d] ? x : mn[l][d];
+							mx[l][d] = x > mx[l][d] ? x : mx[l][d];
+						}
+				for(; i < n; i++)
+					for(int d = 0; d < D; d++)
+					{
+						const T x = traits::get(v[i], d);
+						mn[0][d] = x < mn[0][d] ? x : mn[0][d];
+						mx[0][d] = x > mx[0][d] ? x : mx[0][d];
+					}
+
+				for(int d = 0; d < D; d++)
+				{
+					lo[d] = mn[0][d];
+					hi[d] = mx[0][d];
+					for(int l = 1; l < ReduceLanes; l++)
+					{
+						lo[d] = mn[l][d] < lo[d] ? mn[l][d] : lo[d];
+						hi[d] = mx[l][d] > hi[d] ? mx[l][d] : hi[d];
+					}
+				}
+			}
+
+			// Index of the first value for which better(value, best) holds
+			// against all earlier ones, or n. A lane takes its first value
+			// that is not NaN unconditionally, so values equal to init are
+			// found too.
+			template<typename T, typename C>
+			inline void reduceArgBest(const T* v, size_t first, size_t last, T init, C better, T& best, size_t& index)
+			{
+				T val[ReduceLanes];
+				size_t idx[ReduceLanes];
+				for(int l = 0; l < ReduceLanes; l++)
+				{
+					val[l] = init;
+					idx[l] = size_t(-1);
+				}
+
+				const T* w = v + first;
+				const size_t n = last - first;
+				size_t i = 0;
+				for(; i + ReduceLanes <= n; i += ReduceLanes)
+					for(int l = 0; l < ReduceLanes; l++)
+					{
+						const bool take = better(w[i + l], val[l]) || (idx[l] == size_t(-1) && w[i + l] == w[i + l]);
+						val[l] = take ? w[i + l] : val[l];
+						idx[l] = take ? first + i + l : idx[l];
+					}
+				for(; i < n; i++)
+				{
+					const bool take = better(w[i], val[0]) || (idx[0] == size_t(-1) && w[i] == w[i]);
+					val[0] = take ? w[i] : val[0];
+					idx[0] = take ? first + i : idx[0];
+				}
+
+				best = init;
+				index = size_t(-1);
+				for(int l = 0; l < ReduceLanes; l++)
+					if(idx[l] != size_t(-1) && (index == size_t(-1) || better(val[l], best) || (!better(best, val[l]) && idx[l] < index)))
+					{
+						best = val[l];
+						index = idx[l];
+					}
+			}
+
+			template<typename T, typename C>
+			size_t reduceArg(const T* v, size_t count, T init, C better)
+			{
+				const size_t chunks = parallelChunkCount(count, ReduceGrain);
+				std::vector<T> best(chunks);
+				std::vector<size_t> index(chunks);
+				parallelFor(count, ReduceGrain, [&](size_t begin, size_t end, size_t chunk) {
+					reduceArgBest(v, begin, end, init, better, best[chunk], index[chunk]);
+				});
+
+				size_t result = size_t(-1);
+				T value = init;
+				for(size_t c = 0; c < chunks; c++)
+					if(index[c] != size_t(-1) && (result == size_t(-1) || better(best[c], value)))
+					{
+						value = best[c];
+						result = index[c];
+					}
+				return result == size_t(-1) ? count : result;
+			}
+
+			// Count, mean and co-moments (sums of products of differences from
+			// the mean) of D components. With Full false only the diagonal,
+			// the per-component m2, is kept.
+			template<typename T, int D, bool Full>
+			struct reduceMoments {
+				size_t n;
+				T mean[D];
+				T m[D][D];
+
+				reduceMoments() : n(0), mean(), m() {}
+
+				// Chan et al. pairwise update.
+				void merge(const reduceMoments& o)
+				{
+					if(o.n == 0)
+						return;
+					if(n == 0)
+					{
+						*this = o;
+						return;
+					}
+
+					const size_t total = n + o.n;
+					const T weight = T(n) * T(o.n) / T(total);
+					T delta[D];
+					for(int i = 0; i < D; i++)
+					{
+						delta[i] = o.mean[i] - mean[i];
+						mean[i] += delta[i] * T(o.n) / T(total);
+					}
+					for(int i = 0; i < D; i++)
+						for(int j = Full ? i : 0; j < D; j++)
+							if(Full || i == j)
+								m[i][j] += o.m[i][j] + delta[i] * delta[j] * weight;
+					n = total;
+				}
+			};
+
+			// Moments of a cache-sized block, computed in two passes over the
+			// block: the mean, then the co-moments around it. Memory is still
+			// read once.
+			template<bool Full, typename V>
+			inline reduceMoments<typename elementTraits<V>::scalar, elementTraits<V>::Dimension, Full> reduceBlockMoments(const V* v, size_t n)
+			{
+				typedef elementTraits<V> traits;
+				typedef typename traits::scalar T;
+				const int D = traits::Dimension;
+
+				reduceMoments<T, D, Full> r;
+				r.n = n;
+				reduceLaneSum(v, n, r.mean);
+				for(int d = 0; d < D; d++)
+					r.mean[d] /= T(n);
+
+				T acc[ReduceLanes][D][D] = {};
+				size_t i = 0;
+				for(; i + ReduceLanes <= n; i += ReduceLanes)
+					for(int l = 0; l < ReduceLanes; l++)
+					{
+						T x[D];
+						for(int d = 0; d < D; d++)
+							x[d] = traits::get(v[i + l], d) - r.mean[d];
+						for(int a = 0; a < D; a++)
+							for(int b = Full ? a : 0; b < D; b++)
+								if(Full || a == b)
+									acc[l][a][b] += x[a] * x[b];
+					}
+				for(; i < n; i++)
+				{
+					T x[D];
+					for(int d = 0; d < D; d++)
+						x[d] = traits::get(v[i], d) - r.mean[d];
+					for(int a = 0; a < D; a++)
+						for(int b = Full ? a : 0; b < D; b++)
+							if(Full || a == b)
+								acc[0][a][b] += x[a] * x[b];
+				}
+
+				for(int a = 0; a < D; a++)
+					for(int b = 0; b < D; b++)
+						for(int l = 0; l < ReduceLanes; l++)
+							r.m[a][b] += acc[l][a][b];
+				return r;
+			}
+
+			template<bool Full, typename V>
+			reduceMoments<typename elementTraits<V>::scalar, elementTraits<V>::Dimension, Full> reduceComputeMoments(const V* v, size_t count)
+			{
+				typedef reduceMoments<typename elementTraits<V>::scalar, elementTraits<V>::Dimension, Full> moments;
+
+				std::vector<moments> partial(parallelChunkCount(count, ReduceGrain));
+				parallelFor(count, ReduceGrain, [&](size_t begin, size_t end, size_t chunk) {
+					for(size_t b = begin; b < end; b += ReduceBlock)
+						partial[chunk].merge(reduceBlockMoments<Full>(v + b, std::min(ReduceBlock, end - b)));
+				});
+
+				moments r;
+				for(const moments& p : partial)
+					r.merge(p);
+				return r;
+			}
+		}
+
+		// Template implementation
+		template<typename V>
+		statistics<V>::statistics()
+			: m_count(0), m_mean(), m_m2()
+		{}
+
+		template<typename V>
+		statistics<V>::statistics(size_t count, const V& mean, const V& m2)
+			: m_count(count), m_mean(mean), m_m2(m2)
+		{}
+
+		template<typename V>
+		void statistics<V>::add(const V& v)
+		{
+			typedef Internal::elementTraits<V> traits;
+			m_count++;
+			for(int d = 0; d < traits::Dimension; d++)
+			{
+				const auto mean = traits::get(m_mean, d);
+				const auto delta = traits::get(v, d) - mean;
+				const auto next = mean + delta / m_count;
+				traits::set(m_mean, d, next);
+				traits::set(m_m2, d, traits::get(m_m2, d) + delta * (traits::get(v, d) - next));
+			}
+		}
+
+		template<typename V>
+		void statistics<V>::merge(const statistics<V>& other)
+		{
+			typedef Internal::elementTraits<V> traits;
+			typedef typename traits::scalar T;
+
+			Internal::reduceMoments<T, traits::Dimension, false> a, b;
+			a.n = m_count;
+			b.n = other.m_count;
+			for(int d = 0; d < traits::Dimension; d++)
+			{
+				a.mean[d] = traits::get(m_mean, d);
+				a.m[d][d] = traits::get(m_m2, d);
+				b.mean[d] = traits::get(other.m_mean, d);
+				b.m[d][d] = traits::get(other.m_m2, d);
+			}
+			a.merge(b);
+
+			m_count = a.n;
+			for(int d = 0; d < traits::Dimension; d++)
+			{
+				traits::set(m_mean, d, a.mean[d]);
+				traits::set(m_m2, d, a.m[d][d]);
+			}
+		}
+
+		template<typename V>
+		size_t statistics<V>::count() const
+		{
+			return m_count;
+		}
+
+		template<typename V>
+		V statistics<V>::mean() const
+		{
+			return m_mean;
+		}
+
+		template<typename V>
+		V statistics<V>::m2() const
+		{
+			return m_m2;
+		}
+
+		template<typename V>
+		V statistics<V>::variance() const
+		{
+			typedef Internal::elementTraits<V> traits;
+			V r = V();
+			if(m_count > 0)
+				for(int d = 0; d < traits::Dimension; d++)
+					traits::set(r, d, traits::get(m_m2, d) / m_count);
+			return r;
+		}
+
+		template<typename V>
+		V statistics<V>::sampleVariance() const
+		{
+			typedef Internal::elementTraits<V> traits;
+			V r = V();
+			if(m_count > 1)
+				for(int d = 0; d < traits::Dimension; d++)
+					traits::set(r, d, traits::get(m_m2, d) / (m_count - 1));
+			return r;
+		}
+
+		template<typename V>
+		V statistics<V>::deviation() const
+		{
+			typedef Internal::elementTraits<V> traits;
+			V r = variance();
+			for(int d = 0; d < traits::Dimension; d++)
+				traits::set(r, d, std::sqrt(traits::get(r, d)));
+			return r;
+		}
+
+		template<typename V>
+		V sum(const V* values, size_t count, SumMethod method)
+		{
+			typedef Internal::elementTraits<V> traits;
+			typedef typename traits::scalar T;
+			const int D = traits::Dimension;
+
+			const size_t chunks = parallelChunkCount(count, Internal::ReduceGrain);
+			std::vector<T> partial(chunks * D), compensation(chunks * D);
+			parallelFor(count, Internal::ReduceGrain, [&](size_t begin, size_t end, size_t chunk) {
+				T* out = &partial[chunk * D];
+				if(method == KahanSum)
+					Internal::reduceKahanSum(values + begin, end - begin, out, &compensation[chunk * D]);
+				else if(method == PairwiseSum)
+					Internal::reducePairwiseSum(values + begin, end - begin, out);
+				else
+					Internal::reduceLaneSum(values + begin, end - begin, out);
+			});
+
+			T total[D];
+			for(int d = 0; d < D; d++)
+			{
+				T s = 0, c = 0;
+				for(size_t k = 0; k < chunks; k++)
+				{
+					const T x = partial[k * D + d];
+					const T t = s + x;
+					if(method == KahanSum)
+					{
+						c += std::abs(s) >= std::abs(x) ? (s - t) + x : (x - t) + s;
+						c -= compensation[k * D + d];
+					}
+					s = t;
+				}
+				total[d] = s + c;
+			}
+			return Internal::reduceMake<V>(total);
+		}
+
+		template<typename V>
+		void minMax(const V* values, size_t count, V& lo, V& hi)
+		{
+			typedef Internal::elementTraits<V> traits;
+			typedef typename traits::scalar T;
+			const int D = traits::Dimension;
+
+			const size_t chunks = parallelChunkCount(count, Internal::ReduceGrain);
+			std::vector<T> mn(chunks * D), mx(chunks * D);
+			parallelFor(count, Internal::ReduceGrain, [&](size_t begin, size_t end, size_t chunk) {
+				Internal::reduceMinMax(values + begin, end - begin, &mn[chunk * D], &mx[chunk * D]);
+			});
+
+			T l[D], h[D];
+			for(int d = 0; d < D; d++)
+			{
+				l[d] = mn[d];
+				h[d] = mx[d];
+				for(size_t k = 1; k < chunks; k++)
+				{
+					l[d] = mn[k * D + d] < l[d] ? mn[k * D + d] : l[d];
+					h[d] = mx[k * D + d] > h[d] ? mx[k * D + d] : h[d];
+				}
+			}
+			lo = Internal::reduceMake<V>(l);
+			hi = Internal::reduceMake<V>(h);
+		}
+
+		template<typename V>
+		V minimum(const V* values, size_t count)
+		{
+			V lo, hi;
+			minMax(values, count, lo, hi);
+			return lo;
+		}
+
+		template<typename V>
+		V maximum(const V* values, size_t count)
+		{
+			V lo, hi;
+			minMax(values, count, lo, hi);
+			return hi;
+		}
+
+		template<typename T>
+		size_t argmin(const T* values, size_t count)
+		{
+			static_assert(std::is_arithmetic<T>::value, "argmin needs scalar values");
+			return Internal::reduceArg(values, count, Internal::reduceBounds<T>::highest(),
+				[](const T& a, const T& b) { return a < b; });
+		}
+
+		template<typename T>
+		size_t argmax(const T* values, size_t count)
+		{
+			static_assert(std::is_arithmetic<T>::value, "argmax needs scalar values");
+			return Internal::reduceArg(values, count, Internal::reduceBounds<T>::lowest(),
+				[](const T& a, const T& b) { return a > b; });
+		}
+
+		template<typename V>
+		statistics<V> computeStatistics(const V* values, size_t count)
+		{
+			typedef Internal::elementTraits<V> traits;
+			typedef typename traits::scalar T;
+
+			const Internal::reduceMoments<T, traits::Dimension, false> r = Internal::reduceComputeMoments<false>(values, count);
+			T m2[traits::Dimension];
+			for(int d = 0; d < traits::Dimension; d++)
+				m2[d] = r.m[d][d];
+			return statistics<V>(r.n, Internal::reduceMake<V>(r.mean), Internal::reduceMake<V>(m2));
+		}
+
+		template<typename V>
+		V centroid(const V* points, size_t count)
+		{
+			typedef Internal::elementTraits<V> traits;
+			typedef typename traits::scalar T;
+
+			V c = sum(points, count, PairwiseSum);
+			if(count > 0)
+				for(int d = 0; d < traits::Dimension; d++)
+					traits::set(c, d, traits::get(c, d) / T(count));
+			return c;
+		}
+
+		template<typename T>
+		vec3<T> centroid(const vec3SoA<const T>& points)
+		{
+			if(points.size == 0)
+				return vec3<T>();
+			const T n = T(points.size);
+			return vec3<T>(sum(points.x, points.size) / n, sum(points.y, points.size) / n, sum(points.z, points.size) / n);
+		}
+
+		template<typename V>
+		mat<typename vecTraits<V>::scalar, vecTraits<V>::Dimension, vecTraits<V>::Dimension> covariance(const V* points, size_t count)
+		{
+			typedef vecTraits<V> traits;
+			typedef typename traits::scalar T;
+			const int D = traits::Dimension;
+
+			const Internal::reduceMoments<T, D, true> r = Internal::reduceComputeMoments<true>(points, count);
+			mat<T, D, D> result;
+			if(count > 0)
+				for(int i = 0; i < D; i++)
+					for(int j = i; j < D; j++)
+						result.matrix[i][j] = result.matrix[j][i] = r.m[i][j] / T(count);
+			return result;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_REDUCTION_H
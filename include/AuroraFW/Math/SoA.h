@@ -0,0 +1,96 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/SoA.h
+ * Structure of arrays header. This contains lightweight views over
+ * coordinates stored in separate arrays, used by the batch kernels.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_SOA_H
+#define AURORAFW_MATH_SOA_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <cstddef>
+
+/**
+ * Marks a loop over SoA arrays as free of loop-carried dependencies so
+ * the compiler vectorizes it. Batch kernels are written branch-free on
+ * top of this instead of using target specific intrinsics.
+ * @since snapshot20261019
+ */
+#if defined(__clang__)
+	#define AFW_MATH_SIMD_LOOP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+	#define AFW_MATH_SIMD_LOOP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+	#define AFW_MATH_SIMD_LOOP __pragma(loop(ivdep))
+#else
+	#define AFW_MATH_SIMD_LOOP
+#endif
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A view over 2D coordinates stored as two separate arrays.
+		 * Use a const T to describe read-only input.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API vec2SoA {
+			T* x;
+			T* y;
+			size_t size;
+		};
+
+		/**
+		 * A view over 3D coordinates stored as three separate arrays.
+		 * Use a const T to describe read-only input.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API vec3SoA {
+			T* x;
+			T* y;
+			T* z;
+			size_t size;
+		};
+
+		/**
+		 * A view over 4D coordinates stored as four separate arrays.
+		 * Use a const T to describe read-only input.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		struct AFW_API vec4SoA {
+			T* x;
+			T* y;
+			T* z;
+			T* w;
+			size_t size;
+		};
+	}
+}
+
+#endif // AURORAFW_MATH_SOA_H
@@ -0,0 +1,796 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/SpaceFillingCurve.h
+ * Space filling curve header. This contains Morton and Hilbert curve
+ * encoders for 2D and 3D points and a parallel radix sort to reorder
+ * points along a curve, so that points close in space end up close
+ * in memory.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_SPACEFILLINGCURVE_H
+#define AURORAFW_MATH_SPACEFILLINGCURVE_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/AABB.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if defined(__BMI2__)
+	#include <immintrin.h>
+#endif
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * The curves spatialSort() can order points along.
+		 * @since snapshot20261019
+		 */
+		enum CurveType {
+			MortonCurve,
+			HilbertCurve
+		};
+
+		/**
+		 * How many bits per axis the point encoders quantize 2D points to.
+		 * 24 bits is the precision of a float, so keys take 48 bits.
+		 * @since snapshot20261019
+		 */
+		constexpr int CurveBits2D = 24;
+
+		/**
+		 * How many bits per axis the point encoders quantize 3D points to,
+		 * so keys take 63 bits.
+		 * @since snapshot20261019
+		 */
+		constexpr int CurveBits3D = 21;
+
+		/**
+		 * Interleaves the bits of two coordinates, x in the lowest bit.
+		 * Uses the BMI2 pdep instruction when the target has it.
+		 * @param x The x coordinate.
+		 * @param y The y coordinate.
+		 * @return The Morton code.
+		 * @see mortonDecode()
+		 * @since snapshot20261019
+		 */
+		AFW_API inline uint64_t mortonEncode(uint32_t x, uint32_t y);
+
+		/**
+		 * Interleaves the bits of three coordinates, x in the lowest bit.
+		 * Only the low 21 bits of each coordinate are used.
+		 * Uses the BMI2 pdep instruction when the target has it.
+		 * @param x The x coordinate.
+		 * @param y The y coordinate.
+		 * @param z The z coordinate.
+		 * @return The Morton code.
+		 * @see mortonDecode()
+		 * @since snapshot20261019
+		 */
+		AFW_API inline uint64_t mortonEncode(uint32_t x, uint32_t y, uint32_t z);
+
+		/**
+		 * Splits a 2D Morton code back into its coordinates.
+		 * @see mortonEncode(uint32_t , uint32_t )
+		 * @since snapshot20261019
+		 */
+		AFW_API inline void mortonDecode(uint64_t code, uint32_t& x, uint32_t& y);
+
+		/**
+		 * Splits a 3D Morton code back into its coordinates.
+		 * @see mortonEncode(uint32_t , uint32_t , uint32_t )
+		 * @since snapshot20261019
+		 */
+		AFW_API inline void mortonDecode(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z);
+
+		/**
+		 * Returns the distance along the 2D Hilbert curve of the given cell.
+		 * Unlike Morton order, consecutive codes are always neighbouring cells.
+		 * @param x The x coordinate.
+		 * @param y The y coordinate.
+		 * @return The Hilbert code.
+		 * @see hilbertDecode()
+		 * @since snapshot20261019
+		 */
+		AFW_API inline uint64_t hilbertEncode(uint32_t x, uint32_t y);
+
+		/**
+		 * Returns the distance along the 3D Hilbert curve of the given cell.
+		 * Only the low 21 bits of each coordinate are used.
+		 * @param x The x coordinate.
+		 * @param y The y coordinate.
+		 * @param z The z coordinate.
+		 * @return The Hilbert code.
+		 * @see hilbertDecode()
+		 * @since snapshot20261019
+		 */
+		AFW_API inline uint64_t hilbertEncode(uint32_t x, uint32_t y, uint32_t z);
+
+		/**
+		 * Returns the cell at the given distance along the 2D Hilbert curve.
+		 * @see hilbertEncode(uint32_t , uint32_t )
+		 * @since snapshot20261019
+		 */
+		AFW_API inline void hilbertDecode(uint64_t code, uint32_t& x, uint32_t& y);
+
+		/**
+		 * Returns the cell at the given distance along the 3D Hilbert curve.
+		 * @see hilbertEncode(uint32_t , uint32_t , uint32_t )
+		 * @since snapshot20261019
+		 */
+		AFW_API inline void hilbertDecode(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z);
+
+		/**
+		 * Returns the Morton code of a point inside the given box, quantized
+		 * to CurveBits3D bits per axis. Points outside are clamped to it.
+		 * @param p The point.
+		 * @param bounds The box the codes are relative to.
+		 * @return The Morton code.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		uint64_t mortonCode(const vec3<T>& p, const aabb<T>& bounds);
+
+		/**
+		 * Returns the Morton code of a point inside the given rectangle,
+		 * quantized to CurveBits2D bits per axis. Points outside are clamped to it.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		uint64_t mortonCode(const vec2<T>& p, const vec2<T>& min, const vec2<T>& max);
+
+		/**
+		 * Returns the Hilbert code of a point inside the given box, quantized
+		 * to CurveBits3D bits per axis. Points outside are clamped to it.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		uint64_t hilbertCode(const vec3<T>& p, const aabb<T>& bounds);
+
+		/**
+		 * Returns the Hilbert code of a point inside the given rectangle,
+		 * quantized to CurveBits2D bits per axis. Points outside are clamped to it.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		uint64_t hilbertCode(const vec2<T>& p, const vec2<T>& min, const vec2<T>& max);
+
+		/**
+		 * Computes the Morton codes of many points, as mortonCode() does.
+		 * Large batches are split across threads.
+		 * @param points The points, as a structure of arrays.
+		 * @param bounds The box the codes are relative to.
+		 * @param codes Receives one code per point.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void mortonCodes(const vec3SoA<const T>& points, const aabb<T>& bounds, uint64_t* codes);
+
+		/**
+		 * Computes the Morton codes of many 2D points, as mortonCode() does.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void mortonCodes(const vec2SoA<const T>& points, const vec2<T>& min, const vec2<T>& max, uint64_t* codes);
+
+		/**
+		 * Computes the Hilbert codes of many points, as hilbertCode() does.
+		 * Large batches are split across threads.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void hilbertCodes(const vec3SoA<const T>& points, const aabb<T>& bounds, uint64_t* codes);
+
+		/**
+		 * Computes the Hilbert codes of many 2D points, as hilbertCode() does.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void hilbertCodes(const vec2SoA<const T>& points, const vec2<T>& min, const vec2<T>& max, uint64_t* codes);
+
+		/**
+		 * Sorts keys in ascending order, moving values along with them.
+		 * This is a stable least significant digit radix sort, 8 bits per
+		 * pass, with the histogram and scatter of each pass split across
+		 * threads. Passes where all keys share the same digit are skipped.
+		 * @param keys The keys to sort.
+		 * @param values The values to move with the keys. May be <code>nullptr</code>.
+		 * @param count The number of keys.
+		 * @param keyBits How many low bits the keys use. Passes above it are skipped.
+		 * @since snapshot20261019
+		 */
+		AFW_API inline void radixSort(uint64_t* keys, uint32_t* values, size_t count, int keyBits = 64);
+
+		/**
+		 * Gathers a buffer into a new order, so that out[i] is in[order[i]].
+		 * Large buffers are split across threads.
+		 * @param order The new order, as indices into in.
+		 * @param in The buffer to reorder.
+		 * @param out Receives the reordered buffer. Must not overlap in.
+		 * @param count The number of elements.
+		 * @see spatialSort()
+		 * @since snapshot20261019
+		 */
+		template<typename U>
+		void reorder(const uint32_t* order, const U* in, U* out, size_t count);
+
+		/**
+		 * Sorts points in place along a space filling curve over their
+		 * bounds. Use the returned order with reorder() to sort any
+		 * per-point payload the same way.
+		 * @param points The points to sort.
+		 * @param order Receives, for each sorted point, its index before
+		 * sorting. May be <code>nullptr</code>.
+		 * @param curve The curve to sort along.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void spatialSort(const vec3SoA<T>& points, uint32_t* order, CurveType curve = MortonCurve);
+
+		/**
+		 * Sorts 2D points in place along a space filling curve over their bounds.
+		 * @see spatialSort(const vec3SoA<T>& , uint32_t* , CurveType )
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		void spatialSort(const vec2SoA<T>& points, uint32_t* order, CurveType curve = MortonCurve);
+
+		namespace Internal {
+			constexpr size_t CurveGrain = 1 << 16;
+			constexpr size_t RadixSortGrain = 1 << 16;
+
+			// Portable bit interleaving. The batch encoders use these even
+			// when BMI2 is available, since they vectorize and pdep does not.
+			inline uint64_t mortonSpread2(uint64_t v)
+			{
+				v &= 0xFFFFFFFFull;
+				v = (v | (v << 16)) & 0x0000FFFF0000FFFFull;
+				v = (v | (v << 8)) & 0x00FF00FF00FF00FFull;
+				v = (v | (v << 4)) & 0x0F0F0F0F0F0F0F0Full;
+				v = (v | (v << 2)) & 0x3333333333333333ull;
+				v = (v | (v << 1)) & 0x5555555555555555ull;
+				return v;
+			}
+
+			inline uint32_t mortonCompact2(uint64_t v)
+			{
+				v &= 0x5555555555555555ull;
+				v = (v | (v >> 1)) & 0x3333333333333333ull;
+				v = (v | (v >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+				v = (v | (v >> 4)) & 0x00FF00FF00FF00FFull;
+				v = (v | (v >> 8)) & 0x0000FFFF0000FFFFull;
+				v = (v | (v >> 16)) & 0x00000000FFFFFFFFull;
+				return uint32_t(v);
+			}
+
+			inline uint64_t mortonSpread3(uint64_t v)
+			{
+				v &= 0x1FFFFFull;
+				v = (v | (v << 32)) & 0x001F00000000FFFFull;
+				v = (v | (v << 16)) & 0x001F0000FF0000FFull;
+				v = (v | (v << 8)) & 0x100F00F00F00F00Full;
+				v = (v | (v << 4)) & 0x10C30C30C30C30C3ull;
+				v = (v | (v << 2)) & 0x1249249249249249ull;
+				return v;
+			}
+
+			inline uint32_t mortonCompact3(uint64_t v)
+			{
+				v &= 0x1249249249249249ull;
+				v = (v | (v >> 2)) & 0x10C30C30C30C30C3ull;
+				v = (v | (v >> 4)) & 0x100F00F00F00F00Full;
+				v = (v | (v >> 8)) & 0x001F0000FF0000FFull;
+				v = (v | (v >> 16)) & 0x001F00000000FFFFull;
+				v = (v | (v >> 32)) & 0x00000000001FFFFFull;
+				return uint32_t(v);
+			}
+
+			// Skilling's transform from axes to the transposed Hilbert index,
+			// on 21 bit coordinates. The result is read by interleaving the
+			// bits with the first axis as the most significant.
+			inline void hilbertAxesToTranspose(uint32_t (&x)[3])
+			{
+				const uint32_t m = 1u << (CurveBits3D - 1);
+				for(uint32_t q = m; q > 1; q >>= 1)
+				{
+					const uint32_t p = q - 1;
+					for(int i = 0; i < 3; i++)
+					{
+						if(x[i] & q)
+							x[0] ^= p;
+						else
+						{
+							const uint32_t t = (x[0] ^ x[i]) & p;
+							x[0] ^= t;
+							x[i] ^= t;
+						}
+					}
+				}
+
+				x[1] ^= x[0];
+				x[2] ^= x[1];
+				uint32_t t = 0;
+				for(uint32_t q = m; q > 1; q >>= 1)
+					if(x[2] & q)
+						t ^= q - 1;
+				for(int i = 0; i < 3; i++)
+					x[i] ^= t;
+			}
+
+			inline void hilbertTransposeToAxes(uint32_t (&x)[3])
+			{
+				const uint32_t n = 1u << CurveBits3D;
+				uint32_t t = x[2] >> 1;
+				x[2] ^= x[1];
+				x[1] ^= x[0];
+				x[0] ^= t;
+
+				for(uint32_t q = 2; q != n; q <<= 1)
+				{
+					const uint32_t p = q - 1;
+					for(int i = 2; i >= 0; i--)
+					{
+						if(x[i] & q)
+							x[0] ^= p;
+						else
+						{
+							t = (x[0] ^ x[i]) & p;
+							x[0] ^= t;
+							x[i] ^= t;
+						}
+					}
+				}
+			}
+
+			// Scale that maps [min, max] onto [0, 2^bits - 1].
+			template<typename T>
+			inline T curveScale(T min, T max, int bits)
+			{
+				const T extent = max - min;
+				return extent > 0 ? T((1u << bits) - 1) / extent : T(0);
+			}
+
+			template<typename T>
+			inline uint32_t curveQuantize(T v, T min, T scale, int bits)
+			{
+				T q = (v - min) * scale;
+				q = q > 0 ? q : T(0);
+				q = q < T((1u << bits) - 1) ? q : T((1u << bits) - 1);
+				return uint32_t(q);
+			}
+
+			template<typename T>
+			void curveCodes(const vec3SoA<const T>& points, const aabb<T>& bounds, uint64_t* codes, CurveType curve)
+			{
+				const T minX = bounds.min.x, minY = bounds.min.y, minZ = bounds.min.z;
+				const T scaleX = curveScale(bounds.min.x, bounds.max.x, CurveBits3D);
+				const T scaleY = curveScale(bounds.min.y, bounds.max.y, CurveBits3D);
+				const T scaleZ = curveScale(bounds.min.z, bounds.max.z, CurveBits3D);
+
+				parallelFor(points.size, CurveGrain, [&](size_t begin, size_t end, size_t) {
+					if(curve == MortonCurve)
+					{
+						AFW_MATH_SIMD_LOOP
+						for(size_t i = begin; i < end; i++)
+							codes[i] = mortonSpread3(curveQuantize(points.x[i], minX, scaleX, CurveBits3D))
+								| (mortonSpread3(curveQuantize(points.y[i], minY, scaleY, CurveBits3D)) << 1)
+								| (mortonSpread3(curveQuantize(points.z[i], minZ, scaleZ, CurveBits3D)) << 2);
+					}
+					else
+					{
+						for(size_t i = begin; i < end; i++)
+							codes[i] = hilbertEncode(curveQuantize(points.x[i], minX, scaleX, CurveBits3D),
+								curveQuantize(points.y[i], minY, scaleY, CurveBits3D),
+								curveQuantize(points.z[i], minZ, scaleZ, CurveBits3D));
+					}
+				});
+			}
+
+			template<typename T>
+			void curveCodes(const vec2SoA<const T>& points, const vec2<T>& min, const vec2<T>& max, uint64_t* codes, CurveType curve)
+			{
+				const T minX = min.x, minY = min.y;
+				const T scaleX = curveScale(min.x, max.x, CurveBits2D);
+				const T scaleY = curveScale(min.y, max.y, CurveBits2D);
+
+				parallelFor(points.size, CurveGrain, [&](size_t begin, size_t end, size_t) {
+					if(curve == MortonCurve)
+					{
+						AFW_MATH_SIMD_LOOP
+						for(size_t i = begin; i < end; i++)
+							codes[i] = mortonSpread2(curveQuantize(points.x[i], minX, scaleX, CurveBits2D))
+								| (mortonSpread2(curveQuantize(points.y[i], minY, scaleY, CurveBits2D)) << 1);
+					}
+					else
+					{
+						for(size_t i = begin; i < end; i++)
+							codes[i] = hilbertEncode(curveQuantize(points.x[i], minX, scaleX, CurveBits2D),
+								curveQuantize(points.y[i], minY, scaleY, CurveBits2D));
+					}
+				});
+			}
+
+			// Per-chunk bounds of a coordinate array, merged serially.
+			template<typename T>
+			void coordinateBounds(const T* v, size_t count, T& min, T& max)
+			{
+				const size_t chunks = parallelChunkCount(count, CurveGrain);
+				std::vector<T> mins(chunks, std::numeric_limits<T>::max());
+				std::vector<T> maxs(chunks, std::numeric_limits<T>::lowest());
+				parallelFor(count, CurveGrain, [&](size_t begin, size_t end, size_t chunk) {
+					T lo = mins[chunk], hi = maxs[chunk];
+					AFW_MATH_SIMD_LOOP
+					for(size_t i = begin; i < end; i++)
+					{
+						lo = v[i] < lo ? v[i] : lo;
+						hi = v[i] > hi ? v[i] : hi;
+					}
+					mins[chunk] = lo;
+					maxs[chunk] = hi;
+				});
+				min = *std::min_element(mins.begin(), mins.end());
+				max = *std::max_element(maxs.begin(), maxs.end());
+			}
+
+			// Sorts codes and reorders every coordinate array in place.
+			template<typename T>
+			void sortByCodes(std::vector<uint64_t>& codes, int keyBits, T* const* axes, int axisCount, size_t count, uint32_t* order)
+			{
+				std::vector<uint32_t> ownOrder;
+				if(order == nullptr)
+				{
+					ownOrder.resize(count);
+					order = ownOrder.data();
+				}
+				for(size_t i = 0; i < count; i++)
+					order[i] = uint32_t(i);
+
+				radixSort(codes.data(), order, count, keyBits);
+
+				std::vector<T> sorted(count);
+				for(int axis = 0; axis < axisCount; axis++)
+				{
+					reorder(order, axes[axis], sorted.data(), count);
+					std::copy(sorted.begin(), sorted.end(), axes[axis]);
+				}
+			}
+		}
+
+		// Inline definitions
+		AFW_API inline uint64_t mortonEncode(uint32_t x, uint32_t y)
+		{
+#if defined(__BMI2__)
+			return _pdep_u64(x, 0x5555555555555555ull) | _pdep_u64(y, 0xAAAAAAAAAAAAAAAAull);
+#else
+			return Internal::mortonSpread2(x) | (Internal::mortonSpread2(y) << 1);
+#endif
+		}
+
+		AFW_API inline uint64_t mortonEncode(uint32_t x, uint32_t y, uint32_t z)
+		{
+#if defined(__BMI2__)
+			return _pdep_u64(x, 0x1249249249249249ull) | _pdep_u64(y, 0x2492492492492492ull)
+				| _pdep_u64(z, 0x4924924924924924ull);
+#else
+			return Internal::mortonSpread3(x) | (Internal::mortonSpread3(y) << 1) | (Internal::mortonSpread3(z) << 2);
+#endif
+		}
+
+		AFW_API inline void mortonDecode(uint64_t code, uint32_t& x, uint32_t& y)
+		{
+#if defined(__BMI2__)
+			x = uint32_t(_pext_u64(code, 0x5555555555555555ull));
+			y = uint32_t(_pext_u64(code, 0xAAAAAAAAAAAAAAAAull));
+#else
+			x = Internal::mortonCompact2(code);
+			y = Internal::mortonCompact2(code >> 1);
+#endif
+		}
+
+		AFW_API inline void mortonDecode(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z)
+		{
+#if defined(__BMI2__)
+			x = uint32_t(_pext_u64(code, 0x1249249249249249ull));
+			y = uint32_t(_pext_u64(code, 0x2492492492492492ull));
+			z = uint32_t(_pext_u64(code, 0x4924924924924924ull));
+#else
+			x = Internal::mortonCompact3(code);
+			y = Internal::mortonCompact3(code >> 1);
+			z = Internal::mortonCompact3(code >> 2);
+#endif
+		}
+
+		AFW_API inline uint64_t hilbertEncode(uint32_t x, uint32_t y)
+		{
+			uint64_t code = 0;
+			for(uint32_t s = 1u << 31; s > 0; s >>= 1)
+			{
+				const uint32_t rx = (x & s) ? 1 : 0;
+				const uint32_t ry = (y & s) ? 1 : 0;
+				code += uint64_t(s) * s * ((3 * rx) ^ ry);
+
+				// Rotate the quadrant so the sub-curve starts where the curve enters it.
+				if(ry == 0)
+				{
+					if(rx == 1)
+					{
+						x = ~x;
+						y = ~y;
+					}
+					std::swap(x, y);
+				}
+			}
+			return code;
+		}
+
+		AFW_API inline uint64_t hilbertEncode(uint32_t x, uint32_t y, uint32_t z)
+		{
+			uint32_t axes[3] = { z & 0x1FFFFF, y & 0x1FFFFF, x & 0x1FFFFF };
+			Internal::hilbertAxesToTranspose(axes);
+			return mortonEncode(axes[2], axes[1], axes[0]);
+		}
+
+		AFW_API inline void hilbertDecode(uint64_t code, uint32_t& x, uint32_t& y)
+		{
+			x = y = 0;
+			for(uint64_t s = 1; s < (uint64_t(1) << 32); s <<= 1)
+			{
+				const uint32_t rx = uint32_t(1 & (code >> 1));
+				const uint32_t ry = uint32_t(1 & (code ^ rx));
+				if(ry == 0)
+				{
+					if(rx == 1)
+					{
+						x = uint32_t(s - 1) - x;
+						y = uint32_t(s - 1) - y;
+					}
+					std::swap(x, y);
+				}
+				x += uint32_t(s) * rx;
+				y += uint32_t(s) * ry;
+				code >>= 2;
+			}
+		}
+
+		AFW_API inline void hilbertDecode(uint64_t code, uint32_t& x, uint32_t& y, uint32_t& z)
+		{
+			uint32_t axes[3];
+			mortonDecode(code, axes[2], axes[1], axes[0]);
+			Internal::hilbertTransposeToAxes(axes);
+			x = axes[2];
+			y = axes[1];
+			z = axes[0];
+		}
+
+		AFW_API inline void radixSort(uint64_t* keys, uint32_t* values, size_t count, int keyBits)
+		{
+			if(count < 2)
+				return;
+
+			std::vector<uint64_t> keyBuffer(count);
+			std::vector<uint32_t> valueBuffer(values != nullptr ? count : 0);
+			uint64_t* srcKeys = keys;
+			uint64_t* dstKeys = keyBuffer.data();
+			uint32_t* srcValues = values;
+			uint32_t* dstValues = valueBuffer.data();
+
+			// Build the histograms of every pass in one read over the keys.
+			// Their totals tell which passes can be skipped. With a single
+			// chunk they are also the final counts; otherwise keys move
+			// between chunks and each pass recounts its own digit.
+			const int passes = keyBits < 64 ? (keyBits + 7) / 8 : 8;
+			const size_t chunks = parallelChunkCount(count, Internal::RadixSortGrain);
+			std::vector<size_t> offsets(chunks * passes * 256);
+			parallelFor(count, Internal::RadixSortGrain, [&](size_t begin, size_t end, size_t chunk) {
+				size_t* histogram = &offsets[chunk * passes * 256];
+				for(size_t i = begin; i < end; i++)
+				{
+					uint64_t key = keys[i];
+					for(int pass = 0; pass < passes; pass++, key >>= 8)
+						histogram[pass * 256 + (key & 0xFF)]++;
+				}
+			});
+
+			for(int pass = 0; pass < passes; pass++)
+			{
+				const int shift = pass * 8;
+				// Gather the totals of this pass and skip it if every key has
+				// the same digit.
+				size_t totals[256] = {};
+				bool trivial = false;
+				for(size_t digit = 0; digit < 256; digit++)
+				{
+					for(size_t chunk = 0; chunk < chunks; chunk++)
+						totals[digit] += offsets[(chunk * passes + pass) * 256 + digit];
+					if(totals[digit] == count)
+						trivial = true;
+				}
+				if(trivial)
+					continue;
+
+				if(chunks > 1)
+				{
+					parallelFor(count, Internal::RadixSortGrain, [&](size_t begin, size_t end, size_t chunk) {
+						size_t* histogram = &offsets[(chunk * passes + pass) * 256];
+						std::fill(histogram, histogram + 256, size_t(0));
+						for(size_t i = begin; i < end; i++)
+							histogram[(srcKeys[i] >> shift) & 0xFF]++;
+					});
+				}
+
+				// Turn the histograms into scatter offsets, digit major and
+				// chunk minor, so each chunk writes its keys in input order.
+				size_t sum = 0;
+				for(size_t digit = 0; digit < 256; digit++)
+				{
+					for(size_t chunk = 0; chunk < chunks; chunk++)
+					{
+						size_t& offset = offsets[(chunk * passes + pass) * 256 + digit];
+						const size_t n = offset;
+						offset = sum;
+						sum += n;
+					}
+				}
+
+				parallelFor(count, Internal::RadixSortGrain, [&](size_t begin, size_t end, size_t chunk) {
+					size_t* offset = &offsets[(chunk * passes + pass) * 256];
+					if(srcValues != nullptr)
+					{
+						for(size_t i = begin; i < end; i++)
+						{
+							const size_t pos = offset[(srcKeys[i] >> shift) & 0xFF]++;
+							dstKeys[pos] = srcKeys[i];
+							dstValues[pos] = srcValues[i];
+						}
+					}
+					else
+					{
+						for(size_t i = begin; i < end; i++)
+							dstKeys[offset[(srcKeys[i] >> shift) & 0xFF]++] = srcKeys[i];
+					}
+				});
+
+				std::swap(srcKeys, dstKeys);
+				std::swap(srcValues, dstValues);
+			}
+
+			if(srcKeys != keys)
+			{
+				std::memcpy(keys, srcKeys, count * sizeof(uint64_t));
+				if(values != nullptr)
+					std::memcpy(values, srcValues, count * sizeof(uint32_t));
+			}
+		}
+
+		// Template implementation
+		template<typename T>
+		uint64_t mortonCode(const vec3<T>& p, const aabb<T>& bounds)
+		{
+			return mortonEncode(
+				Internal::curveQuantize(p.x, bounds.min.x, Internal::curveScale(bounds.min.x, bounds.max.x, CurveBits3D), CurveBits3D),
+				Internal::curveQuantize(p.y, bounds.min.y, Internal::curveScale(bounds.min.y, bounds.max.y, CurveBits3D), CurveBits3D),
+				Internal::curveQuantize(p.z, bounds.min.z, Internal::curveScale(bounds.min.z, bounds.max.z, CurveBits3D), CurveBits3D));
+		}
+
+		template<typename T>
+		uint64_t mortonCode(const vec2<T>& p, const vec2<T>& min, const vec2<T>& max)
+		{
+			return mortonEncode(
+				Internal::curveQuantize(p.x, min.x, Internal::curveScale(min.x, max.x, CurveBits2D), CurveBits2D),
+				Internal::curveQuantize(p.y, min.y, Internal::curveScale(min.y, max.y, CurveBits2D), CurveBits2D));
+		}
+
+		template<typename T>
+		uint64_t hilbertCode(const vec3<T>& p, const aabb<T>& bounds)
+		{
+			return hilbertEncode(
+				Internal::curveQuantize(p.x, bounds.min.x, Internal::curveScale(bounds.min.x, bounds.max.x, CurveBits3D), CurveBits3D),
+				Internal::curveQuantize(p.y, bounds.min.y, Internal::curveScale(bounds.min.y, bounds.max.y, CurveBits3D), CurveBits3D),
+				Internal::curveQuantize(p.z, bounds.min.z, Internal::curveScale(bounds.min.z, bounds.max.z, CurveBits3D), CurveBits3D));
+		}
+
+		template<typename T>
+		uint64_t hilbertCode(const vec2<T>& p, const vec2<T>& min, const vec2<T>& max)
+		{
+			return hilbertEncode(
+				Internal::curveQuantize(p.x, min.x, Internal::curveScale(min.x, max.x, CurveBits2D), CurveBits2D),
+				Internal::curveQuantize(p.y, min.y, Internal::curveScale(min.y, max.y, CurveBits2D), CurveBits2D));
+		}
+
+		template<typename T>
+		void mortonCodes(const vec3SoA<const T>& points, const aabb<T>& bounds, uint64_t* codes)
+		{
+			Internal::curveCodes(points, bounds, codes, MortonCurve);
+		}
+
+		template<typename T>
+		void mortonCodes(const vec2SoA<const T>& points, const vec2<T>& min, const vec2<T>& max, uint64_t* codes)
+		{
+			Internal::curveCodes(points, min, max, codes, MortonCurve);
+		}
+
+		template<typename T>
+		void hilbertCodes(const vec3SoA<const T>& points, const aabb<T>& bounds, uint64_t* codes)
+		{
+			Internal::curveCodes(points, bounds, codes, HilbertCurve);
+		}
+
+		template<typename T>
+		void hilbertCodes(const vec2SoA<const T>& points, const vec2<T>& min, const vec2<T>& max, uint64_t* codes)
+		{
+			Internal::curveCodes(points, min, max, codes, HilbertCurve);
+		}
+
+		template<typename U>
+		void reorder(const uint32_t* order, const U* in, U* out, size_t count)
+		{
+			parallelFor(count, Internal::CurveGrain, [=](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					out[i] = in[order[i]];
+			});
+		}
+
+		template<typename T>
+		void spatialSort(const vec3SoA<T>& points, uint32_t* order, CurveType curve)
+		{
+			const size_t count = points.size;
+			aabb<T> bounds;
+			Internal::coordinateBounds<T>(points.x, count, bounds.min.x, bounds.max.x);
+			Internal::coordinateBounds<T>(points.y, count, bounds.min.y, bounds.max.y);
+			Internal::coordinateBounds<T>(points.z, count, bounds.min.z, bounds.max.z);
+
+			std::vector<uint64_t> codes(count);
+			Internal::curveCodes(vec3SoA<const T>{ points.x, points.y, points.z, count }, bounds, codes.data(), curve);
+
+			T* const axes[3] = { points.x, points.y, points.z };
+			Internal::sortByCodes(codes, 3 * CurveBits3D, axes, 3, count, order);
+		}
+
+		template<typename T>
+		void spatialSort(const vec2SoA<T>& points, uint32_t* order, CurveType curve)
+		{
+			const size_t count = points.size;
+			vec2<T> min, max;
+			Internal::coordinateBounds<T>(points.x, count, min.x, max.x);
+			Internal::coordinateBounds<T>(points.y, count, min.y, max.y);
+
+			std::vector<uint64_t> codes(count);
+			Internal::curveCodes(vec2SoA<const T>{ points.x, points.y, count }, min, max, codes.data(), curve);
+
+			T* const axes[2] = { points.x, points.y };
+			Internal::sortByCodes(codes, 2 * CurveBits2D, axes, 2, count, order);
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_SPACEFILLINGCURVE_H
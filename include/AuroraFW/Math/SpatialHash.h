@@ -0,0 +1,389 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/SpatialHash.h
+ * Spatial hash header. This contains a hashed uniform grid over 3D
+ * points, rebuilt from scratch every time the points move, with
+ * neighbour queries within a radius.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_SPATIALHASH_H
+#define AURORAFW_MATH_SPATIALHASH_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A uniform grid of cubic cells over 3D points, stored as a hash
+		 * table so the grid is unbounded. build() counting sorts the points
+		 * by cell in a few flat arrays, so a rebuild allocates nothing once
+		 * the point count stops growing.
+		 *
+		 * Points are addressed by their position in cell order. Use order()
+		 * to map them back, or reorder() to sort per-point buffers the same
+		 * way for better locality.
+		 * @since snapshot20261019
+		 */
+		template<typename T>
+		class AFW_API spatialHash {
+		public:
+			/** Constructs an empty grid.
+			 * @param cellSize The edge length of a cell. Queries are fastest
+			 * when the radius is close to it.
+			 * @since snapshot20261019
+			 */
+			explicit spatialHash(T );
+
+			/** Rebuilds the grid over the given points in parallel.
+			 * @param points The points, as a structure of arrays.
+			 * @since snapshot20261019
+			 */
+			void build(const vec3SoA<const T>& );
+
+			/** Rebuilds the grid over the given points in parallel.
+			 * @param points The points.
+			 * @param count The number of points.
+			 * @since snapshot20261019
+			 */
+			void build(const vec3<T>* , size_t );
+
+			/** Calls f(index, distanceSquared) for every point within the
+			 * given radius of p, with index in cell order.
+			 * @param p The query point.
+			 * @param radius The search radius.
+			 * @param f The function to call.
+			 * @since snapshot20261019
+			 */
+			template<typename F>
+			void forEachNeighbor(const vec3<T>& , T , F ) const;
+
+			/** Builds the neighbour list of every point in parallel. The
+			 * neighbours of point i (in cell order) are
+			 * neighbors[offsets[i]] to neighbors[offsets[i + 1] - 1], and
+			 * include i itself.
+			 * @param radius The search radius.
+			 * @param offsets Receives size() + 1 offsets into neighbors.
+			 * @param neighbors Receives the neighbours in cell order.
+			 * @since snapshot20261019
+			 */
+			void neighborLists(T , std::vector<uint32_t>& , std::vector<uint32_t>& ) const;
+
+			/** Copies a per-point buffer into cell order: out[i] = in[order()[i]].
+			 * @param in The buffer in the order given to build().
+			 * @param out Receives the buffer in cell order.
+			 * @since snapshot20261019
+			 */
+			template<typename U>
+			void reorder(const U* , U* ) const;
+
+			/** Returns, for every point in cell order, its index as given to build().
+			 * @since snapshot20261019
+			 */
+			const std::vector<uint32_t>& order() const;
+
+			/** Returns the point at the given index, in cell order.
+			 * @since snapshot20261019
+			 */
+			vec3<T> point(uint32_t ) const;
+
+			/** Returns the number of points in the grid.
+			 * @since snapshot20261019
+			 */
+			size_t size() const;
+
+			/** Returns the edge length of a cell.
+			 * @since snapshot20261019
+			 */
+			T cellSize() const;
+
+		private:
+			int32_t quantize(T ) const;
+			uint32_t hash(int32_t , int32_t , int32_t ) const;
+			template<typename G>
+			void build(size_t , G );
+
+			T m_cellSize;
+			T m_invCellSize;
+			uint32_t m_tableMask;
+			std::vector<uint32_t> m_cellStart;
+			std::vector<uint32_t> m_order;
+			std::vector<uint32_t> m_keys;
+			std::vector<T> m_x, m_y, m_z;
+			std::unique_ptr<std::atomic<uint32_t>[]> m_cursor;
+			size_t m_cursorSize;
+		};
+
+		typedef spatialHash<float> SpatialHash;
+
+		// Inline definitions
+		template<typename T>
+		inline const std::vector<uint32_t>& spatialHash<T>::order() const
+		{
+			return m_order;
+		}
+
+		template<typename T>
+		inline vec3<T> spatialHash<T>::point(uint32_t i) const
+		{
+			return vec3<T>(m_x[i], m_y[i], m_z[i]);
+		}
+
+		template<typename T>
+		inline size_t spatialHash<T>::size() const
+		{
+			return m_order.size();
+		}
+
+		template<typename T>
+		inline T spatialHash<T>::cellSize() const
+		{
+			return m_cellSize;
+		}
+
+		template<typename T>
+		inline int32_t spatialHash<T>::quantize(T v) const
+		{
+			// Converting NaN or a value out of range to int32_t is undefined,
+			// so clamp first: such points all land in the outermost cells.
+			// The bound leaves room for the cell ranges of queries.
+			const T c = std::floor(v * m_invCellSize), limit = T(1 << 30);
+			return static_cast<int32_t>(c > -limit ? (c < limit ? c : limit) : -limit);
+		}
+
+		template<typename T>
+		inline uint32_t spatialHash<T>::hash(int32_t x, int32_t y, int32_t z) const
+		{
+			// Mix every bit of the cell coordinates with the splitmix64
+			// finalizer before masking, so flat or strided point sets spread
+			// over the whole table. Cells sharing a slot are told apart by the
+			// distance test.
+			uint64_t k = (uint64_t(uint32_t(x)) | (uint64_t(uint32_t(y)) << 32)) ^ (uint64_t(uint32_t(z)) * 0x9E3779B97F4A7C15ull);
+			k = (k ^ (k >> 30)) * 0xBF58476D1CE4E5B9ull;
+			k = (k ^ (k >> 27)) * 0x94D049BB133111EBull;
+			return uint32_t(k ^ (k >> 31)) & m_tableMask;
+		}
+
+		// Template implementation
+		template<typename T>
+		spatialHash<T>::spatialHash(T cellSize)
+			: m_cellSize(cellSize), m_invCellSize(1 / cellSize), m_tableMask(0), m_cursorSize(0)
+		{}
+
+		template<typename T>
+		void spatialHash<T>::build(const vec3SoA<const T>& points)
+		{
+			build(points.size, [&points](size_t i) {
+				return vec3<T>(points.x[i], points.y[i], points.z[i]);
+			});
+		}
+
+		template<typename T>
+		void spatialHash<T>::build(const vec3<T>* points, size_t count)
+		{
+			build(count, [points](size_t i) {
+				return points[i];
+			});
+		}
+
+		template<typename T>
+		template<typename G>
+		void spatialHash<T>::build(size_t count, G get)
+		{
+			// About two table slots per point keeps collisions rare.
+			size_t tableSize = 1;
+			while(tableSize < 2 * count)
+				tableSize <<= 1;
+			m_tableMask = static_cast<uint32_t>(tableSize - 1);
+
+			m_keys.resize(count);
+			m_order.resize(count);
+			m_x.resize(count);
+			m_y.resize(count);
+			m_z.resize(count);
+
+			if(m_cursorSize != tableSize)
+			{
+				m_cursor.reset(new std::atomic<uint32_t>[tableSize]);
+				m_cursorSize = tableSize;
+			}
+			std::atomic<uint32_t>* cursor = m_cursor.get();
+			parallelFor(tableSize, 1 << 16, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					cursor[i].store(0, std::memory_order_relaxed);
+			});
+
+			// Counting sort: histogram, exclusive scan, scatter.
+			parallelFor(count, 1 << 14, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					const vec3<T> p = get(i);
+					m_keys[i] = hash(quantize(p.x), quantize(p.y), quantize(p.z));
+					cursor[m_keys[i]].fetch_add(1, std::memory_order_relaxed);
+				}
+			});
+
+			m_cellStart.resize(tableSize + 1);
+			uint32_t sum = 0;
+			for(size_t i = 0; i < tableSize; i++)
+			{
+				m_cellStart[i] = sum;
+				sum += cursor[i].load(std::memory_order_relaxed);
+				cursor[i].store(m_cellStart[i], std::memory_order_relaxed);
+			}
+			m_cellStart[tableSize] = sum;
+
+			parallelFor(count, 1 << 14, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					m_order[cursor[m_keys[i]].fetch_add(1, std::memory_order_relaxed)] = static_cast<uint32_t>(i);
+			});
+
+			// The scatter order inside a cell depends on thread timing; sort
+			// each cell so rebuilds are reproducible, then gather positions.
+			parallelFor(tableSize, 1 << 14, [&](size_t begin, size_t end, size_t) {
+				for(size_t c = begin; c < end; c++)
+				{
+					if(m_cellStart[c + 1] - m_cellStart[c] > 1)
+						std::sort(m_order.begin() + m_cellStart[c], m_order.begin() + m_cellStart[c + 1]);
+				}
+			});
+
+			parallelFor(count, 1 << 14, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					const vec3<T> p = get(m_order[i]);
+					m_x[i] = p.x;
+					m_y[i] = p.y;
+					m_z[i] = p.z;
+				}
+			});
+		}
+
+		template<typename T>
+		template<typename F>
+		void spatialHash<T>::forEachNeighbor(const vec3<T>& p, T radius, F f) const
+		{
+			if(m_order.empty())
+				return;
+
+			const int32_t x0 = quantize(p.x - radius), x1 = quantize(p.x + radius);
+			const int32_t y0 = quantize(p.y - radius), y1 = quantize(p.y + radius);
+			const int32_t z0 = quantize(p.z - radius), z1 = quantize(p.z + radius);
+
+			const T r2 = radius * radius;
+			const size_t tableSize = size_t(m_tableMask) + 1;
+			const size_t rows = size_t(y1 - y0 + 1) * size_t(z1 - z0 + 1);
+			const bool whole = rows >= tableSize || size_t(x1 - x0 + 1) * rows >= tableSize;
+
+			// Different cells may share a table slot: visit every slot once.
+			// A range covering at least as many cells as the table visits
+			// the whole table. Larger ranges than the common 3x3x3 collect
+			// their slots in a per-thread buffer, reused across queries.
+			uint32_t local[27];
+			uint32_t* slots = local;
+			size_t n = 0;
+			if(whole)
+				n = tableSize;
+			else
+			{
+				const size_t cells = size_t(x1 - x0 + 1) * rows;
+				if(cells > 27)
+				{
+					static thread_local std::vector<uint32_t> scratch;
+					if(scratch.size() < cells)
+						scratch.resize(cells);
+					slots = scratch.data();
+				}
+				for(int32_t z = z0; z <= z1; z++)
+					for(int32_t y = y0; y <= y1; y++)
+						for(int32_t x = x0; x <= x1; x++)
+							slots[n++] = hash(x, y, z);
+				std::sort(slots, slots + n);
+				n = static_cast<size_t>(std::unique(slots, slots + n) - slots);
+			}
+
+			for(size_t s = 0; s < n; s++)
+			{
+				const uint32_t slot = whole ? uint32_t(s) : slots[s];
+				for(uint32_t i = m_cellStart[slot]; i < m_cellStart[slot + 1]; i++)
+				{
+					const T dx = m_x[i] - p.x, dy = m_y[i] - p.y, dz = m_z[i] - p.z;
+					const T d2 = dx * dx + dy * dy + dz * dz;
+					if(d2 <= r2)
+						f(i, d2);
+				}
+			}
+		}
+
+		template<typename T>
+		void spatialHash<T>::neighborLists(T radius, std::vector<uint32_t>& offsets, std::vector<uint32_t>& neighbors) const
+		{
+			const size_t count = m_order.size();
+			offsets.assign(count + 1, 0);
+			std::vector<std::vector<uint32_t>> found(parallelChunkCount(count, 1 << 12));
+			parallelFor(count, 1 << 12, [&](size_t begin, size_t end, size_t chunk) {
+				std::vector<uint32_t>& out = found[chunk];
+				for(size_t i = begin; i < end; i++)
+				{
+					const size_t before = out.size();
+					forEachNeighbor(point(static_cast<uint32_t>(i)), radius, [&out](uint32_t j, T) {
+						out.push_back(j);
+					});
+					offsets[i + 1] = static_cast<uint32_t>(out.size() - before);
+				}
+			});
+
+			for(size_t i = 0; i < count; i++)
+				offsets[i + 1] += offsets[i];
+
+			neighbors.clear();
+			neighbors.reserve(offsets[count]);
+			for(const std::vector<uint32_t>& chunk : found)
+				neighbors.insert(neighbors.end(), chunk.begin(), chunk.end());
+		}
+
+		template<typename T>
+		template<typename U>
+		void spatialHash<T>::reorder(const U* in, U* out) const
+		{
+			parallelFor(m_order.size(), 1 << 14, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					out[i] = in[m_order[i]];
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_SPATIALHASH_H
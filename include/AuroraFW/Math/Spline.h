@@ -0,0 +1,954 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Spline.h
+ * Spline header. This contains cubic Bezier, Hermite, Catmull-Rom and
+ * uniform B-spline curves, non-uniform B-splines of any degree and an
+ * arc length table to walk any of them at constant speed.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_SPLINE_H
+#define AURORAFW_MATH_SPLINE_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+#include <AuroraFW/Math/VectorTraits.h>
+#include <AuroraFW/Math/SoA.h>
+#include <AuroraFW/Math/Parallel.h>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * A cubic polynomial curve over [0, 1], stored in power basis as
+		 * c[0] + c[1]*t + c[2]*t^2 + c[3]*t^3 so any evaluation is three
+		 * multiply-adds per coordinate. Works with vec2, vec3 and vec4.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		struct AFW_API cubicSegment {
+			typedef typename vecTraits<V>::scalar T;
+
+			/** The power basis coefficients. */
+			V c[4];
+
+			/** Returns the cubic Bezier curve with the given control points.
+			 * @since snapshot20261019
+			 */
+			static cubicSegment<V> bezier(const V& , const V& , const V& , const V& );
+
+			/** Returns the cubic Hermite curve from p0 to p1 with the tangents m0 and m1.
+			 * @param p0 The start point.
+			 * @param m0 The tangent at the start point.
+			 * @param p1 The end point.
+			 * @param m1 The tangent at the end point.
+			 * @since snapshot20261019
+			 */
+			static cubicSegment<V> hermite(const V& , const V& , const V& , const V& );
+
+			/** Returns the uniform Catmull-Rom curve from p1 to p2, with
+			 * p0 and p3 setting the tangents.
+			 * @since snapshot20261019
+			 */
+			static cubicSegment<V> catmullRom(const V& , const V& , const V& , const V& );
+
+			/** Returns the uniform cubic B-spline span over four control points.
+			 * @since snapshot20261019
+			 */
+			static cubicSegment<V> uniformBSpline(const V& , const V& , const V& , const V& );
+
+			/** Returns the point at the given parameter.
+			 * @since snapshot20261019
+			 */
+			V evaluate(T ) const;
+
+			/** Returns the first derivative at the given parameter.
+			 * @since snapshot20261019
+			 */
+			V derivative(T ) const;
+
+			/** Returns the second derivative at the given parameter.
+			 * @since snapshot20261019
+			 */
+			V secondDerivative(T ) const;
+
+			/** Evaluates the curve at many parameters.
+			 * @param t The parameters.
+			 * @param count The number of parameters.
+			 * @param points Receives one point per parameter.
+			 * @param derivatives Receives one first derivative per parameter.
+			 * May be <code>nullptr</code>.
+			 * @since snapshot20261019
+			 */
+			void evaluate(const T* , size_t , V* , V* = nullptr) const;
+
+			/** Samples the curve at evenly spaced parameters from 0 to 1
+			 * inclusive, using forward differences: three additions per
+			 * coordinate and sample. The differences are recomputed every
+			 * 64 samples to keep the rounding error from building up.
+			 * @param count The number of samples.
+			 * @param points Receives the samples.
+			 * @since snapshot20261019
+			 */
+			void sample(size_t , V* ) const;
+
+			/** Returns the start of the parameter range, 0.
+			 * @since snapshot20261019
+			 */
+			T domainBegin() const;
+
+			/** Returns the end of the parameter range, 1.
+			 * @since snapshot20261019
+			 */
+			T domainEnd() const;
+		};
+
+		/**
+		 * A piecewise cubic curve made of cubicSegment pieces. Segment i
+		 * covers the parameters [i, i + 1], so the whole curve is
+		 * parameterized over [0, segmentCount()].
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		class AFW_API spline {
+		public:
+			typedef typename vecTraits<V>::scalar T;
+
+			/** Constructs an empty spline.
+			 * @since snapshot20261019
+			 */
+			spline();
+
+			/** Builds a chain of cubic Bezier curves, each sharing its
+			 * last control point with the next one.
+			 * @param points The control points, 3n + 1 for n segments.
+			 * @param count The number of control points.
+			 * @since snapshot20261019
+			 */
+			void buildBezier(const V* , size_t );
+
+			/** Builds a cubic Hermite spline through the given points.
+			 * @param points The points to pass through.
+			 * @param tangents The tangent at each point.
+			 * @param count The number of points.
+			 * @since snapshot20261019
+			 */
+			void buildHermite(const V* , const V* , size_t );
+
+			/** Builds a uniform Catmull-Rom spline through all the given
+			 * points. The end points are repeated to give the first and
+			 * last segments their outer tangents.
+			 * @param points The points to pass through.
+			 * @param count The number of points.
+			 * @since snapshot20261019
+			 */
+			void buildCatmullRom(const V* , size_t );
+
+			/** Builds a uniform cubic B-spline. It does not go through its
+			 * control points, and has count - 3 segments.
+			 * @param points The control points.
+			 * @param count The number of control points.
+			 * @see bspline
+			 * @since snapshot20261019
+			 */
+			void buildBSpline(const V* , size_t );
+
+			/** Returns the number of segments.
+			 * @since snapshot20261019
+			 */
+			size_t segmentCount() const;
+
+			/** Returns the segments.
+			 * @since snapshot20261019
+			 */
+			const std::vector<cubicSegment<V>>& segments() const;
+
+			/** Returns the point at the given parameter, clamped to the curve.
+			 * @since snapshot20261019
+			 */
+			V evaluate(T ) const;
+
+			/** Returns the first derivative at the given parameter.
+			 * @since snapshot20261019
+			 */
+			V derivative(T ) const;
+
+			/** Evaluates the curve at many parameters, in parallel for large batches.
+			 * @param u The parameters.
+			 * @param count The number of parameters.
+			 * @param points Receives one point per parameter.
+			 * @param derivatives Receives one first derivative per parameter.
+			 * May be <code>nullptr</code>.
+			 * @since snapshot20261019
+			 */
+			void evaluate(const T* , size_t , V* , V* = nullptr) const;
+
+			/** Samples every segment at evenly spaced parameters with
+			 * forward differences, as cubicSegment::sample() does.
+			 * @param samplesPerSegment The number of samples per segment,
+			 * not counting the end of the curve.
+			 * @param points Receives segmentCount() * samplesPerSegment + 1 samples.
+			 * @since snapshot20261019
+			 */
+			void sample(size_t , V* ) const;
+
+			/** Returns the start of the parameter range, 0.
+			 * @since snapshot20261019
+			 */
+			T domainBegin() const;
+
+			/** Returns the end of the parameter range, segmentCount().
+			 * @since snapshot20261019
+			 */
+			T domainEnd() const;
+
+		private:
+			size_t locate(T , T& ) const;
+
+			std::vector<cubicSegment<V>> m_segments;
+		};
+
+		/**
+		 * A B-spline of any degree up to MaxDegree over arbitrary
+		 * non-decreasing knots, evaluated with de Boor's algorithm.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		class AFW_API bspline {
+		public:
+			typedef typename vecTraits<V>::scalar T;
+
+			enum {
+				/** The highest supported degree. */
+				MaxDegree = 7
+			};
+
+			/** Constructs an empty B-spline.
+			 * @since snapshot20261019
+			 */
+			bspline();
+
+			/** Builds the B-spline.
+			 * @param points The control points.
+			 * @param count The number of control points, more than degree.
+			 * @param degree The degree, from 1 to MaxDegree.
+			 * @param knots count + degree + 1 non-decreasing knots, or
+			 * <code>nullptr</code> for a clamped uniform knot vector over
+			 * [0, 1], which makes the curve start and end at the first and
+			 * last control points.
+			 * @return <code>false</code> if the arguments are invalid, in
+			 * which case the B-spline is left empty.
+			 * @since snapshot20261019
+			 */
+			bool build(const V* , size_t , int , const T* = nullptr);
+
+			/** Returns the degree.
+			 * @since snapshot20261019
+			 */
+			int degree() const;
+
+			/** Returns the knots.
+			 * @since snapshot20261019
+			 */
+			const std::vector<T>& knots() const;
+
+			/** Returns the point at the given parameter, clamped to the curve.
+			 * @since snapshot20261019
+			 */
+			V evaluate(T ) const;
+
+			/** Returns the first derivative at the given parameter.
+			 * @since snapshot20261019
+			 */
+			V derivative(T ) const;
+
+			/** Evaluates the curve at many parameters, in parallel for large batches.
+			 * @param u The parameters.
+			 * @param count The number of parameters.
+			 * @param points Receives one point per parameter.
+			 * @param derivatives Receives one first derivative per parameter.
+			 * May be <code>nullptr</code>.
+			 * @since snapshot20261019
+			 */
+			void evaluate(const T* , size_t , V* , V* = nullptr) const;
+
+			/** Returns the start of the parameter range, the knot at index degree().
+			 * @since snapshot20261019
+			 */
+			T domainBegin() const;
+
+			/** Returns the end of the parameter range, the knot at index
+			 * knots().size() - degree() - 1.
+			 * @since snapshot20261019
+			 */
+			T domainEnd() const;
+
+		private:
+			size_t span(T& ) const;
+			static V deBoor(const V* , const T* , int , size_t , T );
+
+			int m_degree;
+			std::vector<V> m_points;
+			std::vector<V> m_derivativePoints;
+			std::vector<T> m_knots;
+		};
+
+		/**
+		 * Maps arc length to curve parameter, for any curve with
+		 * evaluate(), derivative(), domainBegin() and domainEnd(). The
+		 * table stores the arc length and speed at evenly spaced
+		 * parameters, integrated with 5 point Gauss-Legendre quadrature;
+		 * lookups interpolate between entries with a cubic Hermite, so
+		 * the error falls with the fourth power of the table resolution.
+		 *
+		 * Build it once per curve and reuse it for every lookup.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		class AFW_API arcLengthTable {
+		public:
+			typedef typename vecTraits<V>::scalar T;
+
+			/** Constructs an empty table.
+			 * @since snapshot20261019
+			 */
+			arcLengthTable();
+
+			/** Builds the table for a curve.
+			 * @param curve The curve.
+			 * @param intervals The number of table intervals. 16 per curve
+			 * segment is plenty for smooth curves.
+			 * @since snapshot20261019
+			 */
+			template<typename C>
+			void build(const C& , size_t );
+
+			/** Returns the total arc length.
+			 * @since snapshot20261019
+			 */
+			T length() const;
+
+			/** Returns the curve parameter at the given arc length, clamped
+			 * to the curve.
+			 * @since snapshot20261019
+			 */
+			T parameter(T ) const;
+
+			/** Maps many arc lengths to parameters, in parallel for large batches.
+			 * @param s The arc lengths.
+			 * @param count The number of arc lengths.
+			 * @param u Receives one parameter per arc length.
+			 * @since snapshot20261019
+			 */
+			void parameters(const T* , size_t , T* ) const;
+
+			/** Samples a curve at evenly spaced arc lengths, end points included.
+			 * @param curve The curve the table was built for.
+			 * @param count The number of samples.
+			 * @param points Receives the samples.
+			 * @param derivatives Receives one first derivative per sample.
+			 * May be <code>nullptr</code>.
+			 * @since snapshot20261019
+			 */
+			template<typename C>
+			void sampleEvenly(const C& , size_t , V* , V* = nullptr) const;
+
+		private:
+			std::vector<T> m_u;
+			std::vector<T> m_s;
+			std::vector<T> m_speed;
+		};
+
+		typedef spline<vec2<float>> Spline2D;
+		typedef spline<vec3<float>> Spline3D;
+		typedef bspline<vec2<float>> BSpline2D;
+		typedef bspline<vec3<float>> BSpline3D;
+
+		namespace Internal {
+			constexpr size_t SplineGrain = 1 << 14;
+			constexpr size_t ForwardDifferenceBlock = 64;
+
+			template<typename V>
+			inline cubicSegment<V> cubicFromBasis(const typename vecTraits<V>::scalar (&m)[4][4], typename vecTraits<V>::scalar scale,
+				const V& p0, const V& p1, const V& p2, const V& p3)
+			{
+				typedef vecTraits<V> traits;
+				cubicSegment<V> s;
+				for(int k = 0; k < 4; k++)
+					for(int i = 0; i < traits::Dimension; i++)
+						traits::set(s.c[k], i, (m[k][0] * traits::get(p0, i) + m[k][1] * traits::get(p1, i)
+							+ m[k][2] * traits::get(p2, i) + m[k][3] * traits::get(p3, i)) * scale);
+				return s;
+			}
+
+			// Samples t0, t0 + h, ... with forward differences, reseeding
+			// the differences from the polynomial every block.
+			template<typename V>
+			void forwardDifference(const cubicSegment<V>& s, typename vecTraits<V>::scalar t0,
+				typename vecTraits<V>::scalar h, size_t count, V* points)
+			{
+				typedef vecTraits<V> traits;
+				typedef typename traits::scalar T;
+				for(size_t start = 0; start < count; start += ForwardDifferenceBlock)
+				{
+					const size_t n = std::min(ForwardDifferenceBlock, count - start);
+					const T t = t0 + h * T(start);
+					for(int i = 0; i < traits::Dimension; i++)
+					{
+						const T c0 = traits::get(s.c[0], i), c1 = traits::get(s.c[1], i);
+						const T c2 = traits::get(s.c[2], i), c3 = traits::get(s.c[3], i);
+						T f = ((c3 * t + c2) * t + c1) * t + c0;
+						T d1 = c1 * h + c2 * (2 * t * h + h * h) + c3 * (3 * t * t * h + 3 * t * h * h + h * h * h);
+						T d2 = 2 * c2 * h * h + c3 * (6 * t * h * h + 6 * h * h * h);
+						const T d3 = 6 * c3 * h * h * h;
+						for(size_t k = 0; k < n; k++)
+						{
+							traits::set(points[start + k], i, f);
+							f += d1;
+							d1 += d2;
+							d2 += d3;
+						}
+					}
+				}
+			}
+		}
+
+		// Inline definitions
+		template<typename V>
+		inline V cubicSegment<V>::evaluate(T t) const
+		{
+			typedef vecTraits<V> traits;
+			V r;
+			for(int i = 0; i < traits::Dimension; i++)
+				traits::set(r, i, ((traits::get(c[3], i) * t + traits::get(c[2], i)) * t + traits::get(c[1], i)) * t + traits::get(c[0], i));
+			return r;
+		}
+
+		template<typename V>
+		inline V cubicSegment<V>::derivative(T t) const
+		{
+			typedef vecTraits<V> traits;
+			V r;
+			for(int i = 0; i < traits::Dimension; i++)
+				traits::set(r, i, (3 * traits::get(c[3], i) * t + 2 * traits::get(c[2], i)) * t + traits::get(c[1], i));
+			return r;
+		}
+
+		template<typename V>
+		inline V cubicSegment<V>::secondDerivative(T t) const
+		{
+			typedef vecTraits<V> traits;
+			V r;
+			for(int i = 0; i < traits::Dimension; i++)
+				traits::set(r, i, 6 * traits::get(c[3], i) * t + 2 * traits::get(c[2], i));
+			return r;
+		}
+
+		template<typename V>
+		inline typename cubicSegment<V>::T cubicSegment<V>::domainBegin() const
+		{
+			return T(0);
+		}
+
+		template<typename V>
+		inline typename cubicSegment<V>::T cubicSegment<V>::domainEnd() const
+		{
+			return T(1);
+		}
+
+		template<typename V>
+		inline size_t spline<V>::segmentCount() const
+		{
+			return m_segments.size();
+		}
+
+		template<typename V>
+		inline const std::vector<cubicSegment<V>>& spline<V>::segments() const
+		{
+			return m_segments;
+		}
+
+		template<typename V>
+		inline typename spline<V>::T spline<V>::domainBegin() const
+		{
+			return T(0);
+		}
+
+		template<typename V>
+		inline typename spline<V>::T spline<V>::domainEnd() const
+		{
+			return T(m_segments.size());
+		}
+
+		template<typename V>
+		inline size_t spline<V>::locate(T u, T& t) const
+		{
+			const T last = T(m_segments.size() - 1);
+			T segment = std::floor(u);
+			segment = segment < 0 ? T(0) : segment > last ? last : segment;
+			t = u - segment;
+			t = t < 0 ? T(0) : t > 1 ? T(1) : t;
+			return static_cast<size_t>(segment);
+		}
+
+		template<typename V>
+		inline V spline<V>::evaluate(T u) const
+		{
+			if(m_segments.empty())
+				return V();
+			T t;
+			const size_t i = locate(u, t);
+			return m_segments[i].evaluate(t);
+		}
+
+		template<typename V>
+		inline V spline<V>::derivative(T u) const
+		{
+			if(m_segments.empty())
+				return V();
+			T t;
+			const size_t i = locate(u, t);
+			return m_segments[i].derivative(t);
+		}
+
+		template<typename V>
+		inline int bspline<V>::degree() const
+		{
+			return m_degree;
+		}
+
+		template<typename V>
+		inline const std::vector<typename bspline<V>::T>& bspline<V>::knots() const
+		{
+			return m_knots;
+		}
+
+		template<typename V>
+		inline typename bspline<V>::T bspline<V>::domainBegin() const
+		{
+			return m_knots[m_degree];
+		}
+
+		template<typename V>
+		inline typename bspline<V>::T bspline<V>::domainEnd() const
+		{
+			return m_knots[m_points.size()];
+		}
+
+		template<typename V>
+		inline typename arcLengthTable<V>::T arcLengthTable<V>::length() const
+		{
+			return m_s.empty() ? T(0) : m_s.back();
+		}
+
+		// Template implementation
+		template<typename V>
+		cubicSegment<V> cubicSegment<V>::bezier(const V& p0, const V& p1, const V& p2, const V& p3)
+		{
+			static const T m[4][4] = {
+				{  1,  0,  0, 0 },
+				{ -3,  3,  0, 0 },
+				{  3, -6,  3, 0 },
+				{ -1,  3, -3, 1 }
+			};
+			return Internal::cubicFromBasis(m, T(1), p0, p1, p2, p3);
+		}
+
+		template<typename V>
+		cubicSegment<V> cubicSegment<V>::hermite(const V& p0, const V& m0, const V& p1, const V& m1)
+		{
+			static const T m[4][4] = {
+				{  1,  0,  0,  0 },
+				{  0,  1,  0,  0 },
+				{ -3, -2,  3, -1 },
+				{  2,  1, -2,  1 }
+			};
+			return Internal::cubicFromBasis(m, T(1), p0, m0, p1, m1);
+		}
+
+		template<typename V>
+		cubicSegment<V> cubicSegment<V>::catmullRom(const V& p0, const V& p1, const V& p2, const V& p3)
+		{
+			static const T m[4][4] = {
+				{  0,  2,  0,  0 },
+				{ -1,  0,  1,  0 },
+				{  2, -5,  4, -1 },
+				{ -1,  3, -3,  1 }
+			};
+			return Internal::cubicFromBasis(m, T(0.5), p0, p1, p2, p3);
+		}
+
+		template<typename V>
+		cubicSegment<V> cubicSegment<V>::uniformBSpline(const V& p0, const V& p1, const V& p2, const V& p3)
+		{
+			static const T m[4][4] = {
+				{  1,  4,  1, 0 },
+				{ -3,  0,  3, 0 },
+				{  3, -6,  3, 0 },
+				{ -1,  3, -3, 1 }
+			};
+			return Internal::cubicFromBasis(m, T(1) / 6, p0, p1, p2, p3);
+		}
+
+		template<typename V>
+		void cubicSegment<V>::evaluate(const T* t, size_t count, V* points, V* derivatives) const
+		{
+			// A copy of the coefficients, so the compiler does not reload
+			// them after every store.
+			const cubicSegment<V> segment = *this;
+			parallelFor(count, Internal::SplineGrain, [&](size_t begin, size_t end, size_t) {
+				AFW_MATH_SIMD_LOOP
+				for(size_t k = begin; k < end; k++)
+					points[k] = segment.evaluate(t[k]);
+				if(derivatives != nullptr)
+				{
+					AFW_MATH_SIMD_LOOP
+					for(size_t k = begin; k < end; k++)
+						derivatives[k] = segment.derivative(t[k]);
+				}
+			});
+		}
+
+		template<typename V>
+		void cubicSegment<V>::sample(size_t count, V* points) const
+		{
+			if(count == 0)
+				return;
+			const T h = count > 1 ? T(1) / T(count - 1) : T(0);
+			Internal::forwardDifference(*this, T(0), h, count, points);
+		}
+
+		template<typename V>
+		spline<V>::spline()
+		{}
+
+		template<typename V>
+		void spline<V>::buildBezier(const V* points, size_t count)
+		{
+			m_segments.clear();
+			for(size_t i = 0; i + 3 < count; i += 3)
+				m_segments.push_back(cubicSegment<V>::bezier(points[i], points[i + 1], points[i + 2], points[i + 3]));
+		}
+
+		template<typename V>
+		void spline<V>::buildHermite(const V* points, const V* tangents, size_t count)
+		{
+			m_segments.clear();
+			for(size_t i = 0; i + 1 < count; i++)
+				m_segments.push_back(cubicSegment<V>::hermite(points[i], tangents[i], points[i + 1], tangents[i + 1]));
+		}
+
+		template<typename V>
+		void spline<V>::buildCatmullRom(const V* points, size_t count)
+		{
+			m_segments.clear();
+			for(size_t i = 0; i + 1 < count; i++)
+			{
+				const V& p0 = points[i > 0 ? i - 1 : 0];
+				const V& p3 = points[i + 2 < count ? i + 2 : count - 1];
+				m_segments.push_back(cubicSegment<V>::catmullRom(p0, points[i], points[i + 1], p3));
+			}
+		}
+
+		template<typename V>
+		void spline<V>::buildBSpline(const V* points, size_t count)
+		{
+			m_segments.clear();
+			for(size_t i = 0; i + 3 < count; i++)
+				m_segments.push_back(cubicSegment<V>::uniformBSpline(points[i], points[i + 1], points[i + 2], points[i + 3]));
+		}
+
+		template<typename V>
+		void spline<V>::evaluate(const T* u, size_t count, V* points, V* derivatives) const
+		{
+			if(m_segments.empty())
+				return;
+			parallelFor(count, Internal::SplineGrain, [&](size_t begin, size_t end, size_t) {
+				for(size_t k = begin; k < end; k++)
+				{
+					T t;
+					const cubicSegment<V>& s = m_segments[locate(u[k], t)];
+					points[k] = s.evaluate(t);
+					if(derivatives != nullptr)
+						derivatives[k] = s.derivative(t);
+				}
+			});
+		}
+
+		template<typename V>
+		void spline<V>::sample(size_t samplesPerSegment, V* points) const
+		{
+			if(m_segments.empty() || samplesPerSegment == 0)
+				return;
+			const T h = T(1) / T(samplesPerSegment);
+			parallelFor(m_segments.size(), Internal::SplineGrain / samplesPerSegment + 1, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					Internal::forwardDifference(m_segments[i], T(0), h, samplesPerSegment, points + i * samplesPerSegment);
+			});
+			points[m_segments.size() * samplesPerSegment] = m_segments.back().evaluate(T(1));
+		}
+
+		template<typename V>
+		bspline<V>::bspline()
+			: m_degree(0)
+		{}
+
+		template<typename V>
+		bool bspline<V>::build(const V* points, size_t count, int degree, const T* knots)
+		{
+			m_degree = 0;
+			m_points.clear();
+			m_derivativePoints.clear();
+			m_knots.clear();
+			if(degree < 1 || degree > MaxDegree || count <= size_t(degree))
+				return false;
+
+			const size_t knotCount = count + degree + 1;
+			if(knots != nullptr)
+			{
+				for(size_t i = 1; i < knotCount; i++)
+					if(knots[i] < knots[i - 1])
+						return false;
+				if(!(knots[count] > knots[degree]))
+					return false;
+				m_knots.assign(knots, knots + knotCount);
+			}
+			else
+			{
+				// Clamped: degree + 1 knots at each end, uniform in between.
+				m_knots.resize(knotCount);
+				const size_t inner = count - degree;
+				for(size_t i = 0; i < knotCount; i++)
+				{
+					if(i <= size_t(degree))
+						m_knots[i] = T(0);
+					else if(i >= count)
+						m_knots[i] = T(1);
+					else
+						m_knots[i] = T(i - degree) / T(inner);
+				}
+			}
+
+			m_degree = degree;
+			m_points.assign(points, points + count);
+
+			// The derivative is a B-spline of one degree less over the
+			// same knots without the outer ones.
+			typedef vecTraits<V> traits;
+			m_derivativePoints.resize(count - 1);
+			for(size_t i = 0; i + 1 < count; i++)
+			{
+				const T delta = m_knots[i + degree + 1] - m_knots[i + 1];
+				const T scale = delta > 0 ? T(degree) / delta : T(0);
+				for(int j = 0; j < traits::Dimension; j++)
+					traits::set(m_derivativePoints[i], j, (traits::get(m_points[i + 1], j) - traits::get(m_points[i], j)) * scale);
+			}
+			return true;
+		}
+
+		template<typename V>
+		size_t bspline<V>::span(T& u) const
+		{
+			const T begin = domainBegin(), end = domainEnd();
+			u = u < begin ? begin : u > end ? end : u;
+			const size_t n = m_points.size();
+			size_t k = static_cast<size_t>(std::upper_bound(m_knots.begin() + m_degree, m_knots.begin() + n + 1, u) - m_knots.begin()) - 1;
+			return k < n - 1 ? k : n - 1;
+		}
+
+		template<typename V>
+		V bspline<V>::deBoor(const V* points, const T* knots, int degree, size_t k, T u)
+		{
+			typedef vecTraits<V> traits;
+			V d[MaxDegree + 1];
+			for(int j = 0; j <= degree; j++)
+				d[j] = points[j + k - degree];
+
+			for(int r = 1; r <= degree; r++)
+			{
+				for(int j = degree; j >= r; j--)
+				{
+					const T left = knots[j + k - degree];
+					const T right = knots[j + 1 + k - r];
+					const T alpha = right > left ? (u - left) / (right - left) : T(0);
+					for(int i = 0; i < traits::Dimension; i++)
+						traits::set(d[j], i, (1 - alpha) * traits::get(d[j - 1], i) + alpha * traits::get(d[j], i));
+				}
+			}
+			return d[degree];
+		}
+
+		template<typename V>
+		V bspline<V>::evaluate(T u) const
+		{
+			if(m_points.empty())
+				return V();
+			const size_t k = span(u);
+			return deBoor(m_points.data(), m_knots.data(), m_degree, k, u);
+		}
+
+		template<typename V>
+		V bspline<V>::derivative(T u) const
+		{
+			if(m_points.empty())
+				return V();
+			const size_t k = span(u);
+			return deBoor(m_derivativePoints.data(), m_knots.data() + 1, m_degree - 1, k - 1, u);
+		}
+
+		template<typename V>
+		void bspline<V>::evaluate(const T* u, size_t count, V* points, V* derivatives) const
+		{
+			if(m_points.empty())
+				return;
+			parallelFor(count, Internal::SplineGrain, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					T v = u[i];
+					const size_t k = span(v);
+					points[i] = deBoor(m_points.data(), m_knots.data(), m_degree, k, v);
+					if(derivatives != nullptr)
+						derivatives[i] = deBoor(m_derivativePoints.data(), m_knots.data() + 1, m_degree - 1, k - 1, v);
+				}
+			});
+		}
+
+		template<typename V>
+		arcLengthTable<V>::arcLengthTable()
+		{}
+
+		template<typename V>
+		template<typename C>
+		void arcLengthTable<V>::build(const C& curve, size_t intervals)
+		{
+			typedef vecTraits<V> traits;
+			if(intervals == 0)
+				intervals = 1;
+
+			auto speed = [&curve](T u) {
+				const V d = curve.derivative(u);
+				T sum = 0;
+				for(int i = 0; i < traits::Dimension; i++)
+					sum += traits::get(d, i) * traits::get(d, i);
+				return std::sqrt(sum);
+			};
+
+			const T begin = curve.domainBegin(), end = curve.domainEnd();
+			const T h = (end - begin) / T(intervals);
+			m_u.resize(intervals + 1);
+			m_s.resize(intervals + 1);
+			m_speed.resize(intervals + 1);
+
+			// Integrate every interval on its own, then accumulate.
+			static const T nodes[5] = { T(-0.9061798459386640), T(-0.5384693101056831), T(0), T(0.5384693101056831), T(0.9061798459386640) };
+			static const T weights[5] = { T(0.2369268850561891), T(0.4786286704993665), T(0.5688888888888889), T(0.4786286704993665), T(0.2369268850561891) };
+			parallelFor(intervals + 1, Internal::SplineGrain / 8, [&](size_t first, size_t last, size_t) {
+				for(size_t i = first; i < last; i++)
+				{
+					const T u = i < intervals ? begin + h * T(i) : end;
+					m_u[i] = u;
+					m_speed[i] = speed(u);
+					T length = 0;
+					if(i < intervals)
+					{
+						for(int k = 0; k < 5; k++)
+							length += weights[k] * speed(u + h * (nodes[k] + 1) / 2);
+						length *= h / 2;
+					}
+					m_s[i] = length;
+				}
+			});
+
+			T sum = 0;
+			for(size_t i = 0; i <= intervals; i++)
+			{
+				const T length = m_s[i];
+				m_s[i] = sum;
+				sum += length;
+			}
+		}
+
+		template<typename V>
+		typename arcLengthTable<V>::T arcLengthTable<V>::parameter(T s) const
+		{
+			if(m_s.empty())
+				return T(0);
+			if(s <= 0)
+				return m_u.front();
+			if(s >= m_s.back())
+				return m_u.back();
+
+			const size_t i = static_cast<size_t>(std::upper_bound(m_s.begin(), m_s.end(), s) - m_s.begin()) - 1;
+			const T ds = m_s[i + 1] - m_s[i];
+			const T du = m_u[i + 1] - m_u[i];
+			if(!(ds > 0))
+				return m_u[i];
+
+			// Cubic Hermite in s, using du/ds = 1 / speed as the slopes.
+			// Stopped points (zero speed) fall back to linear interpolation.
+			const T x = (s - m_s[i]) / ds;
+			if(!(m_speed[i] > 0) || !(m_speed[i + 1] > 0))
+				return m_u[i] + du * x;
+
+			const T m0 = ds / m_speed[i], m1 = ds / m_speed[i + 1];
+			const T x2 = x * x, x3 = x2 * x;
+			return (2 * x3 - 3 * x2 + 1) * m_u[i] + (x3 - 2 * x2 + x) * m0
+				+ (-2 * x3 + 3 * x2) * m_u[i + 1] + (x3 - x2) * m1;
+		}
+
+		template<typename V>
+		void arcLengthTable<V>::parameters(const T* s, size_t count, T* u) const
+		{
+			parallelFor(count, Internal::SplineGrain, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+					u[i] = parameter(s[i]);
+			});
+		}
+
+		template<typename V>
+		template<typename C>
+		void arcLengthTable<V>::sampleEvenly(const C& curve, size_t count, V* points, V* derivatives) const
+		{
+			const T total = length();
+			const T step = count > 1 ? total / T(count - 1) : T(0);
+			parallelFor(count, Internal::SplineGrain, [&](size_t begin, size_t end, size_t) {
+				for(size_t i = begin; i < end; i++)
+				{
+					const T u = parameter(i + 1 == count && count > 1 ? total : step * T(i));
+					points[i] = curve.evaluate(u);
+					if(derivatives != nullptr)
+						derivatives[i] = curve.derivative(u);
+				}
+			});
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_SPLINE_H
@@ -26,6 +26,8 @@
 
 #include <AuroraFW/Internal/Config.h>
 
+#include <cmath>
+
 #define AFW_PI 3.14159265358f
 
 namespace AuroraFW {
@@ -0,0 +1,1258 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/Vector.h
+ * Vector header. This contains the vec struct, a vector of any
+ * dimension, that vec2, vec3 and vec4 are built on.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_VECTOR_H
+#define AURORAFW_MATH_VECTOR_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/STDL/STL/IStream.h>
+#include <AuroraFW/STDL/STL/OStream.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+#if defined(__SSE__) || defined(__SSE2__) || defined(__AVX__) || defined(__AVX512F__)
+	#include <immintrin.h>
+#endif
+
+namespace AuroraFW {
+	namespace Math {
+		template<typename T, uint m, uint n> struct mat;
+
+		namespace Internal {
+			// The coordinates: named x, y, z and w up to four dimensions,
+			// an array above.
+			template<typename T, size_t N>
+			struct vecStorage {
+				T& at(size_t i) { return data[i]; }
+				const T& at(size_t i) const { return data[i]; }
+
+				T data[N];
+			};
+
+			template<typename T>
+			struct vecStorage<T, 1> {
+				T& at(size_t ) { return x; }
+				const T& at(size_t ) const { return x; }
+
+				T x;
+			};
+
+			template<typename T>
+			struct vecStorage<T, 2> {
+				T& at(size_t i) { return i == 0 ? x : y; }
+				const T& at(size_t i) const { return i == 0 ? x : y; }
+
+				T x, y;
+			};
+
+			template<typename T>
+			struct vecStorage<T, 3> {
+				T& at(size_t i) { return i == 0 ? x : i == 1 ? y : z; }
+				const T& at(size_t i) const { return i == 0 ? x : i == 1 ? y : z; }
+
+				T x, y, z;
+			};
+
+			template<typename T>
+			struct vecStorage<T, 4> {
+				T& at(size_t i) { return i == 0 ? x : i == 1 ? y : i == 2 ? z : w; }
+				const T& at(size_t i) const { return i == 0 ? x : i == 1 ? y : i == 2 ? z : w; }
+
+				T x, y, z, w;
+			};
+		}
+
+		/**
+		 * A struct that represents a vector of N coordinates, and allows to
+		 * do vector operations on them. Every operation is unrolled at
+		 * compile time, and some (T, N) pairs use SIMD registers. Up to
+		 * four dimensions the coordinates are named x, y, z and w; above,
+		 * they are reached with operator[].
+		 * @see vec2
+		 * @see vec3
+		 * @see vec4
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		struct AFW_API vec : Internal::vecStorage<T, N> {
+			static_assert(N > 0, "a vector needs at least one coordinate");
+
+			/** Constructs a vector with zero coordinates.
+			 * @since snapshot20170930
+			 */
+			vec();
+
+			/** Constructs a vector with every coordinate set to the given value.
+			 * @param scalar The value for all coordinates.
+			 * @since snapshot20170930
+			 */
+			vec(const T& );
+
+			/** Constructs a vector with the given coordinates, in order. The
+			 * coordinates that are not given are set to 0.
+			 * @since snapshot20170930
+			 */
+			template<typename... A, typename = typename std::enable_if<sizeof...(A) + 2 <= N>::type>
+			vec(const T& , const T& , const A&... );
+
+			/** Constructs a vector using the coordinates from a vector of
+			 * another dimension. Extra coordinates are dropped and missing
+			 * ones are set to 0. It is explicit, so a vector never changes
+			 * dimension behind the caller's back.
+			 * @since snapshot20170930
+			 */
+			template<size_t M>
+			explicit vec(const vec<T, M>& );
+
+			/** Constructs a vector using the coordinates from a smaller
+			 * vector, followed by the given ones. The coordinates that are
+			 * not given are set to 0.
+			 * @since snapshot20171003
+			 */
+			template<size_t M, typename... A, typename = typename std::enable_if<M + sizeof...(A) + 1 <= N>::type>
+			vec(const vec<T, M>& , const T& , const A&... );
+
+			/** Returns the coordinate at the given index.
+			 * @since snapshot20261019
+			 */
+			T& operator[](size_t i) { return this->at(i); }
+			const T& operator[](size_t i) const { return this->at(i); }
+
+			/** Adds the given vector's coordinates to this vector.
+			 * @return This vector with the added coordinates.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& add(const vec<T, N>& );
+
+			/** Subtracts the given vector's coordinates to this vector.
+			 * @return This vector with the subtracted coordinates.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& subtract(const vec<T, N>& );
+
+			/** Multiplies the given vector's coordinates to this vector.
+			 * @return This vector with the multiplied coordinates.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& multiply(const vec<T, N>& );
+
+			/** Divides the given vector's coordinates to this vector.
+			 * @return This vector with the divided coordinates.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& divide(const vec<T, N>& );
+
+			/** Adds the given value to every coordinate of this vector.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& add(const T& );
+
+			/** Subtracts the given value to every coordinate of this vector.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& subtract(const T& );
+
+			/** Multiplies every coordinate of this vector by the given value.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& multiply(const T& );
+
+			/** Divides every coordinate of this vector by the given value.
+			 * @since snapshot20170930
+			 */
+			vec<T, N>& divide(const T& );
+
+			/** Adds the given values to the coordinates of this vector, one
+			 * value per coordinate.
+			 * @since snapshot20170930
+			 */
+			template<typename... A, typename = typename std::enable_if<sizeof...(A) + 2 == N>::type>
+			vec<T, N>& add(const T& , const T& , const A&... );
+
+			/** Subtracts the given values to the coordinates of this vector,
+			 * one value per coordinate.
+			 * @since snapshot20170930
+			 */
+			template<typename... A, typename = typename std::enable_if<sizeof...(A) + 2 == N>::type>
+			vec<T, N>& subtract(const T& , const T& , const A&... );
+
+			/** Multiplies the coordinates of this vector by the given values,
+			 * one value per coordinate.
+			 * @since snapshot20170930
+			 */
+			template<typename... A, typename = typename std::enable_if<sizeof...(A) + 2 == N>::type>
+			vec<T, N>& multiply(const T& , const T& , const A&... );
+
+			/** Divides the coordinates of this vector by the given values,
+			 * one value per coordinate.
+			 * @since snapshot20170930
+			 */
+			template<typename... A, typename = typename std::enable_if<sizeof...(A) + 2 == N>::type>
+			vec<T, N>& divide(const T& , const T& , const A&... );
+
+			/** Transforms this vector by a square matrix. A matrix with one
+			 * more dimension than the vector transforms it as a point,
+			 * with an implicit last coordinate of 1.
+			 * @return The transformed vector.
+			 * @since snapshot20170930
+			 */
+			template<uint m, uint n>
+			vec<T, N> multiply(const mat<T, m, n>& ) const;
+
+			/** Sets the x coordinate to the given value.
+			 * @since snapshot20170930
+			 */
+			void setX(const T& );
+
+			/** Sets the y coordinate to the given value.
+			 * @since snapshot20170930
+			 */
+			void setY(const T& );
+
+			/** Sets the z coordinate to the given value.
+			 * Needs at least three coordinates.
+			 * @since snapshot20170930
+			 */
+			void setZ(const T& );
+
+			/** Sets the w coordinate to the given value.
+			 * Needs at least four coordinates.
+			 * @since snapshot20171003
+			 */
+			void setW(const T& );
+
+			/** Gets the x coordinate.
+			 * @since snapshot20171003
+			 */
+			T getX() const;
+
+			/** Gets the y coordinate.
+			 * @since snapshot20171003
+			 */
+			T getY() const;
+
+			/** Gets the z coordinate.
+			 * Needs at least three coordinates.
+			 * @since snapshot20171003
+			 */
+			T getZ() const;
+
+			/** Gets the w coordinate.
+			 * Needs at least four coordinates.
+			 * @since snapshot20171003
+			 */
+			T getW() const;
+
+			/** Returns the sum of two vectors. Neither operand is modified.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator+(const vec<T, N>& ) const;
+
+			/** Returns the difference of two vectors.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator-(const vec<T, N>& ) const;
+
+			/** Returns the coordinate-wise product of two vectors.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator*(const vec<T, N>& ) const;
+
+			/** Returns the coordinate-wise quotient of two vectors.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator/(const vec<T, N>& ) const;
+
+			/** Returns this vector with the given value added to every coordinate.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator+(const T& ) const;
+
+			/** Returns this vector with the given value subtracted to every coordinate.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator-(const T& ) const;
+
+			/** Returns this vector scaled by the given value.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator*(const T& ) const;
+
+			/** Returns this vector divided by the given value.
+			 * @since snapshot20170930
+			 */
+			vec<T, N> operator/(const T& ) const;
+
+			/** Returns this vector with every coordinate negated.
+			 * @since snapshot20261019
+			 */
+			vec<T, N> operator-() const;
+
+			vec<T, N>& operator+=(const vec<T, N>& );
+			vec<T, N>& operator-=(const vec<T, N>& );
+			vec<T, N>& operator*=(const vec<T, N>& );
+			vec<T, N>& operator/=(const vec<T, N>& );
+			vec<T, N>& operator+=(const T& );
+			vec<T, N>& operator-=(const T& );
+			vec<T, N>& operator*=(const T& );
+			vec<T, N>& operator/=(const T& );
+
+			/**
+			 * Returns <code>true</code> if all the coordinates are exactly equal.
+			 * @since snapshot20170930
+			 */
+			bool operator==(const vec<T, N>& ) const;
+
+			/**
+			 * Returns <code>true</code> if any of the coordinates are different.
+			 * @since snapshot20170930
+			 */
+			bool operator!=(const vec<T, N>& ) const;
+
+			/**
+			 * Returns <code>true</code> if all the coordinates from this vector
+			 * are lower than the coordinates from the given one.
+			 * @since snapshot20170930
+			 */
+			bool operator<(const vec<T, N>& ) const;
+
+			/**
+			 * Returns <code>true</code> if all the coordinates from this vector
+			 * are lower or equal than the coordinates from the given one.
+			 * @since snapshot20170930
+			 */
+			bool operator<=(const vec<T, N>& ) const;
+
+			/**
+			 * Returns <code>true</code> if all the coordinates from this vector
+			 * are bigger than the coordinates from the given one.
+			 * @since snapshot20170930
+			 */
+			bool operator>(const vec<T, N>& ) const;
+
+			/**
+			 * Returns <code>true</code> if all the coordinates from this vector
+			 * are bigger or equal than the coordinates from the given one.
+			 * @since snapshot20170930
+			 */
+			bool operator>=(const vec<T, N>& ) const;
+
+			/**
+			 * The exact same thing as length().
+			 * @see length()
+			 * @since snapshot20170930
+			 */
+			T magnitude() const;
+
+			/**
+			 * Returns the length of this vector. For integer coordinates it
+			 * is the exact length rounded down, saturated to the range of T.
+			 * @see magnitude()
+			 * @since snapshot20170930
+			 */
+			T length() const;
+
+			/**
+			 * Returns the squared length, the dot product with itself. For
+			 * integer coordinates, see lengthSquaredExact() for a result that
+			 * cannot overflow.
+			 * @see length()
+			 * @since snapshot20261019
+			 */
+			T lengthSquared() const;
+
+			/**
+			 * Returns <code>true</code> if every coordinate is zero.
+			 * @see isNaN()
+			 * @since snapshot20170930
+			 */
+			bool isNull() const;
+
+			/**
+			 * Returns <code>true</code> if any coordinate is NaN.
+			 * @see isNull()
+			 * @since snapshot20261019
+			 */
+			bool isNaN() const;
+
+			/**
+			 * Normalizes this vector. (It retains the angle of the
+			 * vector but reduces it's length to 1) Not available for
+			 * integer coordinates.
+			 * @see normalized()
+			 * @since snapshot20170930
+			 */
+			void normalize();
+
+			/**
+			 * Returns a new normalized vector from this one.
+			 * @see normalize()
+			 * @since snapshot20170930
+			 */
+			vec<T, N> normalized() const;
+
+			/**
+			 * Returns the dot product between this vector and the given one.
+			 * @since snapshot20170930
+			 */
+			T dot(const vec<T, N>& ) const;
+
+			/**
+			 * Returns the cross product between this vector and the given
+			 * one. Only defined for three coordinates.
+			 * @return A vector perpendicular to both vectors.
+			 * @since snapshot20261019
+			 */
+			vec<T, N> cross(const vec<T, N>& ) const;
+
+			/**
+			 * Returns the distance from this vector to a point, whose
+			 * coordinates are on the given vector.
+			 * @see distanceToLine()
+			 * @since snapshot20170930
+			 */
+			T distanceToPoint(const vec<T, N>& ) const;
+
+			/**
+			 * Returns the smallest distance from this vector to a line,
+			 * which is defined by a point and a direction.
+			 * @param point A vector representing the point's coordinates.
+			 * @param direction A vector representing the direction of the line.
+			 * @see distanceToPoint()
+			 * @since snapshot20170930
+			 */
+			T distanceToLine(const vec<T, N>& , const vec<T, N>& ) const;
+
+			/**
+			 * Returns the vector as a string, with all its coordinates.
+			 * @since snapshot20170930
+			 */
+			std::string toString() const;
+		};
+
+		/**
+		 * Returns the vector scaled by the given value.
+		 * @since snapshot20261019
+		 */
+		template<typename T, size_t N>
+		vec<T, N> operator*(const T& , const vec<T, N>& );
+
+		/**
+		 * Writes the vector to a stream, as toString().
+		 * @since snapshot20170930
+		 */
+		template<typename T, size_t N>
+		std::ostream& operator<<(std::ostream& , const vec<T, N>& );
+
+		namespace Internal {
+			// Calls f(0), f(1), ..., f(N - 1) with the loop spelled out, so
+			// the coordinate indices are constants after inlining.
+			template<size_t I, size_t N>
+			struct vecUnroll {
+				template<typename F>
+				static inline void apply(const F& f)
+				{
+					f(I);
+					vecUnroll<I + 1, N>::apply(f);
+				}
+			};
+
+			template<size_t N>
+			struct vecUnroll<N, N> {
+				template<typename F>
+				static inline void apply(const F& ) {}
+			};
+
+			// A type that holds the products of two integers of type T, and
+			// sums of a few of them: 64 bits for 8 and 16 bit types, 128 bits
+			// for wider ones where the compiler has them, and 64 bits
+			// otherwise, which then can overflow.
+			template<typename T, bool = (sizeof(T) <= 2)>
+			struct vecWide {
+				typedef typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type type;
+				typedef uint64_t unsignedType;
+			};
+
+#if defined(__SIZEOF_INT128__)
+			template<typename T>
+			struct vecWide<T, false> {
+				// __extension__ keeps -Wpedantic quiet about the type.
+				__extension__ typedef typename std::conditional<std::is_signed<T>::value, __int128, unsigned __int128>::type type;
+				__extension__ typedef unsigned __int128 unsignedType;
+			};
+#endif
+
+			// The length: sqrt() for floating point and other number types,
+			// an exact integer square root of a widened sum for integers.
+			template<bool Integral>
+			struct vecLength {
+				template<typename T, size_t N>
+				static inline T apply(const vec<T, N>& v)
+				{
+					// std::sqrt for the built-in types, found by ADL for others.
+					using std::sqrt;
+					return sqrt(v.dot(v));
+				}
+			};
+
+			// 128 bit unsigned arithmetic for the length of 64 bit vectors,
+			// where the compiler has no 128 bit integers.
+			struct vecUint128 {
+				uint64_t hi, lo;
+
+				static vecUint128 square(uint64_t a)
+				{
+					// (a1 2^32 + a0)^2 = a1^2 2^64 + a0 a1 2^33 + a0^2.
+					const uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+					const uint64_t cross = a0 * a1;
+					vecUint128 r;
+					r.lo = a0 * a0 + (cross << 33);
+					r.hi = a1 * a1 + (cross >> 31) + (r.lo < (cross << 33) ? 1 : 0);
+					return r;
+				}
+
+				// The sum, or the largest value when it overflows.
+				vecUint128 saturatingAdd(const vecUint128& b) const
+				{
+					vecUint128 r;
+					r.lo = lo + b.lo;
+					const uint64_t carry = r.lo < lo ? 1 : 0;
+					r.hi = hi + b.hi;
+					const bool overflow = r.hi < hi;
+					r.hi += carry;
+					if(overflow || r.hi < carry)
+						r.hi = r.lo = ~uint64_t(0);
+					return r;
+				}
+
+				bool operator<=(const vecUint128& b) const
+				{
+					return hi < b.hi || (hi == b.hi && lo <= b.lo);
+				}
+			};
+
+			// The length of integer vectors: the wide path squares into a
+			// type twice as wide as T, the other one into vecUint128.
+			template<typename T, bool = (sizeof(typename vecWide<T>::unsignedType) >= 2 * sizeof(T))>
+			struct vecIntegerLength {
+				template<size_t N>
+				static inline T apply(const vec<T, N>& v)
+				{
+					typedef typename vecWide<T>::type W;
+					typedef typename vecWide<T>::unsignedType U;
+					// Squares fit in U; sums that overflow it are far beyond
+					// the range of T and saturate.
+					const U top = ~U(0);
+					U sum = 0;
+					for(size_t i = 0; i < N; i++)
+					{
+						const W c = W(v[i]);
+						U square = c < 0 ? U(0) - U(c) : U(c);
+						square *= square;
+						sum = sum > top - square ? top : sum + square;
+					}
+					if(sum == 0)
+						return T(0);
+
+					// Newton's method from just above the root, which then
+					// decreases to floor(sqrt(sum)).
+					U r = U(std::sqrt(double(sum)) * (1 + 1e-12)) + 1;
+					for(;;)
+					{
+						const U next = (r + sum / r) / 2;
+						if(next >= r)
+							break;
+						r = next;
+					}
+					return r > U(std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max() : T(r);
+				}
+			};
+
+			template<typename T>
+			struct vecIntegerLength<T, false> {
+				template<size_t N>
+				static inline T apply(const vec<T, N>& v)
+				{
+					vecUint128 sum = { 0, 0 };
+					for(size_t i = 0; i < N; i++)
+					{
+						const uint64_t c = v[i] < 0 ? uint64_t(0) - uint64_t(v[i]) : uint64_t(v[i]);
+						sum = sum.saturatingAdd(vecUint128::square(c));
+					}
+
+					// The root has at most 64 bits: find them from the top.
+					uint64_t r = 0;
+					for(int bit = 63; bit >= 0; bit--)
+					{
+						const uint64_t candidate = r | (uint64_t(1) << bit);
+						if(vecUint128::square(candidate) <= sum)
+							r = candidate;
+					}
+					return r > uint64_t(std::numeric_limits<T>::max()) ? std::numeric_limits<T>::max() : T(r);
+				}
+			};
+
+			template<>
+			struct vecLength<true> {
+				template<typename T, size_t N>
+				static inline T apply(const vec<T, N>& v)
+				{
+					return vecIntegerLength<T>::apply(v);
+				}
+			};
+
+			template<typename T, size_t N>
+			inline void vecFill(vec<T, N>& , size_t ) {}
+
+			template<typename T, size_t N, typename A, typename... R>
+			inline void vecFill(vec<T, N>& v, size_t i, const A& value, const R&... rest)
+			{
+				v[i] = T(value);
+				vecFill(v, i + 1, rest...);
+			}
+
+			// The arithmetic kernels shared by every vector operation. The
+			// generic one is plain unrolled scalar code; the pairs below
+			// that fit a SIMD register specialize it.
+			template<typename T, size_t N>
+			struct vecKernel {
+				static inline void add(vec<T, N>& a, const vec<T, N>& b)
+				{
+					vecUnroll<0, N>::apply([&](size_t i) { a[i] += b[i]; });
+				}
+
+				static inline void subtract(vec<T, N>& a, const vec<T, N>& b)
+				{
+					vecUnroll<0, N>::apply([&](size_t i) { a[i] -= b[i]; });
+				}
+
+				static inline void multiply(vec<T, N>& a, const vec<T, N>& b)
+				{
+					vecUnroll<0, N>::apply([&](size_t i) { a[i] *= b[i]; });
+				}
+
+				static inline void divide(vec<T, N>& a, const vec<T, N>& b)
+				{
+					vecUnroll<0, N>::apply([&](size_t i) { a[i] /= b[i]; });
+				}
+
+				static inline T dot(const vec<T, N>& a, const vec<T, N>& b)
+				{
+					T sum = a[0] * b[0];
+					vecUnroll<1, N>::apply([&](size_t i) { sum += a[i] * b[i]; });
+					return sum;
+				}
+			};
+
+			template<typename T, size_t N, typename R>
+			struct vecSimdKernel {
+				static_assert(sizeof(vec<T, N>) == N * sizeof(T), "vec is not tightly packed");
+				static_assert(N == R::Width, "register width does not match");
+
+				static inline void add(vec<T, N>& a, const vec<T, N>& b)
+				{
+					R::store(&a[0], R::add(R::load(&a[0]), R::load(&b[0])));
+				}
+
+				static inline void subtract(vec<T, N>& a, const vec<T, N>& b)
+				{
+					R::store(&a[0], R::subtract(R::load(&a[0]), R::load(&b[0])));
+				}
+
+				static inline void multiply(vec<T, N>& a, const vec<T, N>& b)
+				{
+					R::store(&a[0], R::multiply(R::load(&a[0]), R::load(&b[0])));
+				}
+
+				static inline void divide(vec<T, N>& a, const vec<T, N>& b)
+				{
+					R::store(&a[0], R::divide(R::load(&a[0]), R::load(&b[0])));
+				}
+
+				static inline T dot(const vec<T, N>& a, const vec<T, N>& b)
+				{
+					return R::sum(R::multiply(R::load(&a[0]), R::load(&b[0])));
+				}
+			};
+
+#if defined(__SSE__)
+			struct vecRegister4f {
+				enum { Width = 4 };
+				typedef __m128 type;
+				static inline __m128 load(const float* p) { return _mm_loadu_ps(p); }
+				static inline void store(float* p, __m128 v) { _mm_storeu_ps(p, v); }
+				static inline __m128 broadcast(float v) { return _mm_set1_ps(v); }
+				static inline __m128 add(__m128 a, __m128 b) { return _mm_add_ps(a, b); }
+				static inline __m128 subtract(__m128 a, __m128 b) { return _mm_sub_ps(a, b); }
+				static inline __m128 multiply(__m128 a, __m128 b) { return _mm_mul_ps(a, b); }
+				static inline __m128 divide(__m128 a, __m128 b) { return _mm_div_ps(a, b); }
+				static inline float sum(__m128 v)
+				{
+					const __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));
+					return _mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, 1)));
+				}
+			};
+
+			template<> struct vecKernel<float, 4> : vecSimdKernel<float, 4, vecRegister4f> {};
+#endif
+
+#if defined(__SSE2__)
+			struct vecRegister2d {
+				enum { Width = 2 };
+				typedef __m128d type;
+				static inline __m128d load(const double* p) { return _mm_loadu_pd(p); }
+				static inline void store(double* p, __m128d v) { _mm_storeu_pd(p, v); }
+				static inline __m128d broadcast(double v) { return _mm_set1_pd(v); }
+				static inline __m128d add(__m128d a, __m128d b) { return _mm_add_pd(a, b); }
+				static inline __m128d subtract(__m128d a, __m128d b) { return _mm_sub_pd(a, b); }
+				static inline __m128d multiply(__m128d a, __m128d b) { return _mm_mul_pd(a, b); }
+				static inline __m128d divide(__m128d a, __m128d b) { return _mm_div_pd(a, b); }
+				static inline double sum(__m128d v) { return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v))); }
+			};
+
+			template<> struct vecKernel<double, 2> : vecSimdKernel<double, 2, vecRegister2d> {};
+#endif
+
+#if defined(__AVX__)
+			struct vecRegister8f {
+				enum { Width = 8 };
+				typedef __m256 type;
+				static inline __m256 load(const float* p) { return _mm256_loadu_ps(p); }
+				static inline void store(float* p, __m256 v) { _mm256_storeu_ps(p, v); }
+				static inline __m256 broadcast(float v) { return _mm256_set1_ps(v); }
+				static inline __m256 add(__m256 a, __m256 b) { return _mm256_add_ps(a, b); }
+				static inline __m256 subtract(__m256 a, __m256 b) { return _mm256_sub_ps(a, b); }
+				static inline __m256 multiply(__m256 a, __m256 b) { return _mm256_mul_ps(a, b); }
+				static inline __m256 divide(__m256 a, __m256 b) { return _mm256_div_ps(a, b); }
+				static inline float sum(__m256 v)
+				{
+					return vecRegister4f::sum(_mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1)));
+				}
+			};
+
+			struct vecRegister4d {
+				enum { Width = 4 };
+				typedef __m256d type;
+				static inline __m256d load(const double* p) { return _mm256_loadu_pd(p); }
+				static inline void store(double* p, __m256d v) { _mm256_storeu_pd(p, v); }
+				static inline __m256d broadcast(double v) { return _mm256_set1_pd(v); }
+				static inline __m256d add(__m256d a, __m256d b) { return _mm256_add_pd(a, b); }
+				static inline __m256d subtract(__m256d a, __m256d b) { return _mm256_sub_pd(a, b); }
+				static inline __m256d multiply(__m256d a, __m256d b) { return _mm256_mul_pd(a, b); }
+				static inline __m256d divide(__m256d a, __m256d b) { return _mm256_div_pd(a, b); }
+				static inline double sum(__m256d v)
+				{
+					return vecRegister2d::sum(_mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1)));
+				}
+			};
+
+			template<> struct vecKernel<float, 8> : vecSimdKernel<float, 8, vecRegister8f> {};
+			template<> struct vecKernel<double, 4> : vecSimdKernel<double, 4, vecRegister4d> {};
+#endif
+
+#if defined(__AVX512F__)
+			struct vecRegister16f {
+				enum { Width = 16 };
+				typedef __m512 type;
+				static inline __m512 load(const float* p) { return _mm512_loadu_ps(p); }
+				static inline void store(float* p, __m512 v) { _mm512_storeu_ps(p, v); }
+				static inline __m512 broadcast(float v) { return _mm512_set1_ps(v); }
+				static inline __m512 add(__m512 a, __m512 b) { return _mm512_add_ps(a, b); }
+				static inline __m512 subtract(__m512 a, __m512 b) { return _mm512_sub_ps(a, b); }
+				static inline __m512 multiply(__m512 a, __m512 b) { return _mm512_mul_ps(a, b); }
+				static inline __m512 divide(__m512 a, __m512 b) { return _mm512_div_ps(a, b); }
+				static inline float sum(__m512 v)
+				{
+					// Through memory: the 512 bit extracts trip uninitialized
+					// warnings in some GCC releases.
+					alignas(64) float lanes[16];
+					_mm512_store_ps(lanes, v);
+					return vecRegister8f::sum(_mm256_add_ps(_mm256_load_ps(lanes), _mm256_load_ps(lanes + 8)));
+				}
+			};
+
+			template<> struct vecKernel<float, 16> : vecSimdKernel<float, 16, vecRegister16f> {};
+#endif
+		}
+
+		// Inline definitions
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::add(const vec<T, N>& v)
+		{
+			Internal::vecKernel<T, N>::add(*this, v);
+			return *this;
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::subtract(const vec<T, N>& v)
+		{
+			Internal::vecKernel<T, N>::subtract(*this, v);
+			return *this;
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::multiply(const vec<T, N>& v)
+		{
+			Internal::vecKernel<T, N>::multiply(*this, v);
+			return *this;
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::divide(const vec<T, N>& v)
+		{
+			Internal::vecKernel<T, N>::divide(*this, v);
+			return *this;
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::add(const T& val)
+		{
+			return add(vec<T, N>(val));
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::subtract(const T& val)
+		{
+			return subtract(vec<T, N>(val));
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::multiply(const T& val)
+		{
+			return multiply(vec<T, N>(val));
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::divide(const T& val)
+		{
+			return divide(vec<T, N>(val));
+		}
+
+		template<typename T, size_t N>
+		template<typename... A, typename>
+		inline vec<T, N>& vec<T, N>::add(const T& a, const T& b, const A&... rest)
+		{
+			return add(vec<T, N>(a, b, rest...));
+		}
+
+		template<typename T, size_t N>
+		template<typename... A, typename>
+		inline vec<T, N>& vec<T, N>::subtract(const T& a, const T& b, const A&... rest)
+		{
+			return subtract(vec<T, N>(a, b, rest...));
+		}
+
+		template<typename T, size_t N>
+		template<typename... A, typename>
+		inline vec<T, N>& vec<T, N>::multiply(const T& a, const T& b, const A&... rest)
+		{
+			return multiply(vec<T, N>(a, b, rest...));
+		}
+
+		template<typename T, size_t N>
+		template<typename... A, typename>
+		inline vec<T, N>& vec<T, N>::divide(const T& a, const T& b, const A&... rest)
+		{
+			return divide(vec<T, N>(a, b, rest...));
+		}
+
+		template<typename T, size_t N>
+		inline void vec<T, N>::setX(const T& val)
+		{
+			(*this)[0] = val;
+		}
+
+		template<typename T, size_t N>
+		inline void vec<T, N>::setY(const T& val)
+		{
+			static_assert(N >= 2, "vector has no y coordinate");
+			(*this)[1] = val;
+		}
+
+		template<typename T, size_t N>
+		inline void vec<T, N>::setZ(const T& val)
+		{
+			static_assert(N >= 3, "vector has no z coordinate");
+			(*this)[2] = val;
+		}
+
+		template<typename T, size_t N>
+		inline void vec<T, N>::setW(const T& val)
+		{
+			static_assert(N >= 4, "vector has no w coordinate");
+			(*this)[3] = val;
+		}
+
+		template<typename T, size_t N>
+		inline T vec<T, N>::getX() const
+		{
+			return (*this)[0];
+		}
+
+		template<typename T, size_t N>
+		inline T vec<T, N>::getY() const
+		{
+			static_assert(N >= 2, "vector has no y coordinate");
+			return (*this)[1];
+		}
+
+		template<typename T, size_t N>
+		inline T vec<T, N>::getZ() const
+		{
+			static_assert(N >= 3, "vector has no z coordinate");
+			return (*this)[2];
+		}
+
+		template<typename T, size_t N>
+		inline T vec<T, N>::getW() const
+		{
+			static_assert(N >= 4, "vector has no w coordinate");
+			return (*this)[3];
+		}
+
+		// Inline Operators
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator+(const vec<T, N>& v) const
+		{
+			return vec<T, N>(*this).add(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator-(const vec<T, N>& v) const
+		{
+			return vec<T, N>(*this).subtract(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator*(const vec<T, N>& v) const
+		{
+			return vec<T, N>(*this).multiply(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator/(const vec<T, N>& v) const
+		{
+			return vec<T, N>(*this).divide(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator+(const T& val) const
+		{
+			return vec<T, N>(*this).add(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator-(const T& val) const
+		{
+			return vec<T, N>(*this).subtract(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator*(const T& val) const
+		{
+			return vec<T, N>(*this).multiply(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator/(const T& val) const
+		{
+			return vec<T, N>(*this).divide(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> vec<T, N>::operator-() const
+		{
+			vec<T, N> r;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r[i] = -(*this)[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator+=(const vec<T, N>& v)
+		{
+			return add(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator-=(const vec<T, N>& v)
+		{
+			return subtract(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator*=(const vec<T, N>& v)
+		{
+			return multiply(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator/=(const vec<T, N>& v)
+		{
+			return divide(v);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator+=(const T& val)
+		{
+			return add(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator-=(const T& val)
+		{
+			return subtract(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator*=(const T& val)
+		{
+			return multiply(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N>& vec<T, N>::operator/=(const T& val)
+		{
+			return divide(val);
+		}
+
+		template<typename T, size_t N>
+		inline vec<T, N> operator*(const T& val, const vec<T, N>& v)
+		{
+			return v * val;
+		}
+
+		template<typename T, size_t N>
+		inline T vec<T, N>::magnitude() const
+		{
+			return length();
+		}
+
+		template<typename T, size_t N>
+		inline T vec<T, N>::dot(const vec<T, N>& other) const
+		{
+			return Internal::vecKernel<T, N>::dot(*this, other);
+		}
+
+		// Template implementation
+		// Constructors
+		template<typename T, size_t N>
+		vec<T, N>::vec()
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { (*this)[i] = T(0); });
+		}
+
+		template<typename T, size_t N>
+		vec<T, N>::vec(const T& scalar)
+		{
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { (*this)[i] = scalar; });
+		}
+
+		template<typename T, size_t N>
+		template<typename... A, typename>
+		vec<T, N>::vec(const T& a, const T& b, const A&... rest)
+			: vec()
+		{
+			Internal::vecFill(*this, 0, a, b, rest...);
+		}
+
+		template<typename T, size_t N>
+		template<size_t M>
+		vec<T, N>::vec(const vec<T, M>& v)
+			: vec()
+		{
+			Internal::vecUnroll<0, (M < N ? M : N)>::apply([&](size_t i) { (*this)[i] = v[i]; });
+		}
+
+		template<typename T, size_t N>
+		template<size_t M, typename... A, typename>
+		vec<T, N>::vec(const vec<T, M>& v, const T& a, const A&... rest)
+			: vec(v)
+		{
+			Internal::vecFill(*this, M, a, rest...);
+		}
+
+		// Operations
+		template<typename T, size_t N>
+		template<uint m, uint n>
+		vec<T, N> vec<T, N>::multiply(const mat<T, m, n>& matrix) const
+		{
+			static_assert(m == n && (m == N || m == N + 1), "matrix does not fit the vector");
+
+			// The matrix is stored by columns.
+			vec<T, N> r;
+			for(size_t row = 0; row < N; row++)
+			{
+				T sum = m > N ? matrix.matrix[N][row] : T(0);
+				for(size_t col = 0; col < N; col++)
+					sum += matrix.matrix[col][row] * (*this)[col];
+				r[row] = sum;
+			}
+			return r;
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::operator==(const vec<T, N>& other) const
+		{
+			bool r = true;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r = r && (*this)[i] == other[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::operator!=(const vec<T, N>& other) const
+		{
+			return !(*this == other);
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::operator<(const vec<T, N>& other) const
+		{
+			bool r = true;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r = r && (*this)[i] < other[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::operator<=(const vec<T, N>& other) const
+		{
+			bool r = true;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r = r && (*this)[i] <= other[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::operator>(const vec<T, N>& other) const
+		{
+			return other < *this;
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::operator>=(const vec<T, N>& other) const
+		{
+			return other <= *this;
+		}
+
+		// Vector operations
+		template<typename T, size_t N>
+		T vec<T, N>::length() const
+		{
+			return Internal::vecLength<std::is_integral<T>::value>::apply(*this);
+		}
+
+		template<typename T, size_t N>
+		T vec<T, N>::lengthSquared() const
+		{
+			return dot(*this);
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::isNull() const
+		{
+			return *this == vec<T, N>();
+		}
+
+		template<typename T, size_t N>
+		bool vec<T, N>::isNaN() const
+		{
+			bool r = false;
+			Internal::vecUnroll<0, N>::apply([&](size_t i) { r = r || (*this)[i] != (*this)[i]; });
+			return r;
+		}
+
+		template<typename T, size_t N>
+		void vec<T, N>::normalize()
+		{
+			static_assert(!std::is_integral<T>::value, "integer vectors cannot be normalized");
+			divide(magnitude());
+		}
+
+		template<typename T, size_t N>
+		vec<T, N> vec<T, N>::normalized() const
+		{
+			static_assert(!std::is_integral<T>::value, "integer vectors cannot be normalized");
+			return *this / magnitude();
+		}
+
+		template<typename T, size_t N>
+		vec<T, N> vec<T, N>::cross(const vec<T, N>& other) const
+		{
+			static_assert(N == 3, "the cross product needs three coordinates");
+			const vec<T, N>& a = *this;
+			return vec<T, N>(a[1] * other[2] - a[2] * other[1],
+				a[2] * other[0] - a[0] * other[2],
+				a[0] * other[1] - a[1] * other[0]);
+		}
+
+		template<typename T, size_t N>
+		T vec<T, N>::distanceToPoint(const vec<T, N>& other) const
+		{
+			return (*this - other).length();
+		}
+
+		template<typename T, size_t N>
+		T vec<T, N>::distanceToLine(const vec<T, N>& point, const vec<T, N>& direction) const
+		{
+			// Remove the part of (this - point) along the direction.
+			vec<T, N> d = *this - point;
+			const T t = d.dot(direction) / direction.dot(direction);
+			d -= direction * t;
+			return d.length();
+		}
+
+		template<typename T, size_t N>
+		std::string vec<T, N>::toString() const
+		{
+			// Streamed rather than std::to_string(), which only takes the
+			// built-in arithmetic types. Byte sized integers print as numbers.
+			typedef typename std::conditional<std::is_integral<T>::value && sizeof(T) == 1, int, const T&>::type printed;
+			std::ostringstream r;
+			r << "vec" << N << ": (";
+			for(size_t i = 0; i < N; i++)
+				r << (i == 0 ? "" : ", ") << printed((*this)[i]);
+			r << ")";
+			return r.str();
+		}
+
+		template<typename T, size_t N>
+		std::ostream& operator<<(std::ostream& stream, const vec<T, N>& vector)
+		{
+			stream << vector.toString();
+			return stream;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_VECTOR_H
@@ -0,0 +1,97 @@
+/****************************************************************************
+** ┌─┐┬ ┬┬─┐┌─┐┬─┐┌─┐  ┌─┐┬─┐┌─┐┌┬┐┌─┐┬ ┬┌─┐┬─┐┬┌─
+** ├─┤│ │├┬┘│ │├┬┘├─┤  ├┤ ├┬┘├─┤│││├┤ ││││ │├┬┘├┴┐
+** ┴ ┴└─┘┴└─└─┘┴└─┴ ┴  └  ┴└─┴ ┴┴ ┴└─┘└┴┘└─┘┴└─┴ ┴
+** A Powerful General Purpose Framework
+** More information in: https://aurora-fw.github.io/
+**
+** Copyright (C) 2017 Aurora Framework, All rights reserved.
+**
+** This file is part of the Aurora Framework. This framework is free
+** software; you can redistribute it and/or modify it under the terms of
+** the GNU Lesser General Public License version 3 as published by the
+** Free Software Foundation and appearing in the file LICENSE included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+****************************************************************************/
+
+/** @file AuroraFW/Math/VectorTraits.h
+ * Vector traits header. This describes the scalar type and dimension
+ * of the vector structs so algorithms can be written once for all of
+ * them.
+ * @since snapshot20261019
+ */
+
+#ifndef AURORAFW_MATH_VECTORTRAITS_H
+#define AURORAFW_MATH_VECTORTRAITS_H
+
+#include <AuroraFW/Global.h>
+#if(AFW_TARGET_PRAGMA_ONCE_SUPPORT)
+	#pragma once
+#endif
+
+#include <AuroraFW/Internal/Config.h>
+
+#include <AuroraFW/Math/Vector.h>
+#include <AuroraFW/Math/Vector2D.h>
+#include <AuroraFW/Math/Vector3D.h>
+#include <AuroraFW/Math/Vector4D.h>
+
+#include <type_traits>
+
+namespace AuroraFW {
+	namespace Math {
+		/**
+		 * Describes a vector type: its scalar type, its dimension and
+		 * access to its coordinates by index (x is 0, y is 1, ...).
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		struct vecTraits;
+
+		template<typename T, size_t N>
+		struct vecTraits<vec<T, N>> {
+			typedef T scalar;
+			enum { Dimension = int(N) };
+
+			static T get(const vec<T, N>& v, int i) { return v[size_t(i)]; }
+			static void set(vec<T, N>& v, int i, const T& val) { v[size_t(i)] = val; }
+		};
+
+		namespace Internal {
+			// vecTraits, extended to plain scalars as one dimensional
+			// vectors, for kernels that take both.
+			template<typename V, bool = std::is_arithmetic<V>::value>
+			struct elementTraits : vecTraits<V> {};
+
+			template<typename V>
+			struct elementTraits<V, true> {
+				typedef V scalar;
+				enum { Dimension = 1 };
+
+				static V get(const V& v, int) { return v; }
+				static void set(V& v, int, const V& val) { v = val; }
+			};
+		}
+
+		/**
+		 * Returns the squared distance between two vectors of the same type.
+		 * @since snapshot20261019
+		 */
+		template<typename V>
+		inline typename vecTraits<V>::scalar distanceSquared(const V& a, const V& b)
+		{
+			typedef vecTraits<V> traits;
+			typename traits::scalar sum = 0;
+			for(int i = 0; i < traits::Dimension; i++)
+			{
+				typename traits::scalar d = traits::get(a, i) - traits::get(b, i);
+				sum += d * d;
+			}
+			return sum;
+		}
+	}
+}
+
+#endif // AURORAFW_MATH_VECTORTRAITS_H